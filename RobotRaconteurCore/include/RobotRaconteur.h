@@ -49,6 +49,7 @@
 #include "RobotRaconteur/Timer.h"
 #ifndef ROBOTRACONTEUR_NO_LOCAL_TRANSPORT
 #include "RobotRaconteur/LocalTransport.h"
+#include "RobotRaconteur/SharedMemoryTransport.h"
 #endif
 #ifndef ROBOTRACONTEUR_NO_HARDWARE_TRANSPORT
 #include "RobotRaconteur/HardwareTransport.h"
@@ -51,6 +51,25 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
     {
         RR_INTRUSIVE_PTR<Message> message;
         boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> callback;
+        bool indexed;
+
+        message_queue_entry() : indexed(false) {}
+    };
+
+    // Key for messages in send_queue that may be coalesced. Only single entry
+    // WirePacket and ConnectionTest messages are indexed. The key points at the
+    // queued message, which is kept alive by send_queue while it is indexed.
+    struct message_queue_key
+    {
+        Message* message;
+        size_t hash;
+
+        bool operator==(const message_queue_key& other) const;
+    };
+
+    struct message_queue_key_hash
+    {
+        size_t operator()(const message_queue_key& k) const { return k.hash; }
     };
 
     RR_BOOST_ASIO_IO_CONTEXT& _io_context;
@@ -67,8 +86,27 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
     bool send_paused;
     boost::function<void(const boost::system::error_code&)> send_pause_request_handler;
 
-    std::list<message_queue_entry> send_queue;
+    // Queued messages are split into lanes by send priority. Keep alive and connection
+    // test messages use the urgent lane, wire packets and messages with a nonzero
+    // header priority use the high lane, and everything else uses the normal lane.
+    // Order is preserved within a lane, and PopSendQueue() serves the lowest numbered
+    // non-empty lane first.
+    enum send_queue_lane_type
+    {
+        send_queue_lane_urgent = 0,
+        send_queue_lane_high,
+        send_queue_lane_normal,
+        send_queue_lane_count
+    };
+
+    boost::array<std::list<message_queue_entry>, send_queue_lane_count> send_queue;
+    size_t send_queue_size;
+    RR_UNORDERED_MAP<message_queue_key, std::list<message_queue_entry>::iterator, message_queue_key_hash>
+        send_queue_index;
     size_t send_message_size;
+    boost::atomic<uint64_t> send_queue_wire_coalesced_count;
+    boost::atomic<uint64_t> send_queue_connection_test_dropped_count;
+    boost::atomic<uint64_t> send_queue_preempted_count;
     boost::condition_variable send_event;
 
     boost::atomic<boost::posix_time::ptime> tlastsend;
@@ -147,6 +185,9 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
     bool disable_string_table;
     bool disable_async_io;
 
+    size_t max_send_batch_size;
+    size_t max_send_batch_count;
+
     mutable_buffers active_recv_bufs;
 
     RR_SHARED_PTR<AsyncMessageReader> async_reader;
@@ -164,6 +205,29 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
     uint32_t active_capabilities_message2_basic;
     uint32_t active_capabilities_message4_basic;
     uint32_t active_capabilities_message4_stringtable;
+    uint32_t active_capabilities_message4_fragment;
+
+    // Messages larger than fragment_message_threshold are sent as a header message followed by
+    // fragments of their large numeric arrays. The fragments are views of the source arrays, and
+    // the receiver copies each fragment into the destination array. Only used when the
+    // MESSAGE4_FRAGMENT capability is active. Zero max_fragmented_message_size disables fragmentation.
+    struct fragment_recv_entry
+    {
+        RR_INTRUSIVE_PTR<Message> message;
+        std::vector<RR_INTRUSIVE_PTR<RRBaseArray> > arrays;
+        std::vector<size_t> received;
+        size_t size;
+        size_t remaining;
+
+        fragment_recv_entry() : size(0), remaining(0) {}
+    };
+
+    size_t max_fragmented_message_size;
+    size_t fragment_size;
+    size_t fragment_message_threshold;
+    uint32_t send_fragment_id;
+    RR_UNORDERED_MAP<uint32_t, fragment_recv_entry> recv_fragments;
+    size_t recv_fragments_size;
 
     ASIOStreamBaseTransport(const RR_SHARED_PTR<RobotRaconteurNode>& node);
 
@@ -210,6 +274,19 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
 
     void SimpleAsyncEndSendMessage(const RR_SHARED_PTR<RobotRaconteurException>& err);
 
+    void QueueSendMessage(const RR_INTRUSIVE_PTR<Message>& m,
+                          const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback);
+
+    bool FragmentMessage(const RR_INTRUSIVE_PTR<Message>& m, std::vector<RR_INTRUSIVE_PTR<Message> >& fragments);
+
+    RR_INTRUSIVE_PTR<Message> FragmentMessageReceived(const RR_INTRUSIVE_PTR<Message>& m);
+
+    static bool GetSendQueueKey(const RR_INTRUSIVE_PTR<Message>& m, message_queue_key& key);
+    static send_queue_lane_type GetSendQueueLane(const RR_INTRUSIVE_PTR<Message>& m);
+    void PushSendQueue(const message_queue_entry& e);
+    const message_queue_entry& PeekSendQueue();
+    message_queue_entry PopSendQueue();
+
     virtual void AsyncAttachStream1(
         const RR_SHARED_PTR<RRObject>& parameter, const RR_SHARED_PTR<RobotRaconteurException>& err,
         const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback);
@@ -220,6 +297,20 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
         const RR_INTRUSIVE_PTR<Message>& m,
         const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback);
 
+    bool SendMessageVersion4(const RR_INTRUSIVE_PTR<Message>& m);
+    size_t PrepareSendMessage(const RR_INTRUSIVE_PTR<Message>& m, bool send_4);
+
+    virtual void BeginSendMessageBatch(
+        const RR_INTRUSIVE_PTR<Message>& m,
+        const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback, bool send_4,
+        size_t message_size);
+
+    static void EndSendMessageBatch(
+        RR_WEAK_PTR<RobotRaconteurNode> node,
+        const RR_SHARED_PTR<std::vector<boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> > >&
+            callbacks,
+        const RR_SHARED_PTR<RobotRaconteurException>& err);
+
     virtual void EndSendMessage(size_t startpos, const boost::system::error_code& error, size_t bytes_transferred,
                                 const RR_INTRUSIVE_PTR<Message>& m, size_t m_len,
                                 const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback,
@@ -324,6 +415,16 @@ class ASIOStreamBaseTransport : public ITransportConnection, public RR_ENABLE_SH
     virtual bool GetDisableStringTable();
     virtual void SetDisableStringTable(bool d);
 
+    // Number of queued wire packets replaced by a newer packet for the same wire
+    virtual uint64_t GetSendQueueWireCoalescedCount();
+    // Number of connection test messages dropped because one was already queued
+    virtual uint64_t GetSendQueueConnectionTestDroppedCount();
+    // Number of queued messages sent ahead of older messages in a lower priority lane
+    virtual uint64_t GetSendQueuePreemptedCount();
+
+    virtual size_t GetMaxFragmentedMessageSize();
+    virtual void SetMaxFragmentedMessageSize(size_t size);
+
     RR_OVIRTUAL bool CheckCapabilityActive(uint32_t cap) RR_OVERRIDE;
 };
 
@@ -46,6 +46,9 @@ class ROBOTRACONTEUR_CORE_API AsyncMessageReader : private boost::noncopyable
     virtual bool MessageReady() = 0;
     virtual RR_INTRUSIVE_PTR<Message> GetNextMessage() = 0;
 
+    virtual RR_SHARED_PTR<RRArrayAllocator> GetArrayAllocator() = 0;
+    virtual void SetArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator) = 0;
+
     static RR_SHARED_PTR<AsyncMessageReader> CreateInstance();
 
     virtual ~AsyncMessageReader();
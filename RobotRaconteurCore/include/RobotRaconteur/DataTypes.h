@@ -30,6 +30,7 @@
 #include <list>
 
 #include <boost/array.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/tuple/tuple.hpp>
 
 #include "RobotRaconteur/RobotRaconteurConstants.h"
@@ -516,6 +517,109 @@ ROBOTRACONTEUR_CORE_API std::string GetRRDataTypeString(DataTypes type);
 ROBOTRACONTEUR_CORE_API bool IsTypeRRArray(DataTypes type);
 ROBOTRACONTEUR_CORE_API bool IsTypeNumeric(DataTypes type);
 
+/**
+ * @brief Storage allocator for numeric and character arrays
+ *
+ * Arrays created with AllocateRRArray<T>() or AttachRRArray<T>() using an
+ * allocator return their storage to the allocator using Release() when
+ * the array is destroyed, instead of using `delete[]`. This can be used to
+ * recycle buffers, or to attach memory owned by another component such as
+ * a device driver or shared memory segment and be notified when the array
+ * is no longer in use.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API RRArrayAllocator : private boost::noncopyable
+{
+  public:
+    /**
+     * @brief Allocate storage for an array
+     *
+     * The returned storage must be aligned for any array element type
+     *
+     * @param size The size of the storage in bytes
+     * @return void* Pointer to the storage
+     */
+    virtual void* Allocate(size_t size) = 0;
+
+    /**
+     * @brief Release storage when an array is destroyed
+     *
+     * @param p Pointer to the storage
+     * @param size The size of the storage in bytes
+     */
+    virtual void Release(void* p, size_t size) = 0;
+
+    virtual ~RRArrayAllocator() {}
+};
+
+/**
+ * @brief Size class buffer pool for numeric and character arrays
+ *
+ * RRArrayBufferPool rounds allocations up to the next power of two and keeps
+ * released buffers in a free list for each size class, so streams that repeatedly
+ * allocate arrays of similar size reuse the same storage instead of using the heap.
+ * Requests larger than the maximum buffer size are passed to the heap. The number of
+ * buffers held by each size class is limited by the maximum cached bytes per class,
+ * with a minimum of two buffers.
+ *
+ * The default pool returned by GetDefault() is used by the transports
+ * to store arrays read from incoming messages.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API RRArrayBufferPool : public RRArrayAllocator
+{
+  public:
+    /**
+     * @brief Construct a new RRArrayBufferPool
+     *
+     * @param max_buffer_size The largest buffer in bytes that will be pooled
+     * @param max_cached_bytes The maximum bytes held in the free list of each size class
+     */
+    RRArrayBufferPool(size_t max_buffer_size = 16 * 1024 * 1024, size_t max_cached_bytes = 4 * 1024 * 1024);
+
+    RR_OVIRTUAL void* Allocate(size_t size) RR_OVERRIDE;
+
+    RR_OVIRTUAL void Release(void* p, size_t size) RR_OVERRIDE;
+
+    /**
+     * @brief Get the number of free buffers currently held by the pool
+     *
+     * @return size_t
+     */
+    size_t GetCachedBufferCount();
+
+    /**
+     * @brief Free all buffers currently held by the pool
+     *
+     */
+    void Clear();
+
+    RR_OVIRTUAL ~RRArrayBufferPool() RR_OVERRIDE;
+
+    /**
+     * @brief Get the process wide default pool
+     *
+     * @return RR_SHARED_PTR<RRArrayBufferPool>
+     */
+    static RR_SHARED_PTR<RRArrayBufferPool> GetDefault();
+
+  protected:
+    static const size_t min_size_class_shift = 6;
+    static const size_t size_class_count = 24;
+
+    struct size_class
+    {
+        boost::mutex lock;
+        std::vector<void*> buffers;
+        size_t max_buffers;
+    };
+
+    size_class size_classes[size_class_count];
+    size_t max_buffer_size;
+
+    static size_t GetSizeClass(size_t size);
+};
+
 /**
  * @brief Base class for numeric and character array value types
  *
@@ -584,9 +688,26 @@ class RRArray : public RRBaseArray
 
     RRArray(T* data, size_t length, bool owned) : data_(data), element_count(length), owned(owned) {}
 
+    RRArray(T* data, size_t length, const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+        : data_(data), element_count(length), owned(false), allocator(allocator)
+    {}
+
+    /**
+     * @brief Construct a single element array stored inline
+     *
+     * The element is stored inside the array object, so no separate
+     * storage is allocated. Used by ScalarToRRArray() and AllocateRRArray()
+     * for one element arrays.
+     *
+     * @param value The value of the element
+     */
+    explicit RRArray(const T& value) : data_(&inline_value), element_count(1), owned(false), inline_value(value) {}
+
     RR_OVIRTUAL ~RRArray() RR_OVERRIDE
     {
-        if (owned)
+        if (allocator)
+            allocator->Release(data_, element_count * sizeof(T));
+        else if (owned)
             delete[] data_;
     }
 
@@ -744,6 +865,8 @@ class RRArray : public RRBaseArray
     T* data_;
     size_t element_count;
     bool owned;
+    RR_SHARED_PTR<RRArrayAllocator> allocator;
+    T inline_value;
 };
 
 template <typename T>
@@ -1045,7 +1168,8 @@ class ROBOTRACONTEUR_CORE_API RRStructure : public RRValue
  * specified type and length
  *
  * This function does not initialize the returned array. The contents
- * will not be set to zero.
+ * will not be set to zero. Arrays with one element store the element
+ * inline in the array object and do not allocate separate storage.
  *
  * Valid values for T are `rr_bool`, `double`, `float`, `int8_t`, `uint8_t`, `int16_t`,
  * `uint16_t`, `int32_t`, `uint32_t`, `int64_t`, `uint64_t`, `cdouble`,
@@ -1058,9 +1182,43 @@ class ROBOTRACONTEUR_CORE_API RRStructure : public RRValue
 template <typename T>
 static RR_INTRUSIVE_PTR<RRArray<T> > AllocateRRArray(size_t length)
 {
+    if (length == 1)
+    {
+        return RR_INTRUSIVE_PTR<RRArray<T> >(new RRArray<T>(T()));
+    }
     return RR_INTRUSIVE_PTR<RRArray<T> >(new RRArray<T>(new T[length], length, true));
 }
 
+/**
+ * @brief Allocate a numeric primitive or character array using an allocator
+ *
+ * Same as AllocateRRArray<T>(size_t), but the storage is obtained from allocator
+ * and returned to allocator when the array is destroyed.
+ *
+ * @tparam T The type of the array elements
+ * @param length The length of the returned array (element count)
+ * @param allocator The allocator to use for the array storage
+ * @return RR_INTRUSIVE_PTR<RRArray<T> > The allocated array
+ */
+template <typename T>
+static RR_INTRUSIVE_PTR<RRArray<T> > AllocateRRArray(size_t length, const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+{
+    if (!allocator || length == 1)
+    {
+        return AllocateRRArray<T>(length);
+    }
+    T* data = static_cast<T*>(allocator->Allocate(length * sizeof(T)));
+    try
+    {
+        return RR_INTRUSIVE_PTR<RRArray<T> >(new RRArray<T>(data, length, allocator));
+    }
+    catch (...)
+    {
+        allocator->Release(data, length * sizeof(T));
+        throw;
+    }
+}
+
 /**
  * @brief Allocates an array object and attaches to existing numeric primitive or character
  * array pointer
@@ -1085,6 +1243,27 @@ static RR_INTRUSIVE_PTR<RRArray<T> > AttachRRArray(T* data, size_t length, bool
     return RR_INTRUSIVE_PTR<RRArray<T> >(new RRArray<T>(data, length, owned));
 }
 
+/**
+ * @brief Allocates an array object and attaches to existing storage released by an allocator
+ *
+ * This function will attach to an existing numeric array pointer, and provide read/write access
+ * to its contents. When the reference count of the array object goes to zero, allocator->Release()
+ * is called with the data pointer and the size of the array in bytes. Use this overload to wrap
+ * memory owned by another component, such as a device driver buffer.
+ *
+ * @tparam T The type of the array elements
+ * @param data Pointer to existing numeric primitive or character array
+ * @param length Length of existing array (element count)
+ * @param allocator The allocator to notify when the array is destroyed
+ * @return RR_INTRUSIVE_PTR<RRArray<T> > The allocated array object
+ */
+template <typename T>
+static RR_INTRUSIVE_PTR<RRArray<T> > AttachRRArray(T* data, size_t length,
+                                                   const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+{
+    return RR_INTRUSIVE_PTR<RRArray<T> >(new RRArray<T>(data, length, allocator));
+}
+
 /**
  * @brief Allocates an array object and copies existing numeric
  *
@@ -1100,7 +1279,7 @@ static RR_INTRUSIVE_PTR<RRArray<T> > AttachRRArray(T* data, size_t length, bool
 template <typename T>
 static RR_INTRUSIVE_PTR<RRArray<T> > AttachRRArrayCopy(const T* data, const size_t length)
 {
-    RR_INTRUSIVE_PTR<RRArray<T> > ret(new RRArray<T>(new T[length], length, true));
+    RR_INTRUSIVE_PTR<RRArray<T> > ret = AllocateRRArray<T>(length);
     memcpy(ret->void_ptr(), data, length * sizeof(T));
     return ret;
 }
@@ -1124,6 +1303,20 @@ static RR_INTRUSIVE_PTR<RRArray<T> > AttachRRArrayCopy(const T* data, const size
  */
 ROBOTRACONTEUR_CORE_API RR_INTRUSIVE_PTR<RRBaseArray> AllocateRRArrayByType(DataTypes type, size_t length);
 
+/**
+ * @brief Allocate an RRBaseArray by type code using an allocator
+ *
+ * Same as AllocateRRArrayByType(DataTypes, size_t), but the storage is obtained
+ * from allocator.
+ *
+ * @param type The type code
+ * @param length The length of the returned array (element count)
+ * @param allocator The allocator to use for the array storage
+ * @return RR_INTRUSIVE_PTR<RRBaseArray> The allocated array
+ */
+ROBOTRACONTEUR_CORE_API RR_INTRUSIVE_PTR<RRBaseArray> AllocateRRArrayByType(
+    DataTypes type, size_t length, const RR_SHARED_PTR<RRArrayAllocator>& allocator);
+
 /**
  * @brief Allocate a numeric primitive or character array with the
  * specified type and length and initialize to zero
@@ -1174,7 +1367,7 @@ ROBOTRACONTEUR_CORE_API size_t RRArrayElementSize(DataTypes type);
 template <typename T>
 static RR_INTRUSIVE_PTR<RRArray<T> > ScalarToRRArray(T value)
 {
-    return AttachRRArrayCopy(&value, 1);
+    return RR_INTRUSIVE_PTR<RRArray<T> >(new RRArray<T>(value));
 }
 
 /**
@@ -120,6 +120,37 @@ class ROBOTRACONTEUR_CORE_API IntraTransport : public Transport, public RR_ENABL
      */
     virtual void StartClient();
 
+    /**
+     * @brief Get if messages are delivered on the sending thread
+     *
+     * See SetInlineDispatch()
+     *
+     * Default: false
+     *
+     * @return true Inline dispatch is enabled
+     * @return false Inline dispatch is disabled
+     */
+    virtual bool GetInlineDispatch();
+
+    /**
+     * @brief Set if messages are delivered on the sending thread
+     *
+     * By default, messages received by an IntraTransport connection are queued and
+     * delivered to the node by the thread pool. When inline dispatch is enabled, a message
+     * is delivered directly on the thread that sent it if no other messages are waiting
+     * for delivery on the connection. This avoids a thread pool handoff for each message,
+     * at the cost of running the receiving node's handlers on the sender's thread. Do not
+     * enable inline dispatch if messages may be sent while holding locks that the receiving
+     * handlers also take.
+     *
+     * Only affects connections created after the option is changed.
+     *
+     * Default: false
+     *
+     * @param inline_dispatch If true, inline dispatch is enabled
+     */
+    virtual void SetInlineDispatch(bool inline_dispatch);
+
   protected:
     virtual void CloseTransportConnection_timed(const boost::system::error_code& err, const RR_SHARED_PTR<Endpoint>& e,
                                                 const RR_SHARED_PTR<void>& timer);
@@ -178,6 +209,8 @@ class ROBOTRACONTEUR_CORE_API IntraTransport : public Transport, public RR_ENABL
     bool closed;
     boost::mutex closed_lock;
     boost::signals2::signal<void()> close_signal;
+
+    boost::atomic<bool> inline_dispatch;
 };
 
 #ifndef ROBOTRACONTEUR_NO_CXX11_TEMPLATE_ALIASES
@@ -253,6 +253,21 @@ class ROBOTRACONTEUR_CORE_API LocalTransport : public Transport, public RR_ENABL
     /** @copydoc TcpTransport::SetDisableAsyncMessageIO() */
     virtual void SetDisableAsyncMessageIO(bool d);
 
+    /** @copydoc TcpTransport::GetMaxSendBatchSize() */
+    virtual int32_t GetMaxSendBatchSize();
+    /** @copydoc TcpTransport::SetMaxSendBatchSize() */
+    virtual void SetMaxSendBatchSize(int32_t size);
+
+    /** @copydoc TcpTransport::GetMaxSendBatchCount() */
+    virtual int32_t GetMaxSendBatchCount();
+    /** @copydoc TcpTransport::SetMaxSendBatchCount() */
+    virtual void SetMaxSendBatchCount(int32_t count);
+
+    /** @copydoc TcpTransport::GetReceiveArrayAllocator() */
+    virtual RR_SHARED_PTR<RRArrayAllocator> GetReceiveArrayAllocator();
+    /** @copydoc TcpTransport::SetReceiveArrayAllocator() */
+    virtual void SetReceiveArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator);
+
     /**
      * @brief Enable node discovery listening
      *
@@ -304,6 +319,9 @@ class ROBOTRACONTEUR_CORE_API LocalTransport : public Transport, public RR_ENABL
     bool disable_message4;
     bool disable_string_table;
     bool disable_async_message_io;
+    int32_t max_send_batch_size;
+    int32_t max_send_batch_count;
+    RR_SHARED_PTR<RRArrayAllocator> receive_array_allocator;
 
     RR_SHARED_PTR<detail::LocalTransportDiscovery> discovery;
     boost::mutex discovery_lock;
@@ -58,6 +58,16 @@ ROBOTRACONTEUR_CORE_API void CalculateMatrixBlocks(uint32_t element_size, std::v
                                                    uint64_t& split_elem_count, uint32_t& splits_count,
                                                    uint32_t& split_remainder, std::vector<uint64_t>& block_count,
                                                    std::vector<uint64_t>& block_count_edge);
+
+struct MultiDimArrayMemoryClient_block
+{
+    std::vector<uint64_t> memorypos;
+    std::vector<uint64_t> bufferpos;
+    std::vector<uint64_t> count;
+    uint64_t elemcount;
+};
+
+class MemoryClient_transfer;
 } // namespace detail
 
 /**
@@ -529,8 +539,37 @@ class ROBOTRACONTEUR_CORE_API ArrayMemoryClientBase : private boost::noncopyable
     uint32_t remote_max_size;
     boost::mutex max_size_lock;
     uint32_t GetMaxTransferSize();
+    void AsyncGetMaxTransferSize(
+        RR_MOVE_ARG(boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler);
+    void EndGetMaxTransferSize(
+        const RR_INTRUSIVE_PTR<MessageEntry>& ret, const RR_SHARED_PTR<RobotRaconteurException>& err,
+        const RR_SHARED_PTR<ServiceStub>& stub,
+        const boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+    uint32_t NegotiateMaxTransferSize();
     virtual void ReadBase(uint64_t memorypos, void* buffer, uint64_t bufferpos, uint64_t count);
     virtual void WriteBase(uint64_t memorypos, const void* buffer, uint64_t bufferpos, uint64_t count);
+    void AsyncReadBase(uint64_t memorypos, void* buffer, const RR_SHARED_PTR<void>& buffer_storage, uint64_t bufferpos,
+                       uint64_t count,
+                       RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                       int32_t timeout);
+    void AsyncWriteBase(uint64_t memorypos, const void* buffer, const RR_SHARED_PTR<void>& buffer_storage,
+                        uint64_t bufferpos, uint64_t count,
+                        RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                        int32_t timeout);
+
+  private:
+    void StartReadTransfer(uint32_t max_transfer_size, const RR_SHARED_PTR<RobotRaconteurException>& err,
+                           const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer, uint64_t memorypos,
+                           void* buffer, uint64_t bufferpos, uint64_t count);
+    void StartWriteTransfer(uint32_t max_transfer_size, const RR_SHARED_PTR<RobotRaconteurException>& err,
+                            const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer, uint64_t memorypos,
+                            const void* buffer, uint64_t bufferpos, uint64_t count);
+    RR_INTRUSIVE_PTR<MessageEntry> CreateReadRequest(uint64_t memorypos, uint64_t max_elems, uint64_t count,
+                                                     size_t block);
+    void ProcessReadResponse(void* buffer, uint64_t bufferpos, uint64_t max_elems, uint64_t count, size_t block,
+                             const RR_INTRUSIVE_PTR<MessageEntry>& ret);
+    RR_INTRUSIVE_PTR<MessageEntry> CreateWriteRequest(uint64_t memorypos, const void* buffer, uint64_t bufferpos,
+                                                      uint64_t max_elems, uint64_t count, size_t block);
 
   public:
     void Shutdown();
@@ -574,6 +613,58 @@ class ArrayMemoryClient : public virtual ArrayMemoryClientBase, public virtual A
         WriteBase(memorypos, &buffer, bufferpos, count);
     }
 
+    /**
+     * @brief Asynchronously read a segment from an array memory
+     *
+     * Same as Read(), but returns asynchronously. Reads larger than the max transfer size
+     * are split into blocks, and up to RobotRaconteurNode::GetMemoryMaxTransferWindow()
+     * block requests are kept in flight. Each block is copied into the buffer as it arrives.
+     * The buffer must not be modified until the handler is called.
+     *
+     * @param memorypos The start index in the memory array to read
+     * @param buffer The buffer to receive the read data
+     * @param bufferpos The start index in the buffer to write the data
+     * @param count The number of array elements to read
+     * @param handler A handler function to call on completion, possibly with an exception
+     * @param timeout Timeout for each block request in milliseconds, or RR_TIMEOUT_INFINITE for no timeout
+     */
+    void AsyncRead(uint64_t memorypos, const RR_INTRUSIVE_PTR<RRArray<T> >& buffer, uint64_t bufferpos,
+                   uint64_t count,
+                   RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                   int32_t timeout = RR_TIMEOUT_INFINITE)
+    {
+        if (!buffer)
+            throw NullValueException("Buffer must not be null");
+        RR_SHARED_PTR<RR_INTRUSIVE_PTR<RRArray<T> > > buffer1 = RR_MAKE_SHARED<RR_INTRUSIVE_PTR<RRArray<T> > >(buffer);
+        AsyncReadBase(memorypos, buffer1.get(), buffer1, bufferpos, count, RR_MOVE(handler), timeout);
+    }
+
+    /**
+     * @brief Asynchronously write a segment to an array memory
+     *
+     * Same as Write(), but returns asynchronously. Writes larger than the max transfer size
+     * are split into blocks, and up to RobotRaconteurNode::GetMemoryMaxTransferWindow()
+     * block requests are kept in flight. The buffer must not be modified until the handler
+     * is called.
+     *
+     * @param memorypos The start index in the memory array to write
+     * @param buffer The buffer to write the data from
+     * @param bufferpos The start index in the buffer to read the data
+     * @param count The number of array elements to write
+     * @param handler A handler function to call on completion, possibly with an exception
+     * @param timeout Timeout for each block request in milliseconds, or RR_TIMEOUT_INFINITE for no timeout
+     */
+    void AsyncWrite(uint64_t memorypos, const RR_INTRUSIVE_PTR<RRArray<T> >& buffer, uint64_t bufferpos,
+                    uint64_t count,
+                    RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                    int32_t timeout = RR_TIMEOUT_INFINITE)
+    {
+        if (!buffer)
+            throw NullValueException("Buffer must not be null");
+        RR_SHARED_PTR<RR_INTRUSIVE_PTR<RRArray<T> > > buffer1 = RR_MAKE_SHARED<RR_INTRUSIVE_PTR<RRArray<T> > >(buffer);
+        AsyncWriteBase(memorypos, buffer1.get(), buffer1, bufferpos, count, RR_MOVE(handler), timeout);
+    }
+
     RR_OVIRTUAL uint64_t Length() RR_OVERRIDE { return ArrayMemoryClientBase::Length(); }
 
   protected:
@@ -640,10 +731,44 @@ class ROBOTRACONTEUR_CORE_API MultiDimArrayMemoryClientBase : private boost::non
     boost::mutex max_size_lock;
 
     uint32_t GetMaxTransferSize();
+    void AsyncGetMaxTransferSize(
+        RR_MOVE_ARG(boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler);
+    void EndGetMaxTransferSize(
+        const RR_INTRUSIVE_PTR<MessageEntry>& ret, const RR_SHARED_PTR<RobotRaconteurException>& err,
+        const RR_SHARED_PTR<ServiceStub>& stub,
+        const boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+    uint32_t NegotiateMaxTransferSize();
     virtual void ReadBase(const std::vector<uint64_t>& memorypos, void* buffer, const std::vector<uint64_t>& bufferpos,
                           const std::vector<uint64_t>& count);
     virtual void WriteBase(const std::vector<uint64_t>& memorypos, const void* buffer,
                            const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count);
+    void AsyncReadBase(const std::vector<uint64_t>& memorypos, void* buffer, const RR_SHARED_PTR<void>& buffer_storage,
+                       const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count,
+                       RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                       int32_t timeout);
+    void AsyncWriteBase(const std::vector<uint64_t>& memorypos, const void* buffer,
+                        const RR_SHARED_PTR<void>& buffer_storage, const std::vector<uint64_t>& bufferpos,
+                        const std::vector<uint64_t>& count,
+                        RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                        int32_t timeout);
+
+  private:
+    void StartReadTransfer(uint32_t max_transfer_size, const RR_SHARED_PTR<RobotRaconteurException>& err,
+                           const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer,
+                           const std::vector<uint64_t>& memorypos, void* buffer,
+                           const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count);
+    void StartWriteTransfer(uint32_t max_transfer_size, const RR_SHARED_PTR<RobotRaconteurException>& err,
+                            const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer,
+                            const std::vector<uint64_t>& memorypos, const void* buffer,
+                            const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count);
+    RR_INTRUSIVE_PTR<MessageEntry> CreateReadRequest(
+        const RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> >& blocks, size_t block);
+    void ProcessReadResponse(void* buffer,
+                             const RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> >& blocks,
+                             size_t block, const RR_INTRUSIVE_PTR<MessageEntry>& ret);
+    RR_INTRUSIVE_PTR<MessageEntry> CreateWriteRequest(
+        const void* buffer, const RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> >& blocks,
+        size_t block);
 
   public:
     void Shutdown();
@@ -693,6 +818,60 @@ class MultiDimArrayMemoryClient : public virtual MultiDimArrayMemory<T>, public
         WriteBase(memorypos, &buffer, bufferpos, count);
     }
 
+    /**
+     * @brief Asynchronously read a block from a multidimensional array memory
+     *
+     * Same as Read(), but returns asynchronously. Reads larger than the max transfer size
+     * are split into blocks, and up to RobotRaconteurNode::GetMemoryMaxTransferWindow()
+     * block requests are kept in flight. Each block is copied into the buffer as it arrives.
+     * The buffer must not be modified until the handler is called.
+     *
+     * @param memorypos The start position in the memory array to read
+     * @param buffer The buffer to receive the read data
+     * @param bufferpos The start position in the buffer to write the data
+     * @param count The count of array elements to read
+     * @param handler A handler function to call on completion, possibly with an exception
+     * @param timeout Timeout for each block request in milliseconds, or RR_TIMEOUT_INFINITE for no timeout
+     */
+    void AsyncRead(const std::vector<uint64_t>& memorypos, const RR_INTRUSIVE_PTR<RRMultiDimArray<T> >& buffer,
+                   const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count,
+                   RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                   int32_t timeout = RR_TIMEOUT_INFINITE)
+    {
+        if (!buffer)
+            throw NullValueException("Buffer must not be null");
+        RR_SHARED_PTR<RR_INTRUSIVE_PTR<RRMultiDimArray<T> > > buffer1 =
+            RR_MAKE_SHARED<RR_INTRUSIVE_PTR<RRMultiDimArray<T> > >(buffer);
+        AsyncReadBase(memorypos, buffer1.get(), buffer1, bufferpos, count, RR_MOVE(handler), timeout);
+    }
+
+    /**
+     * @brief Asynchronously write a block to a multidimensional array memory
+     *
+     * Same as Write(), but returns asynchronously. Writes larger than the max transfer size
+     * are split into blocks, and up to RobotRaconteurNode::GetMemoryMaxTransferWindow()
+     * block requests are kept in flight. The buffer must not be modified until the handler
+     * is called.
+     *
+     * @param memorypos The start position in the memory array to write
+     * @param buffer The buffer to write the data from
+     * @param bufferpos The start position in the buffer to read the data
+     * @param count The count of array elements to write
+     * @param handler A handler function to call on completion, possibly with an exception
+     * @param timeout Timeout for each block request in milliseconds, or RR_TIMEOUT_INFINITE for no timeout
+     */
+    void AsyncWrite(const std::vector<uint64_t>& memorypos, const RR_INTRUSIVE_PTR<RRMultiDimArray<T> >& buffer,
+                    const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count,
+                    RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+                    int32_t timeout = RR_TIMEOUT_INFINITE)
+    {
+        if (!buffer)
+            throw NullValueException("Buffer must not be null");
+        RR_SHARED_PTR<RR_INTRUSIVE_PTR<RRMultiDimArray<T> > > buffer1 =
+            RR_MAKE_SHARED<RR_INTRUSIVE_PTR<RRMultiDimArray<T> > >(buffer);
+        AsyncWriteBase(memorypos, buffer1.get(), buffer1, bufferpos, count, RR_MOVE(handler), timeout);
+    }
+
   protected:
     RR_OVIRTUAL void UnpackReadResult(const RR_INTRUSIVE_PTR<MessageElementData>& res, void* buffer,
                                       const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count,
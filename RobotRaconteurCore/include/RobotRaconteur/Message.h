@@ -207,6 +207,11 @@ class ROBOTRACONTEUR_CORE_API MessageElement : public RRValue
 
     uint32_t DataCount;
 
+    // Version 4 encoding of the element created by Encode4(). When set, the element is written
+    // from these bytes and the fields are not serialized again. Shallow copies share the encoding.
+    // Cleared by SetData(). Must be cleared if any other field is changed after encoding.
+    RR_INTRUSIVE_PTR<RRArray<uint8_t> > Encoded4;
+
   private:
     RR_INTRUSIVE_PTR<MessageElementData> dat;
 
@@ -230,6 +235,7 @@ class ROBOTRACONTEUR_CORE_API MessageElement : public RRValue
     void UpdateData4();
     void Write4(ArrayBinaryWriter& w);
     void Read4(ArrayBinaryReader& r);
+    void Encode4();
 
     static RR_INTRUSIVE_PTR<MessageElement> FindElement(std::vector<RR_INTRUSIVE_PTR<MessageElement> >& m,
                                                         MessageStringRef name);
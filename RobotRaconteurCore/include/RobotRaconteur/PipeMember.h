@@ -48,7 +48,14 @@ class ROBOTRACONTEUR_CORE_API PipeEndpointBaseListener;
 namespace detail
 {
 class PipeSubscription_connection;
-}
+
+struct PipeEndpointBase_pending_send
+{
+    RR_INTRUSIVE_PTR<RRValue> packet;
+    RR_INTRUSIVE_PTR<MessageElement> packet_element;
+    boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)> handler;
+};
+} // namespace detail
 
 /**
  * @brief Base class for PipeEndpoint
@@ -178,6 +185,49 @@ class ROBOTRACONTEUR_CORE_API PipeEndpointBase : public RR_ENABLE_SHARED_FROM_TH
      */
     void SetIgnoreReceived(bool ignore);
 
+    /**
+     * @brief Get the send window negotiated with the peer endpoint
+     *
+     * The send window is the number of packets that may be in flight before the peer
+     * endpoint grants more credits. Zero means the peer endpoint is not using flow control.
+     * See PipeBase::SetFlowControlWindow()
+     *
+     * @return uint32_t The send window in packets, or zero if sends are not limited
+     */
+    uint32_t GetSendWindow();
+
+    /**
+     * @brief Get the number of packets that can be sent before waiting for credits
+     *
+     * Returns zero while the send window is full. Not meaningful if GetSendWindow() is zero.
+     *
+     * @return uint32_t The number of available send credits
+     */
+    uint32_t GetSendCredits();
+
+    /**
+     * @brief Get the receive window advertised to the peer endpoint
+     *
+     * Zero means that the peer endpoint is not limited by this endpoint.
+     *
+     * @return uint32_t The receive window in packets
+     */
+    uint32_t GetRecvWindow();
+
+    /**
+     * @brief Block until there is space in the send window
+     *
+     * Returns immediately if the peer endpoint is not using flow control. It is not
+     * necessary to call this function before sending. Packets sent while the send window
+     * is full are queued and transmitted in order as credits are received. SendPacket()
+     * blocks and the AsyncSendPacket() handler is not called until the packet is transmitted.
+     *
+     * @param timeout Timeout in milliseconds, or RR_TIMEOUT_INFINITE for no timeout
+     * @return true There is space in the send window
+     * @return false The timeout expired or the endpoint was closed
+     */
+    bool TryWaitSendWindow(int32_t timeout = RR_TIMEOUT_INFINITE);
+
     virtual void AddListener(const RR_SHARED_PTR<PipeEndpointBaseListener>& listener);
 
     RR_SHARED_PTR<RobotRaconteurNode> GetNode();
@@ -197,6 +247,11 @@ class ROBOTRACONTEUR_CORE_API PipeEndpointBase : public RR_ENABLE_SHARED_FROM_TH
                              RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>)
                                  handler);
 
+    void AsyncSendPacketBase(const RR_INTRUSIVE_PTR<RRValue>& packet,
+                             const RR_INTRUSIVE_PTR<MessageElement>& packet_element,
+                             RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>)
+                                 handler);
+
     RR_INTRUSIVE_PTR<RRValue> ReceivePacketBase();
     RR_INTRUSIVE_PTR<RRValue> PeekPacketBase();
 
@@ -218,6 +273,22 @@ class ROBOTRACONTEUR_CORE_API PipeEndpointBase : public RR_ENABLE_SHARED_FROM_TH
 
     void PipePacketAckReceived(uint32_t packetnum);
 
+    void InitFlowControl(uint32_t send_window, uint32_t recv_window);
+
+    void PipeCreditsReceived(uint32_t credits);
+
+    // Must be called with recvlock held. Returns the credits to grant to the peer, or zero
+    uint32_t ConsumeRecvCredits(uint32_t count);
+
+    void SendRecvCredits(uint32_t credits);
+
+    void AbortPendingSends();
+
+    // Must be called with sendlock held
+    void DoAsyncSendPacketBase(
+        const RR_INTRUSIVE_PTR<RRValue>& packet, const RR_INTRUSIVE_PTR<MessageElement>& packet_element,
+        RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler);
+
     void Shutdown();
 
     virtual void fire_PipeEndpointClosedCallback() = 0;
@@ -233,6 +304,17 @@ class ROBOTRACONTEUR_CORE_API PipeEndpointBase : public RR_ENABLE_SHARED_FROM_TH
     uint32_t send_packet_number;
     uint32_t recv_packet_number;
 
+    // Credit based flow control, protected by sendlock. A send window of zero disables the limit
+    uint32_t send_window;
+    uint32_t send_credits;
+    bool send_closed;
+    std::deque<detail::PipeEndpointBase_pending_send> send_pending;
+    boost::condition_variable send_credits_wait;
+
+    // Protected by recvlock. A receive window of zero disables credit grants
+    uint32_t recv_window;
+    uint32_t recv_consumed;
+
     RR_WEAK_PTR<PipeBase> parent;
     int32_t index;
     uint32_t endpoint;
@@ -273,6 +355,11 @@ class ROBOTRACONTEUR_CORE_API PipeEndpointBase : public RR_ENABLE_SHARED_FROM_TH
  * TryReceivePacketWait(), TryReceivePacketWait(), or PeekNextPacket(). The endpoint is closed
  * using the Close() or AsyncClose() function.
  *
+ * Reliable endpoints use credit based flow control if a flow control window is configured
+ * using Pipe::SetFlowControlWindow() by the receiving side. The sender may have at most
+ * GetSendWindow() packets in flight, and packets sent while the window is full wait for
+ * the receiver to grant more credits.
+ *
  * This class is instantiated by the Pipe class. It should not be instantiated
  * by the user.
  *
@@ -538,6 +625,7 @@ class PipeEndpoint : public PipeEndpointBase
 class ROBOTRACONTEUR_CORE_API PipeBase : public RR_ENABLE_SHARED_FROM_THIS<PipeBase>, private boost::noncopyable
 {
     friend class PipeEndpointBase;
+    friend class PipeBroadcasterBase;
 
   public:
     virtual ~PipeBase() {}
@@ -566,16 +654,56 @@ class ROBOTRACONTEUR_CORE_API PipeBase : public RR_ENABLE_SHARED_FROM_THIS<PipeB
                             RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
                             int32_t timeout) = 0;
 
+    /**
+     * @brief Get the flow control receive window for new pipe endpoints
+     *
+     * See SetFlowControlWindow()
+     *
+     * Default: 0 (disabled)
+     *
+     * @return uint32_t The receive window in packets
+     */
+    uint32_t GetFlowControlWindow();
+
+    /**
+     * @brief Set the flow control receive window for new pipe endpoints
+     *
+     * Reliable pipe endpoints negotiate credit based flow control when they are connected. The
+     * receive window is the number of packets the peer endpoint may send before it must wait
+     * for more credits. Credits are granted to the peer as packets are removed from the
+     * receive queue, or discarded because SetIgnoreReceived() is true. This bounds the number
+     * of packets queued in the transports and in the receive queue when the producer is faster
+     * than the consumer.
+     *
+     * Zero disables flow control for packets received by the pipe. Only affects endpoints
+     * connected after the window is changed. Unreliable endpoints and peers that do not
+     * support flow control are not limited.
+     *
+     * Default: 0 (disabled)
+     *
+     * @param window The receive window in packets
+     */
+    void SetFlowControlWindow(uint32_t window);
+
   protected:
     PipeBase();
 
     bool unreliable;
 
+    boost::atomic<uint32_t> flow_control_window;
+
     virtual void AsyncSendPipePacket(
         const RR_INTRUSIVE_PTR<RRValue>& data, int32_t index, uint32_t packetnumber, bool requestack, uint32_t endpoint,
         bool unreliable,
         RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler) = 0;
 
+    virtual void AsyncSendPipePacketElement(
+        const RR_INTRUSIVE_PTR<MessageElement>& packet, int32_t index, uint32_t packetnumber, bool requestack,
+        uint32_t endpoint, bool unreliable,
+        RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler) = 0;
+
+    virtual void AsyncSendPipeCredits(int32_t index, uint32_t credits, uint32_t endpoint) = 0;
+
     bool rawelements;
 
     void DispatchPacketAck(const RR_INTRUSIVE_PTR<MessageElement>& me, const RR_SHARED_PTR<PipeEndpointBase>& e);
@@ -586,6 +714,13 @@ class ROBOTRACONTEUR_CORE_API PipeBase : public RR_ENABLE_SHARED_FROM_THIS<PipeB
     RR_INTRUSIVE_PTR<MessageElement> PackPacket(const RR_INTRUSIVE_PTR<RRValue>& data, int32_t index,
                                                 uint32_t packetnumber, bool requestack);
 
+    RR_INTRUSIVE_PTR<MessageElement> PackPacketElement(const RR_INTRUSIVE_PTR<RRValue>& data);
+
+    RR_INTRUSIVE_PTR<MessageElement> PackPacketFromElement(const RR_INTRUSIVE_PTR<MessageElement>& packet,
+                                                           int32_t index, uint32_t packetnumber, bool requestack);
+
+    RR_INTRUSIVE_PTR<MessageElement> PackCredits(int32_t index, uint32_t credits);
+
     virtual void DeleteEndpoint(const RR_SHARED_PTR<PipeEndpointBase>& e) = 0;
 
     virtual RR_INTRUSIVE_PTR<MessageElementData> PackData(const RR_INTRUSIVE_PTR<RRValue>& data)
@@ -807,6 +942,14 @@ class ROBOTRACONTEUR_CORE_API PipeClientBase : public virtual PipeBase
         RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>)
             handler) RR_OVERRIDE;
 
+    RR_OVIRTUAL void AsyncSendPipePacketElement(
+        const RR_INTRUSIVE_PTR<MessageElement>& packet, int32_t index, uint32_t packetnumber, bool requestack,
+        uint32_t endpoint, bool unreliable,
+        RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>)
+            handler) RR_OVERRIDE;
+
+    RR_OVIRTUAL void AsyncSendPipeCredits(int32_t index, uint32_t credits, uint32_t endpoint) RR_OVERRIDE;
+
     std::string m_MemberName;
 
     RR_UNORDERED_MAP<int32_t, RR_SHARED_PTR<PipeEndpointBase> > pipeendpoints;
@@ -826,8 +969,15 @@ class ROBOTRACONTEUR_CORE_API PipeClientBase : public virtual PipeBase
                                    handler,
                                int32_t timeout);
 
+    void AsyncConnect_internal(int32_t index,
+                               RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<PipeEndpointBase>&,
+                                                                const RR_SHARED_PTR<RobotRaconteurException>&)>)
+                                   handler,
+                               int32_t timeout, uint32_t recv_window);
+
     void AsyncConnect_internal1(const RR_INTRUSIVE_PTR<MessageEntry>& ret,
                                 const RR_SHARED_PTR<RobotRaconteurException>& err, int32_t index, int32_t key,
+                                uint32_t recv_window,
                                 boost::function<void(const RR_SHARED_PTR<PipeEndpointBase>&,
                                                      const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
 
@@ -898,7 +1048,9 @@ class PipeClient : public virtual Pipe<T>, public virtual PipeClientBase
     }
 
     using PipeClientBase::AsyncClose;
+    using PipeClientBase::AsyncSendPipeCredits;
     using PipeClientBase::AsyncSendPipePacket;
+    using PipeClientBase::AsyncSendPipePacketElement;
     using PipeClientBase::GetMemberName;
     using PipeClientBase::PipePacketReceived;
     using PipeClientBase::Shutdown;
@@ -935,11 +1087,19 @@ class ROBOTRACONTEUR_CORE_API PipeServerBase : public virtual PipeBase
         RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>)
             handler) RR_OVERRIDE;
 
+    RR_OVIRTUAL void AsyncSendPipePacketElement(
+        const RR_INTRUSIVE_PTR<MessageElement>& packet, int32_t index, uint32_t packetnumber, bool requestack,
+        uint32_t endpoint, bool unreliable,
+        RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>)
+            handler) RR_OVERRIDE;
+
     RR_OVIRTUAL void AsyncClose(const RR_SHARED_PTR<PipeEndpointBase>& endpoint, bool remote, uint32_t ee,
                                 RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>)
                                     handler,
                                 int32_t timeout) RR_OVERRIDE;
 
+    RR_OVIRTUAL void AsyncSendPipeCredits(int32_t index, uint32_t credits, uint32_t endpoint) RR_OVERRIDE;
+
     virtual RR_INTRUSIVE_PTR<MessageEntry> PipeCommand(const RR_INTRUSIVE_PTR<MessageEntry>& m, uint32_t e);
 
     RR_SHARED_PTR<ServiceSkel> GetSkel();
@@ -1207,6 +1367,9 @@ class ROBOTRACONTEUR_CORE_API PipeBroadcasterBase : public RR_ENABLE_SHARED_FROM
  * are in flight to each client pipe endpoint. (This is accomplished using packet acks.) If a
  * maximum backlog is specified, pipe endpoints exceeding this count will stop sending packets.
  * Specify the maximum backlog using the Init() function or the SetMaxBacklog() function.
+ * Clients that configure a flow control window using Pipe::SetFlowControlWindow() or
+ * PipeSubscription::SetFlowControlWindow() are also skipped while their send window is full,
+ * so packets are dropped instead of queueing behind a slow client.
  *
  * The rate that packets are sent can be regulated using a callback function configured
  * with the SetPredicate() function, or using the BroadcastDownsampler class.
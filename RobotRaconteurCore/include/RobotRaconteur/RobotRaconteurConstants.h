@@ -235,6 +235,8 @@ enum MessageEntryType
     MessageEntryType_StreamCheckCapabilityRet,
     // MessageEntryType_StringTableOp, - Deprecated!
     // MessageEntryType_StringTableOpRet, - Deprecated!
+    /** @brief Stream message fragment packet (transport only) */
+    MessageEntryType_StreamFragment = 7,
     /** @brief Get service definition request */
     MessageEntryType_GetServiceDesc = 101,
     /** @brief Get service definition response */
@@ -595,6 +597,10 @@ const uint32_t TransportCapabilityCode_MESSAGE4_STRINGTABLE_ENABLE = 0x00000001;
 const uint32_t TransportCapabilityCode_MESSAGE4_STRINGTABLE_MESSAGE_LOCAL = 0x00000002;
 /** @brief Enable Message Version 4 standard String Table capability code */
 const uint32_t TransportCapabilityCode_MESSAGE4_STRINGTABLE_STANDARD_TABLE = 0x00000004;
+/** @brief Message Version 4 Fragment capability page code */
+const uint32_t TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE = 0x04200000;
+/** @brief Enable Message Version 4 fragmented message transport capability code */
+const uint32_t TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE = 0x00000001;
 
 /**
  * @brief Log level enum
@@ -47,6 +47,7 @@
 #include <boost/random.hpp>
 #include <boost/random/random_device.hpp>
 #include <boost/chrono.hpp>
+#include <boost/atomic.hpp>
 
 #ifndef ROBOTRACONTEUR_EMSCRIPTEN
 #include <boost/asio.hpp>
@@ -101,7 +102,9 @@ class ROBOTRACONTEUR_CORE_API ServiceSubscriptionManager;
 namespace detail
 {
 class Discovery;
-}
+template <typename T, typename K = uint32_t>
+class NodeRoutingTable;
+} // namespace detail
 
 /**
  * @brief The central node implementation
@@ -789,6 +792,9 @@ class ROBOTRACONTEUR_CORE_API RobotRaconteurNode : boost::noncopyable,
     uint32_t MemoryMaxTransferSize;
     boost::mutex MemoryMaxTransferSize_lock;
 
+    uint32_t MemoryMaxTransferWindow;
+    boost::mutex MemoryMaxTransferWindow_lock;
+
   public:
     /**
      * @brief Get the timeout for requests in milliseconds
@@ -879,6 +885,28 @@ class ROBOTRACONTEUR_CORE_API RobotRaconteurNode : boost::noncopyable,
      */
     void SetMemoryMaxTransferSize(uint32_t size);
 
+    /**
+     * @brief Get the maximum number of memory transfer chunks in flight
+     *
+     * `memory` clients split transfers larger than the memory max transfer
+     * size into chunks. Up to this number of chunk requests are sent before
+     * waiting for a response, so large transfers are not limited by the round
+     * trip time of the connection. Default is 4.
+     *
+     * @return uint32_t The max number of chunk requests in flight
+     */
+    uint32_t GetMemoryMaxTransferWindow();
+
+    /**
+     * @brief Set the maximum number of memory transfer chunks in flight
+     *
+     * See GetMemoryMaxTransferWindow(). A window of 1 sends one chunk
+     * at a time.
+     *
+     * @param window The max number of chunk requests in flight. Must be at least 1.
+     */
+    void SetMemoryMaxTransferWindow(uint32_t window);
+
   protected:
     /** @internal @brief endpoints storage*/
     RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Endpoint> > endpoints;
@@ -890,6 +918,11 @@ class ROBOTRACONTEUR_CORE_API RobotRaconteurNode : boost::noncopyable,
     /** @internal @brief transports storage mutex */
     boost::shared_mutex transports_lock;
 
+    /** @internal @brief lock-free read copy of endpoints, updated under endpoint_lock */
+    RR_SHARED_PTR<detail::NodeRoutingTable<Endpoint> > endpoint_routes;
+    /** @internal @brief lock-free read copy of transports, updated under transports_lock */
+    RR_SHARED_PTR<detail::NodeRoutingTable<Transport> > transport_routes;
+
     /** @internal @brief dynamic_factory for wrappers*/
     RR_SHARED_PTR<RobotRaconteur::DynamicServiceFactory> dynamic_factory;
     /** @internal @brief dynamic_factory mutex */
@@ -2553,6 +2586,9 @@ class ROBOTRACONTEUR_CORE_API RobotRaconteurNode : boost::noncopyable,
   protected:
     boost::shared_mutex tap_lock;
     RR_SHARED_PTR<MessageTap> tap;
+    boost::atomic<bool> tap_active;
+
+    void RecordMessageTap(const RR_INTRUSIVE_PTR<Message>& m);
 
   public:
     /**
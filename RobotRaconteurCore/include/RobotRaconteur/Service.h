@@ -50,6 +50,25 @@ class ROBOTRACONTEUR_CORE_API GeneratorServerBase;
 
 class ROBOTRACONTEUR_CORE_API IRobotRaconteurMonitorObject;
 
+namespace detail
+{
+// FNV-1a hash of a member name. Generated skeletons switch on this hash to dispatch requests
+// by MemberName. RobotRaconteurGen computes the case labels with this function, so the
+// hash must not change.
+inline uint32_t MemberNameHash(boost::string_ref name)
+{
+    uint32_t h = 2166136261U;
+    for (boost::string_ref::const_iterator c = name.begin(); c != name.end(); ++c)
+    {
+        h ^= static_cast<uint8_t>(*c);
+        h *= 16777619U;
+    }
+    return h;
+}
+
+inline uint32_t MemberNameHash(const MessageStringPtr& name) { return MemberNameHash(name.str()); }
+} // namespace detail
+
 /**
  * @brief Interface for service objects to receive service notifications
  *
@@ -207,6 +226,28 @@ class ROBOTRACONTEUR_CORE_API ServiceSkel : public RR_ENABLE_SHARED_FROM_THIS<Se
 
 class ROBOTRACONTEUR_CORE_API UserAuthenticator;
 
+/**
+ * @brief Event delivery statistics for a client connected to a service
+ *
+ * Returned by ServerContext::GetEventStatistics()
+ *
+ */
+struct ROBOTRACONTEUR_CORE_API ServerContextEventStatistics
+{
+    /** @brief The local endpoint of the client */
+    uint32_t LocalEndpoint;
+    /** @brief The number of events passed to the transport */
+    uint64_t SentCount;
+    /** @brief The number of events that failed to send or were not accepted by the transport */
+    uint64_t DroppedCount;
+    /** @brief The number of events passed to the transport that have not completed sending */
+    uint32_t QueuedCount;
+    /** @brief The maximum value of QueuedCount */
+    uint32_t MaxQueuedCount;
+
+    ServerContextEventStatistics();
+};
+
 /**
  * @brief Context for services registered in a node for use by clients
  *
@@ -340,6 +381,8 @@ class ROBOTRACONTEUR_CORE_API ServerContext : public RR_ENABLE_SHARED_FROM_THIS<
 
     RR_UNORDERED_MAP<MessageStringPtr, RR_SHARED_PTR<ServiceSkel> > skels;
     boost::mutex skels_lock;
+    // Lock-free read copy of skels used by GetObjectSkel, republished under skels_lock
+    RR_SHARED_PTR<detail::NodeRoutingTable<ServiceSkel, MessageStringPtr> > skel_routes;
 
     RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ServerEndpoint> > client_endpoints;
     boost::mutex client_endpoints_lock;
@@ -453,6 +496,8 @@ class ROBOTRACONTEUR_CORE_API ServerContext : public RR_ENABLE_SHARED_FROM_THIS<
   private:
     static boost::thread_specific_ptr<std::string> m_CurrentServicePath;
 
+    void DispatchPacketEntry(const RR_INTRUSIVE_PTR<MessageEntry>& m, const RR_SHARED_PTR<ServerEndpoint>& c);
+
   public:
     virtual RR_INTRUSIVE_PTR<MessageEntry> ProcessMessageEntry(const RR_INTRUSIVE_PTR<MessageEntry>& m,
                                                                const RR_SHARED_PTR<ServerEndpoint>& c);
@@ -465,6 +510,26 @@ class ROBOTRACONTEUR_CORE_API ServerContext : public RR_ENABLE_SHARED_FROM_THIS<
 
     virtual void RemoveClient(const RR_SHARED_PTR<ServerEndpoint>& cendpoint);
 
+    /**
+     * @brief Get the event delivery statistics of the connected clients
+     *
+     * Events are sent to all connected clients by SendEvent(). The statistics are
+     * tracked for each client, and are removed when the client disconnects.
+     *
+     * @return std::vector<ServerContextEventStatistics> The statistics for each client
+     */
+    std::vector<ServerContextEventStatistics> GetEventStatistics();
+
+  protected:
+    static void EndSendEvent(RR_WEAK_PTR<ServerContext> context, uint32_t endpoint,
+                             const RR_SHARED_PTR<RobotRaconteurException>& err);
+
+    void UpdateEventStatistics(uint32_t endpoint, bool sent, bool completed, bool dropped);
+
+    RR_UNORDERED_MAP<uint32_t, ServerContextEventStatistics> event_statistics;
+    boost::mutex event_statistics_lock;
+
+  public:
     /**
      * @brief Kicks a user with the specified username
      *
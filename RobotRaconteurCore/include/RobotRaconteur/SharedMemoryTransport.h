@@ -0,0 +1,263 @@
+/**
+ * @file SharedMemoryTransport.h
+ *
+ * @author John Wason, PhD
+ *
+ * @copyright Copyright 2011-2020 Wason Technology, LLC
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * @par
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RobotRaconteur/RobotRaconteurNode.h"
+
+#pragma once
+
+namespace RobotRaconteur
+{
+class ROBOTRACONTEUR_CORE_API SharedMemoryTransportConnection;
+
+namespace detail
+{
+class SharedMemoryTransportFDs;
+class SharedMemoryTransport_socket;
+class SharedMemoryTransport_acceptor;
+} // namespace detail
+
+/**
+ * @brief Transport for communication between processes using shared memory
+ *
+ * See \ref robotraconteur_url for more information on URLs.
+ *
+ * The SharedMemoryTransport implements transport connections between processes running on
+ * the same host using memory mapped files. Each connection has a ring buffer for each
+ * direction. Messages are serialized directly into the ring buffer of the sender and
+ * parsed by the receiver without passing through the kernel. Numeric arrays larger than
+ * the shared array threshold are copied once into a separate shared segment, and the receiver
+ * maps the segment and uses it as the storage of the received array. This avoids copying
+ * large payloads such as images and point clouds through the ring buffer.
+ *
+ * A UNIX domain socket is used to set up each connection, and to wake the peer when data
+ * is written to an empty ring buffer or space is freed in a full ring buffer. The socket is
+ * also used to detect if the peer process exits. The socket and node information files are
+ * stored in the `transport/shm` directory of the user run directory, using the same layout
+ * as the LocalTransport. Only nodes running as the same user can be connected.
+ *
+ * URLs use the `rr+shm` scheme, and must specify the NodeID and/or NodeName of the
+ * target node. For example, `rr+shm:///?nodename=my_node&service=my_service`.
+ *
+ * The SharedMemoryTransport is not available on Windows. IsSharedMemoryTransportSupported()
+ * can be used to check if the transport is available.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API SharedMemoryTransport : public Transport,
+                                                      public RR_ENABLE_SHARED_FROM_THIS<SharedMemoryTransport>
+{
+    friend class SharedMemoryTransportConnection;
+
+  private:
+    bool transportopen;
+    bool is_server;
+
+  public:
+    RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> > TransportConnections;
+    boost::mutex TransportConnections_lock;
+
+    /**
+     * @brief Construct a new SharedMemoryTransport
+     *
+     * Must use boost::make_shared<SharedMemoryTransport>()
+     *
+     * The transport must be registered with the node using
+     * RobotRaconteurNode::RegisterTransport() after construction.
+     *
+     * @param node The node that will use the transport. Default is the singleton node
+     */
+    SharedMemoryTransport(const RR_SHARED_PTR<RobotRaconteurNode>& node = RobotRaconteurNode::sp());
+
+    RR_OVIRTUAL ~SharedMemoryTransport() RR_OVERRIDE;
+
+    RR_OVIRTUAL bool IsServer() const RR_OVERRIDE;
+
+    RR_OVIRTUAL bool IsClient() const RR_OVERRIDE;
+
+    RR_OVIRTUAL std::string GetUrlSchemeString() const RR_OVERRIDE;
+
+    RR_OVIRTUAL std::vector<std::string> GetServerListenUrls() RR_OVERRIDE;
+
+    RR_OVIRTUAL void SendMessage(const RR_INTRUSIVE_PTR<Message>& m) RR_OVERRIDE;
+
+    RR_OVIRTUAL void AsyncSendMessage(
+        const RR_INTRUSIVE_PTR<Message>& m,
+        const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler) RR_OVERRIDE;
+
+    RR_OVIRTUAL void AsyncCreateTransportConnection(
+        boost::string_ref url, const RR_SHARED_PTR<Endpoint>& e,
+        boost::function<void(const RR_SHARED_PTR<ITransportConnection>&,
+                             const RR_SHARED_PTR<RobotRaconteurException>&)>& handler) RR_OVERRIDE;
+
+    RR_OVIRTUAL RR_SHARED_PTR<ITransportConnection> CreateTransportConnection(
+        boost::string_ref url, const RR_SHARED_PTR<Endpoint>& e) RR_OVERRIDE;
+
+    RR_OVIRTUAL void CloseTransportConnection(const RR_SHARED_PTR<Endpoint>& e) RR_OVERRIDE;
+
+    /**
+     * @brief Start the server to listen for incoming client connections
+     *
+     * The NodeID of the node must be set before calling StartServer(). The
+     * LocalTransport or a node setup class is normally used to assign the NodeID
+     * and NodeName.
+     *
+     */
+    virtual void StartServer();
+
+    /**
+     * @brief Check if the SharedMemoryTransport is supported on the current operating system
+     *
+     * @return true The transport is supported
+     * @return false The transport is not supported
+     */
+    static bool IsSharedMemoryTransportSupported();
+
+    /**
+     * @brief Get the size of the ring buffers for new connections
+     *
+     * See SetRingBufferSize()
+     *
+     * Default: 4 MB
+     *
+     * @return size_t The size of each ring buffer in bytes
+     */
+    virtual size_t GetRingBufferSize();
+
+    /**
+     * @brief Set the size of the ring buffers for new connections
+     *
+     * Each connection has two ring buffers, one for each direction. The size is
+     * selected by the client when the connection is created. Messages larger than
+     * half of the ring buffer are passed in a separate shared segment.
+     *
+     * Must be between 64 KB and 1 GB. Rounded up to a multiple of 8 bytes.
+     *
+     * Default: 4 MB
+     *
+     * @param size The size of each ring buffer in bytes
+     */
+    virtual void SetRingBufferSize(size_t size);
+
+    /**
+     * @brief Get the size above which numeric arrays are passed in shared segments
+     *
+     * See SetSharedArrayThreshold()
+     *
+     * Default: 64 KB
+     *
+     * @return size_t The threshold in bytes
+     */
+    virtual size_t GetSharedArrayThreshold();
+
+    /**
+     * @brief Set the size above which numeric arrays are passed in shared segments
+     *
+     * Numeric arrays in sent messages with a size in bytes greater than or equal to the threshold
+     * are copied into a shared segment instead of being serialized into the ring buffer. The
+     * receiver uses the mapped segment as the storage of the array. Set to zero to
+     * serialize all arrays into the ring buffer.
+     *
+     * Default: 64 KB
+     *
+     * @param threshold The threshold in bytes
+     */
+    virtual void SetSharedArrayThreshold(size_t threshold);
+
+  protected:
+    virtual void CloseTransportConnection_timed(const boost::system::error_code& err, const RR_SHARED_PTR<Endpoint>& e,
+                                                const RR_SHARED_PTR<void>& timer);
+
+    void AsyncCreateTransportConnection2(
+        const RR_SHARED_PTR<SharedMemoryTransportConnection>& connection,
+        const RR_SHARED_PTR<RobotRaconteurException>& err,
+        const boost::function<void(const RR_SHARED_PTR<ITransportConnection>&,
+                                   const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+  public:
+    RR_OVIRTUAL bool CanConnectService(boost::string_ref url) RR_OVERRIDE;
+
+    RR_OVIRTUAL void Close() RR_OVERRIDE;
+
+    RR_OVIRTUAL void CheckConnection(uint32_t endpoint) RR_OVERRIDE;
+
+    RR_OVIRTUAL void PeriodicCleanupTask() RR_OVERRIDE;
+
+    RR_OVIRTUAL uint32_t TransportCapability(boost::string_ref name) RR_OVERRIDE;
+
+    RR_OVIRTUAL void MessageReceived(const RR_INTRUSIVE_PTR<Message>& m) RR_OVERRIDE;
+
+    RR_OVIRTUAL void AsyncGetDetectedNodes(
+        const std::vector<std::string>& schemes,
+        const boost::function<void(const RR_SHARED_PTR<std::vector<NodeDiscoveryInfo> >&)>& handler,
+        int32_t timeout = RR_TIMEOUT_INFINITE) RR_OVERRIDE;
+
+    RR_OVIRTUAL void LocalNodeServicesChanged() RR_OVERRIDE;
+
+    template <typename T, typename F>
+    boost::signals2::connection AddCloseListener(const RR_SHARED_PTR<T>& t, const F& f)
+    {
+        boost::mutex::scoped_lock lock(closed_lock);
+        if (closed)
+        {
+            lock.unlock();
+            boost::bind(f, t)();
+            return boost::signals2::connection();
+        }
+
+        return close_signal.connect(boost::signals2::signal<void()>::slot_type(boost::bind(f, t.get())).track(t));
+    }
+
+  protected:
+    virtual void register_transport(const RR_SHARED_PTR<ITransportConnection>& connection);
+    virtual void erase_transport(const RR_SHARED_PTR<ITransportConnection>& connection);
+
+    static void handle_accept(const RR_SHARED_PTR<SharedMemoryTransport>& parent,
+                              const RR_SHARED_PTR<detail::SharedMemoryTransport_acceptor>& acceptor,
+                              const RR_SHARED_PTR<detail::SharedMemoryTransport_socket>& socket,
+                              const boost::system::error_code& error);
+
+    void handle_accept2(const RR_SHARED_PTR<SharedMemoryTransportConnection>& connection,
+                        const RR_SHARED_PTR<RobotRaconteurException>& err);
+
+    RR_SHARED_PTR<detail::SharedMemoryTransport_acceptor> acceptor;
+    boost::mutex acceptor_lock;
+
+    RR_SHARED_PTR<detail::SharedMemoryTransportFDs> fds;
+    boost::mutex fds_lock;
+
+    std::string socket_file_name;
+
+    boost::mutex parameter_lock;
+    size_t ring_buffer_size;
+    size_t shared_array_threshold;
+
+    bool closed;
+    boost::mutex closed_lock;
+    boost::signals2::signal<void()> close_signal;
+};
+
+#ifndef ROBOTRACONTEUR_NO_CXX11_TEMPLATE_ALIASES
+/** @brief Convenience alias for SharedMemoryTransport shared_ptr */
+using SharedMemoryTransportPtr = RR_SHARED_PTR<SharedMemoryTransport>;
+#endif
+
+} // namespace RobotRaconteur
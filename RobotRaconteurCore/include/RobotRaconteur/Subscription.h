@@ -1385,6 +1385,33 @@ class ROBOTRACONTEUR_CORE_API PipeSubscriptionBase : public RR_ENABLE_SHARED_FRO
      */
     void SetIgnoreReceived(bool ignore);
 
+    /**
+     * @brief Get the flow control receive window for connected pipe endpoints
+     *
+     * See SetFlowControlWindow()
+     *
+     * @return uint32_t The receive window in packets
+     */
+    uint32_t GetFlowControlWindow();
+
+    /**
+     * @brief Set the flow control receive window for connected pipe endpoints
+     *
+     * See Pipe::SetFlowControlWindow(). The window is applied to pipe endpoints connected
+     * after the call, so it should normally be set immediately after the subscription is
+     * created. Each service may have at most this many packets in flight to the subscription.
+     * Credits are returned to the service as packets are moved into the receive queue of the
+     * subscription. Use with the max_recv_packets parameter of ServiceSubscription::SubscribePipe()
+     * to bound memory use when the services produce packets faster than they are received.
+     *
+     * Packets sent with AsyncSendPacketAll() are not sent to services that have a full send window.
+     *
+     * Default: 0 (disabled)
+     *
+     * @param window The receive window in packets
+     */
+    void SetFlowControlWindow(uint32_t window);
+
     void AsyncSendPacketAllBase(const RR_INTRUSIVE_PTR<RRValue>& packet);
 
     /**
@@ -1427,6 +1454,8 @@ class ROBOTRACONTEUR_CORE_API PipeSubscriptionBase : public RR_ENABLE_SHARED_FRO
 
     boost::initialized<int32_t> max_send_backlog;
 
+    boost::initialized<uint32_t> flow_control_window;
+
     virtual void fire_PipePacketReceived();
     virtual bool isempty_PipePacketReceived();
     RR_SHARED_PTR<detail::async_signal_pool_semaphore> pipe_packet_received_semaphore;
@@ -118,6 +118,103 @@ class ROBOTRACONTEUR_CORE_API LocalMessageTap : public MessageTap
     RR_OVIRTUAL void RecordMessage(const RR_INTRUSIVE_PTR<Message>& message) RR_OVERRIDE;
 };
 
+namespace detail
+{
+class FileRingMessageTapImpl;
+class FileRingMessageTapReaderImpl;
+} // namespace detail
+
+/**
+ * @brief File ring buffer message tap
+ *
+ * The FileRingMessageTap records messages and log records in process to a
+ * ring of preallocated, memory mapped segment files in a directory. Messages
+ * are stored in Message4 format, with a UTC timestamp added to the MetaData
+ * header field. Log records are encoded as messages, the same as
+ * LocalMessageTap. When all segments are full, the oldest segment is
+ * overwritten, so the disk space used by the recording is fixed.
+ *
+ * RecordMessage() and RecordLogRecord() place the message in a bounded
+ * lock-free queue and return immediately. A background thread writes the
+ * queued messages to the segment files. If the queue is full, or a message
+ * is larger than a segment, the message is dropped and counted in
+ * GetDroppedCount().
+ *
+ * Use FileRingMessageTapReader to read the recorded messages.
+ *
+ * See \ref taps for more information on taps.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API FileRingMessageTap : public MessageTap
+{
+    RR_SHARED_PTR<detail::FileRingMessageTapImpl> tap_impl;
+
+  public:
+    /**
+     * @brief Construct a new file ring buffer tap
+     *
+     * Must use boost::make_shared<FileRingMessageTap>()
+     *
+     * @param directory The directory to store the segment files. Created if it does not exist.
+     * @param segment_size The size of each segment file in bytes
+     * @param segment_count The number of segment files in the ring
+     * @param queue_capacity The maximum number of messages waiting to be written
+     */
+    FileRingMessageTap(const std::string& directory, size_t segment_size = 16 * 1024 * 1024,
+                       size_t segment_count = 8, size_t queue_capacity = 4096);
+    RR_OVIRTUAL ~FileRingMessageTap() RR_OVERRIDE;
+
+    RR_OVIRTUAL void Open() RR_OVERRIDE;
+    RR_OVIRTUAL void Close() RR_OVERRIDE;
+
+    RR_OVIRTUAL void RecordLogRecord(const RRLogRecord& log_record) RR_OVERRIDE;
+    RR_OVIRTUAL void RecordMessage(const RR_INTRUSIVE_PTR<Message>& message) RR_OVERRIDE;
+
+    /**
+     * @brief Get the number of messages that were dropped
+     *
+     * Messages are dropped if the queue is full or the message
+     * does not fit in a segment
+     *
+     * @return uint64_t The number of dropped messages
+     */
+    uint64_t GetDroppedCount();
+};
+
+/**
+ * @brief Reader for recordings created by FileRingMessageTap
+ *
+ * Reads the messages stored in the segment files of a FileRingMessageTap
+ * directory, from the oldest to the newest. The reader should be used
+ * after the tap has been closed.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API FileRingMessageTapReader
+{
+    RR_SHARED_PTR<detail::FileRingMessageTapReaderImpl> reader_impl;
+
+  public:
+    /**
+     * @brief Construct a new reader and open the recording
+     *
+     * @param directory The directory containing the segment files
+     */
+    FileRingMessageTapReader(const std::string& directory);
+
+    /**
+     * @brief Read the next message in the recording
+     *
+     * @return RR_INTRUSIVE_PTR<Message> The next message, or null if the end of the recording is reached
+     */
+    RR_INTRUSIVE_PTR<Message> ReadNextMessage();
+
+    /**
+     * @brief Return to the first message in the recording
+     *
+     */
+    void Reset();
+};
+
 #endif
 
 }; // namespace RobotRaconteur
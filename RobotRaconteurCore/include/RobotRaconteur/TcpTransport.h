@@ -664,6 +664,112 @@ class ROBOTRACONTEUR_CORE_API TcpTransport : public Transport, public RR_ENABLE_
      */
     virtual void SetDisableAsyncMessageIO(bool d);
 
+    /**
+     * @brief Get the maximum size of a batched send
+     *
+     * When messages are waiting in the send queue of a connection, up to
+     * MaxSendBatchCount messages with a combined serialized size of up
+     * to MaxSendBatchSize are written to the socket in a single write.
+     * Batching reduces the number of system calls when many small
+     * wire or pipe packets are sent.
+     *
+     * Default: 64 KB
+     *
+     * @return int32_t The size in bytes
+     */
+    virtual int32_t GetMaxSendBatchSize();
+
+    /**
+     * @brief Set the maximum size of a batched send
+     *
+     * See GetMaxSendBatchSize()
+     *
+     * Default: 64 KB
+     *
+     * @param size The size in bytes
+     */
+    virtual void SetMaxSendBatchSize(int32_t size);
+
+    /**
+     * @brief Get the maximum number of messages in a batched send
+     *
+     * See GetMaxSendBatchSize(). A value of 1 disables batching.
+     *
+     * Default: 1 (batching disabled)
+     *
+     * @return int32_t The maximum number of messages
+     */
+    virtual int32_t GetMaxSendBatchCount();
+
+    /**
+     * @brief Set the maximum number of messages in a batched send
+     *
+     * See GetMaxSendBatchSize(). A value of 1 disables batching.
+     *
+     * Default: 1 (batching disabled)
+     *
+     * @param count The maximum number of messages
+     */
+    virtual void SetMaxSendBatchCount(int32_t count);
+
+    /**
+     * @brief Get the maximum size of a fragmented message
+     *
+     * Messages larger than 1 MB that contain large numeric arrays are sent as a header
+     * message followed by fragments of the arrays, if both nodes support fragmented
+     * messages. The fragments are read directly from the source arrays and copied into the
+     * destination arrays as they are received, so neither side buffers the whole
+     * serialized message. Fragmented messages are not limited by MaxMessageSize, but are
+     * limited by MaxFragmentedMessageSize. Other messages are sent between the fragments,
+     * so a large transfer does not block other traffic on the connection.
+     *
+     * A value of 0 disables fragmented messages. Connections use the value that is set
+     * when the connection is created.
+     *
+     * Default: 1 GB
+     *
+     * @return int32_t The size in bytes
+     */
+    virtual int32_t GetMaxFragmentedMessageSize();
+
+    /**
+     * @brief Set the maximum size of a fragmented message
+     *
+     * See GetMaxFragmentedMessageSize()
+     *
+     * Default: 1 GB
+     *
+     * @param size The size in bytes, or 0 to disable fragmented messages
+     */
+    virtual void SetMaxFragmentedMessageSize(int32_t size);
+
+    /**
+     * @brief Get the allocator used for received array storage
+     *
+     * When async message io is enabled, numeric array payloads of received
+     * messages are read from the socket directly into the storage of the
+     * RRArray that is passed to the user, without first copying
+     * the data into the connection receive buffer. The storage is obtained
+     * from this allocator. A user allocator can be used to place received
+     * arrays into pooled, pinned, or externally owned memory.
+     *
+     * Connections use the allocator that is set when the connection is created.
+     *
+     * Default: null (RRArrayBufferPool::GetDefault() is used)
+     *
+     * @return RR_SHARED_PTR<RRArrayAllocator> The allocator, or null if the default is used
+     */
+    virtual RR_SHARED_PTR<RRArrayAllocator> GetReceiveArrayAllocator();
+
+    /**
+     * @brief Set the allocator used for received array storage
+     *
+     * See GetReceiveArrayAllocator()
+     *
+     * @param allocator The allocator, or null to use the default buffer pool
+     */
+    virtual void SetReceiveArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator);
+
     template <typename T, typename F>
     boost::signals2::connection AddCloseListener(const RR_SHARED_PTR<T>& t, const F& f)
     {
@@ -705,6 +811,10 @@ class ROBOTRACONTEUR_CORE_API TcpTransport : public Transport, public RR_ENABLE_
     bool disable_message4;
     bool disable_string_table;
     bool disable_async_message_io;
+    int32_t max_send_batch_size;
+    int32_t max_send_batch_count;
+    int32_t max_fragmented_message_size;
+    RR_SHARED_PTR<RRArrayAllocator> receive_array_allocator;
 
     boost::shared_ptr<void> GetTlsContext();
 
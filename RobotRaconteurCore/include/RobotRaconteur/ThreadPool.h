@@ -23,6 +23,7 @@
 
 #include <boost/bind/placeholders.hpp>
 #include "RobotRaconteur/DataTypes.h"
+#include <boost/atomic.hpp>
 
 #ifndef ROBOTRACONTEUR_EMSCRIPTEN
 #include <boost/asio.hpp>
@@ -143,6 +144,17 @@ class ROBOTRACONTEUR_CORE_API ThreadPool : public RR_ENABLE_SHARED_FROM_THIS<Thr
      */
     virtual RR_BOOST_ASIO_IO_CONTEXT& get_io_context();
 
+    /**
+     * @brief Get the boost::asio::io_context object to use for a new connection
+     *
+     * Transports use the returned io_context for the sockets of new connections.
+     * Sharded thread pools use this to distribute connections over their shards.
+     * The default implementation returns get_io_context().
+     *
+     * @return boost::asio::io_context&
+     */
+    virtual RR_BOOST_ASIO_IO_CONTEXT& get_next_io_context();
+
   protected:
     virtual void start_new_thread();
 
@@ -231,6 +243,133 @@ class ROBOTRACONTEUR_CORE_API IOContextThreadPool : public ThreadPool
     RR_OVIRTUAL RR_BOOST_ASIO_IO_CONTEXT& get_io_context() RR_OVERRIDE;
 };
 
+namespace detail
+{
+class ShardedThreadPool_shard;
+}
+
+/**
+ * @brief Thread pool with a separate io_context for each shard
+ *
+ * The ShardedThreadPool divides its threads between a fixed number of shards. Each
+ * shard has its own boost::asio::io_context. New transport connections are assigned
+ * to shards in round-robin order using get_next_io_context(). Once assigned, the receive,
+ * dispatch, and send handlers of a connection run on the threads of its shard.
+ *
+ * When called from a shard thread, get_io_context() and Post() use the shard of the
+ * calling thread. Otherwise, shards are selected in round-robin order. Functions
+ * passed to Post() are queued on the shard. If the queue has a backlog, an idle
+ * neighboring shard may steal the function.
+ *
+ * Optionally, the threads of each shard can be pinned to a CPU core. Shard `i` is pinned
+ * to core `i % boost::thread::hardware_concurrency()`. CPU affinity is supported on
+ * Linux and Windows.
+ *
+ * Use ShardedThreadPoolFactory with RobotRaconteurNode::SetThreadPoolFactory(), or
+ * the `--robotraconteur-thread-pool-shards` node setup option.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API ShardedThreadPool : public ThreadPool
+{
+
+  protected:
+    std::vector<RR_SHARED_PTR<detail::ShardedThreadPool_shard> > shards;
+    boost::atomic<uint32_t> next_shard;
+    bool cpu_affinity;
+    size_t started_thread_count;
+
+  public:
+    /**
+     * @brief Construct a new ShardedThreadPool
+     *
+     * Must use boost::make_shared<ShardedThreadPool>()
+     *
+     * @param node The node that owns the thread pool
+     * @param shard_count The number of shards. Must be greater than zero.
+     * @param cpu_affinity If true, pin the threads of each shard to a CPU core
+     */
+    ShardedThreadPool(const RR_SHARED_PTR<RobotRaconteurNode>& node, size_t shard_count, bool cpu_affinity = false);
+    RR_OVIRTUAL ~ShardedThreadPool() RR_OVERRIDE;
+
+    /**
+     * @brief Get the number of shards
+     *
+     * @return size_t
+     */
+    size_t GetShardCount();
+
+    /**
+     * @brief Get if the shard threads are pinned to CPU cores
+     *
+     * @return true Shard threads are pinned to CPU cores
+     * @return false Shard threads are not pinned
+     */
+    bool GetCPUAffinity();
+
+    RR_OVIRTUAL size_t GetThreadPoolCount() RR_OVERRIDE;
+
+    /**
+     * @brief Set the desired number of threads in the thread pool
+     *
+     * Threads are divided between the shards. Each shard has at least one thread.
+     * As with ThreadPool, the number of threads cannot be decreased.
+     *
+     * @param count The desired number of threads
+     */
+    RR_OVIRTUAL void SetThreadPoolCount(size_t count) RR_OVERRIDE;
+
+    RR_OVIRTUAL void Post(boost::function<void()> function) RR_OVERRIDE;
+
+    RR_OVIRTUAL bool TryPost(boost::function<void()> function) RR_OVERRIDE;
+
+    RR_OVIRTUAL void Shutdown() RR_OVERRIDE;
+
+    RR_OVIRTUAL RR_BOOST_ASIO_IO_CONTEXT& get_io_context() RR_OVERRIDE;
+
+    RR_OVIRTUAL RR_BOOST_ASIO_IO_CONTEXT& get_next_io_context() RR_OVERRIDE;
+
+  protected:
+    RR_SHARED_PTR<detail::ShardedThreadPool_shard> get_current_shard();
+
+    RR_SHARED_PTR<detail::ShardedThreadPool_shard> get_next_shard();
+
+    void post_to_shard(const RR_SHARED_PTR<detail::ShardedThreadPool_shard>& shard,
+                       boost::function<void()> function);
+
+    static void run_shard_task(const RR_SHARED_PTR<detail::ShardedThreadPool_shard>& shard,
+                               const RR_WEAK_PTR<RobotRaconteurNode>& node);
+
+    void shard_thread_function(const RR_SHARED_PTR<detail::ShardedThreadPool_shard>& shard);
+};
+
+/**
+ * @brief ThreadPoolFactory that creates ShardedThreadPool
+ *
+ * Use ShardedThreadPoolFactory with RobotRaconteurNode::SetThreadPoolFactory()
+ * to configure a sharded thread pool. Must be done before RobotRaconteurNode::Init()
+ * is called.
+ *
+ */
+class ROBOTRACONTEUR_CORE_API ShardedThreadPoolFactory : public ThreadPoolFactory
+{
+  protected:
+    size_t shard_count;
+    bool cpu_affinity;
+
+  public:
+    /**
+     * @brief Construct a new ShardedThreadPoolFactory
+     *
+     * @param shard_count The number of shards. Must be greater than zero.
+     * @param cpu_affinity If true, pin the threads of each shard to a CPU core
+     */
+    ShardedThreadPoolFactory(size_t shard_count, bool cpu_affinity = false);
+
+    RR_OVIRTUAL RR_SHARED_PTR<ThreadPool> NewThreadPool(const RR_SHARED_PTR<RobotRaconteurNode>& node) RR_OVERRIDE;
+
+    RR_OVIRTUAL ~ShardedThreadPoolFactory() RR_OVERRIDE;
+};
+
 namespace detail
 {
 ROBOTRACONTEUR_CORE_API bool ThreadPool_IsNodeMultithreaded(RR_WEAK_PTR<RobotRaconteurNode> node);
@@ -139,6 +139,13 @@ class ROBOTRACONTEUR_CORE_API Transport : public IPeriodicCleanupTask, boost::no
 
     static RR_SHARED_PTR<ITransportConnection> GetCurrentThreadTransport();
 
+    // Set the connection URL and transport connection for the current thread. The thread specific
+    // storage is allocated once per thread and reused for each message.
+    static void SetCurrentThreadTransportContext(boost::string_ref url,
+                                                 const RR_SHARED_PTR<ITransportConnection>& connection);
+
+    static void ClearCurrentThreadTransportContext();
+
     uint32_t TransportID;
 
     virtual void CheckConnection(uint32_t endpoint) = 0;
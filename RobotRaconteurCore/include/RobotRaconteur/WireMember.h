@@ -294,6 +294,8 @@ class ROBOTRACONTEUR_CORE_API WireConnectionBase : public RR_ENABLE_SHARED_FROM_
 
     void SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value);
 
+    void SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value, const RR_INTRUSIVE_PTR<MessageElement>& packet);
+
     bool TryGetInValueBase(RR_INTRUSIVE_PTR<RRValue>& value, TimeSpec& time);
     bool TryGetOutValueBase(RR_INTRUSIVE_PTR<RRValue>& value, TimeSpec& time);
 
@@ -550,6 +552,7 @@ class ROBOTRACONTEUR_CORE_API WireBase : public RR_ENABLE_SHARED_FROM_THIS<WireB
 
   public:
     friend class WireConnectionBase;
+    friend class WireBroadcasterBase;
 
     virtual ~WireBase() {}
 
@@ -575,6 +578,9 @@ class ROBOTRACONTEUR_CORE_API WireBase : public RR_ENABLE_SHARED_FROM_THIS<WireB
 
     virtual void SendWirePacket(const RR_INTRUSIVE_PTR<RRValue>& data, TimeSpec time, uint32_t endpoint) = 0;
 
+    virtual void SendWirePacketElement(const RR_INTRUSIVE_PTR<MessageElement>& packet, TimeSpec time,
+                                       uint32_t endpoint) = 0;
+
     bool rawelements;
 
     void DispatchPacket(const RR_INTRUSIVE_PTR<MessageEntry>& me, const RR_SHARED_PTR<WireConnectionBase>& e);
@@ -583,6 +589,10 @@ class ROBOTRACONTEUR_CORE_API WireBase : public RR_ENABLE_SHARED_FROM_THIS<WireB
 
     RR_INTRUSIVE_PTR<MessageEntry> PackPacket(const RR_INTRUSIVE_PTR<RRValue>& data, TimeSpec time);
 
+    RR_INTRUSIVE_PTR<MessageElement> PackPacketElement(const RR_INTRUSIVE_PTR<RRValue>& data);
+
+    RR_INTRUSIVE_PTR<MessageEntry> PackPacketEntry(const RR_INTRUSIVE_PTR<MessageElement>& packet, TimeSpec time);
+
     virtual RR_INTRUSIVE_PTR<MessageElementData> PackData(const RR_INTRUSIVE_PTR<RRValue>& data)
     {
         return GetNode()->PackVarType(data);
@@ -990,6 +1000,9 @@ class ROBOTRACONTEUR_CORE_API WireClientBase : public virtual WireBase
     RR_OVIRTUAL void SendWirePacket(const RR_INTRUSIVE_PTR<RRValue>& packet, TimeSpec time,
                                     uint32_t endpoint) RR_OVERRIDE;
 
+    RR_OVIRTUAL void SendWirePacketElement(const RR_INTRUSIVE_PTR<MessageElement>& packet, TimeSpec time,
+                                           uint32_t endpoint) RR_OVERRIDE;
+
     std::string m_MemberName;
     std::string service_path;
     uint32_t endpoint;
@@ -1234,6 +1247,9 @@ class ROBOTRACONTEUR_CORE_API WireServerBase : public virtual WireBase
     RR_OVIRTUAL void SendWirePacket(const RR_INTRUSIVE_PTR<RRValue>& packet, TimeSpec time,
                                     uint32_t endpoint) RR_OVERRIDE;
 
+    RR_OVIRTUAL void SendWirePacketElement(const RR_INTRUSIVE_PTR<MessageElement>& packet, TimeSpec time,
+                                           uint32_t endpoint) RR_OVERRIDE;
+
     std::string m_MemberName;
     std::string service_path;
 
@@ -47,6 +47,10 @@ ASIOStreamBaseTransport::ASIOStreamBaseTransport(const RR_SHARED_PTR<RobotRacont
     : _io_context(node->GetThreadPool()->get_io_context()), connected(true) RR_MEMBER_ARRAY_INIT(streammagic),
       send_version4(false), use_string_table4(false)
 {
+    send_queue_wire_coalesced_count.store(0);
+    send_queue_connection_test_dropped_count.store(0);
+    send_queue_preempted_count.store(0);
+    send_queue_size = 0;
 
     send_message_size = 0;
     recv_message_size = 0;
@@ -93,6 +97,9 @@ ASIOStreamBaseTransport::ASIOStreamBaseTransport(const RR_SHARED_PTR<RobotRacont
     disable_string_table = false;
     disable_async_io = false;
 
+    max_send_batch_size = 0;
+    max_send_batch_count = 1;
+
     async_reader = AsyncMessageReader::CreateInstance();
 
     async_recv_size = 0;
@@ -106,6 +113,13 @@ ASIOStreamBaseTransport::ASIOStreamBaseTransport(const RR_SHARED_PTR<RobotRacont
     active_capabilities_message2_basic = 0;
     active_capabilities_message4_basic = 0;
     active_capabilities_message4_stringtable = 0;
+    active_capabilities_message4_fragment = 0;
+
+    max_fragmented_message_size = 1024 * 1024 * 1024;
+    fragment_size = 256 * 1024;
+    fragment_message_threshold = 1024 * 1024;
+    send_fragment_id = 0;
+    recv_fragments_size = 0;
 }
 
 void ASIOStreamBaseTransport::AsyncAttachStream(
@@ -241,6 +255,61 @@ void ASIOStreamBaseTransport::AsyncAttachStream1(
     }
 }
 
+// Fragments of a large array point into the source array, which is kept alive until all
+// fragments have been sent
+class ASIOStreamBaseTransport_fragment_view : public RRArrayAllocator
+{
+  public:
+    ASIOStreamBaseTransport_fragment_view(const RR_INTRUSIVE_PTR<RRBaseArray>& source) : source(source) {}
+
+    RR_OVIRTUAL void* Allocate(size_t) RR_OVERRIDE
+    {
+        throw InvalidOperationException("Fragment view cannot allocate storage");
+    }
+
+    RR_OVIRTUAL void Release(void*, size_t) RR_OVERRIDE {}
+
+  protected:
+    RR_INTRUSIVE_PTR<RRBaseArray> source;
+};
+
+// Completes the send of a fragmented message after the last fragment is written, or on the first error
+class ASIOStreamBaseTransport_fragment_send_state
+{
+  public:
+    ASIOStreamBaseTransport_fragment_send_state(
+        const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback, size_t count)
+        : callback(callback), remaining(count)
+    {}
+
+    void EndSend(RR_WEAK_PTR<RobotRaconteurNode> node, const RR_SHARED_PTR<RobotRaconteurException>& err)
+    {
+        boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h;
+        {
+            boost::mutex::scoped_lock lock(this_lock);
+            if (!callback)
+                return;
+            if (!err && --remaining > 0)
+                return;
+            h.swap(callback);
+        }
+
+        if (err)
+        {
+            detail::InvokeHandlerWithException(node, h, err);
+        }
+        else
+        {
+            detail::InvokeHandler(node, h);
+        }
+    }
+
+  protected:
+    boost::mutex this_lock;
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> callback;
+    size_t remaining;
+};
+
 void ASIOStreamBaseTransport::AsyncSendMessage(
     const RR_INTRUSIVE_PTR<Message>& m,
     const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback)
@@ -260,20 +329,7 @@ void ASIOStreamBaseTransport::AsyncSendMessage(
     // m->header->MessageFlags &= ~(MessageFlags_SUBSTREAM_SEQUENCE_NUMBER | MessageFlags_TRANSPORT_SPECIFIC);
     // End clear flags
 
-    bool send_4 = send_version4.load();
-
-    // TODO: find more elegant solution for this
-    if (m->entries.size() == 1)
-    {
-        uint16_t t = m->entries[0]->EntryType;
-        if (t == MessageEntryType_StreamOp || t == MessageEntryType_StreamOpRet)
-        {
-            if (m->entries[0]->MemberName == "CreateConnection")
-            {
-                send_4 = false;
-            }
-        }
-    }
+    bool send_4 = SendMessageVersion4(m);
 
     boost::mutex::scoped_lock lock(send_lock);
 
@@ -287,7 +343,24 @@ void ASIOStreamBaseTransport::AsyncSendMessage(
         message_size = m->ComputeSize4();
     }
 
-    if (boost::numeric_cast<int32_t>(message_size) > (max_message_size - 100))
+    std::vector<RR_INTRUSIVE_PTR<Message> > fragments;
+    if (send_4 && message_size > fragment_message_threshold &&
+        (active_capabilities_message4_fragment & TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE))
+    {
+        FragmentMessage(m, fragments);
+    }
+
+    if (!fragments.empty())
+    {
+        if (message_size > max_fragmented_message_size)
+        {
+            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                               "Attempt to send fragmented message size "
+                                                   << message_size << " when max is " << max_fragmented_message_size);
+            throw ProtocolException("Message larger than maximum fragmented message size");
+        }
+    }
+    else if (message_size > boost::numeric_cast<size_t>(max_message_size - 100))
     {
         ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
                                            "Attempt to send message size " << message_size << " when max is "
@@ -312,6 +385,29 @@ void ASIOStreamBaseTransport::AsyncSendMessage(
         }
     }
 
+    if (!fragments.empty())
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                           "Sending message size " << message_size << " as " << fragments.size()
+                                                                   << " fragment messages");
+        RR_SHARED_PTR<ASIOStreamBaseTransport_fragment_send_state> state =
+            RR_MAKE_SHARED<ASIOStreamBaseTransport_fragment_send_state>(callback, fragments.size());
+        boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+            boost::bind(&ASIOStreamBaseTransport_fragment_send_state::EndSend, state, node, RR_BOOST_PLACEHOLDERS(_1));
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<Message>& f, fragments)
+        {
+            QueueSendMessage(f, h);
+        }
+        return;
+    }
+
+    QueueSendMessage(m, callback);
+}
+
+void ASIOStreamBaseTransport::QueueSendMessage(
+    const RR_INTRUSIVE_PTR<Message>& m,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback)
+{
     if (sending || send_paused)
     {
 
@@ -319,75 +415,487 @@ void ASIOStreamBaseTransport::AsyncSendMessage(
         e.message = m;
         e.callback = callback;
 
-        // Look for older wire and check connection packets and delete
+        // Look for older wire and check connection packets and replace
         // if in queue to prevent packet flooding.
 
-        bool replaced = false;
-
-        for (std::list<message_queue_entry>::iterator ee = send_queue.begin(); ee != send_queue.end();)
+        message_queue_key key = {};
+        if (GetSendQueueKey(m, key))
         {
-            bool remove = false;
-
-            RR_INTRUSIVE_PTR<MessageHeader> h1 = m->header;
-            RR_INTRUSIVE_PTR<MessageHeader> h2 = ee->message->header;
-
-            if (h1->ReceiverNodeName == h2->ReceiverNodeName && h1->SenderNodeName == h2->SenderNodeName &&
-                h1->ReceiverNodeID == h2->ReceiverNodeID && h1->SenderNodeID == h2->SenderNodeID &&
-                h1->SenderEndpoint == h2->SenderEndpoint && h1->ReceiverEndpoint == h2->ReceiverEndpoint)
+            RR_UNORDERED_MAP<message_queue_key, std::list<message_queue_entry>::iterator,
+                             message_queue_key_hash>::iterator ee = send_queue_index.find(key);
+            if (ee != send_queue_index.end())
             {
-                if (ee->message->entries.size() == m->entries.size() && ee->message->entries.size() == 1)
+                if (m->entries[0]->EntryType == MessageEntryType_ConnectionTest)
                 {
-                    if (ee->message->entries.at(0)->EntryType == MessageEntryType_ConnectionTest &&
-                        m->entries.at(0)->EntryType == MessageEntryType_ConnectionTest)
-                        return;
-
-                    if (ee->message->entries.at(0)->EntryType == MessageEntryType_WirePacket &&
-                        m->entries.at(0)->EntryType == MessageEntryType_WirePacket)
-                    {
-                        if (ee->message->entries.at(0)->ServicePath == m->entries.at(0)->ServicePath &&
-                            ee->message->entries.at(0)->MemberName == m->entries.at(0)->MemberName)
-                        {
-                            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
-                                                               "Dropping wire message "
-                                                                   << m->entries.at(0)->ServicePath.str());
-                            remove = true;
-                        }
-                    }
+                    send_queue_connection_test_dropped_count++;
+                    return;
                 }
+
+                ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                                   "Dropping wire message " << m->entries[0]->ServicePath.str());
+
+                std::list<message_queue_entry>::iterator qe = ee->second;
+                send_queue_index.erase(ee);
+                detail::PostHandler(node, qe->callback, true, false);
+                e.indexed = true;
+                *qe = e;
+                send_queue_index.insert(std::make_pair(key, qe));
+                send_queue_wire_coalesced_count++;
+                return;
             }
 
-            if (remove)
+            e.indexed = true;
+        }
+
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(), "Enqueuing message");
+        PushSendQueue(e);
+        if (e.indexed)
+        {
+            send_queue_index.insert(std::make_pair(key, --send_queue[GetSendQueueLane(m)].end()));
+        }
+    }
+    else
+    {
+
+        BeginSendMessage(m, callback);
+    }
+}
+
+bool ASIOStreamBaseTransport::message_queue_key::operator==(const message_queue_key& other) const
+{
+    if (hash != other.hash)
+        return false;
+
+    MessageHeader* h1 = message->header.get();
+    MessageHeader* h2 = other.message->header.get();
+    if (!(h1->SenderEndpoint == h2->SenderEndpoint && h1->ReceiverEndpoint == h2->ReceiverEndpoint &&
+          h1->ReceiverNodeID == h2->ReceiverNodeID && h1->SenderNodeID == h2->SenderNodeID &&
+          h1->ReceiverNodeName == h2->ReceiverNodeName && h1->SenderNodeName == h2->SenderNodeName))
+    {
+        return false;
+    }
+
+    MessageEntry* e1 = message->entries[0].get();
+    MessageEntry* e2 = other.message->entries[0].get();
+    if (e1->EntryType != e2->EntryType)
+        return false;
+    if (e1->EntryType == MessageEntryType_ConnectionTest)
+        return true;
+    return e1->ServicePath == e2->ServicePath && e1->MemberName == e2->MemberName;
+}
+
+bool ASIOStreamBaseTransport::GetSendQueueKey(const RR_INTRUSIVE_PTR<Message>& m, message_queue_key& key)
+{
+    if (m->entries.size() != 1)
+        return false;
+
+    MessageEntry* e = m->entries[0].get();
+    if (e->EntryType != MessageEntryType_WirePacket && e->EntryType != MessageEntryType_ConnectionTest)
+        return false;
+
+    size_t h = 0;
+    boost::hash_combine(h, m->header->SenderEndpoint);
+    boost::hash_combine(h, m->header->ReceiverEndpoint);
+    boost::hash_combine(h, e->EntryType);
+    if (e->EntryType == MessageEntryType_WirePacket)
+    {
+        boost::hash_combine(h, hash_value(e->ServicePath));
+        boost::hash_combine(h, hash_value(e->MemberName));
+    }
+
+    key.message = m.get();
+    key.hash = h;
+    return true;
+}
+
+ASIOStreamBaseTransport::send_queue_lane_type ASIOStreamBaseTransport::GetSendQueueLane(
+    const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if (!m->entries.empty())
+    {
+        switch (m->entries[0]->EntryType)
+        {
+        case MessageEntryType_ClientKeepAliveReq:
+        case MessageEntryType_ClientKeepAliveRet:
+        case MessageEntryType_ConnectionTest:
+        case MessageEntryType_ConnectionTestRet:
+            return send_queue_lane_urgent;
+        case MessageEntryType_WirePacket:
+            return send_queue_lane_high;
+        default:
+            break;
+        }
+    }
+
+    if ((m->header->MessageFlags & MessageFlags_PRIORITY) != 0 && m->header->Priority != 0)
+    {
+        return send_queue_lane_high;
+    }
+
+    return send_queue_lane_normal;
+}
+
+void ASIOStreamBaseTransport::PushSendQueue(const message_queue_entry& e)
+{
+    send_queue[GetSendQueueLane(e.message)].push_back(e);
+    send_queue_size++;
+}
+
+const ASIOStreamBaseTransport::message_queue_entry& ASIOStreamBaseTransport::PeekSendQueue()
+{
+    for (size_t i = 0; i < send_queue.size(); i++)
+    {
+        if (!send_queue[i].empty())
+        {
+            return send_queue[i].front();
+        }
+    }
+    throw InvalidOperationException("Send queue is empty");
+}
+
+ASIOStreamBaseTransport::message_queue_entry ASIOStreamBaseTransport::PopSendQueue()
+{
+    size_t lane = 0;
+    while (send_queue[lane].empty())
+    {
+        lane++;
+    }
+
+    // Count messages that jump ahead of older traffic in a lower priority lane
+    for (size_t i = lane + 1; i < send_queue.size(); i++)
+    {
+        if (!send_queue[i].empty())
+        {
+            send_queue_preempted_count++;
+            break;
+        }
+    }
+
+    message_queue_entry m = send_queue[lane].front();
+    if (m.indexed)
+    {
+        message_queue_key key = {};
+        GetSendQueueKey(m.message, key);
+        send_queue_index.erase(key);
+    }
+    send_queue[lane].pop_front();
+    send_queue_size--;
+    return m;
+}
+
+// Replaces numeric arrays of at least min_size bytes with empty arrays of the same type. Elements are
+// numbered depth first across all entries, and the numbers of the replaced elements are returned
+// with the source arrays. Unchanged elements are shared with the source message.
+static RR_INTRUSIVE_PTR<MessageElement> ASIOStreamBaseTransport_fragment_element(
+    const RR_INTRUSIVE_PTR<MessageElement>& el, size_t min_size, uint32_t& element_count,
+    std::vector<uint32_t>& indexes, std::vector<RR_INTRUSIVE_PTR<RRBaseArray> >& arrays)
+{
+    uint32_t index = element_count++;
+
+    RR_INTRUSIVE_PTR<MessageElementData> data = el->GetData();
+    RR_INTRUSIVE_PTR<MessageElementData> data2;
+
+    if (IsTypeNumeric(el->ElementType))
+    {
+        RR_INTRUSIVE_PTR<RRBaseArray> a = RR_DYNAMIC_POINTER_CAST<RRBaseArray>(data);
+        if (!a || a->size() * a->ElementSize() < min_size)
+        {
+            return el;
+        }
+        indexes.push_back(index);
+        arrays.push_back(a);
+        data2 = AllocateRRArrayByType(a->GetTypeID(), 0);
+    }
+    else
+    {
+        RR_INTRUSIVE_PTR<MessageElementNestedElementList> l =
+            RR_DYNAMIC_POINTER_CAST<MessageElementNestedElementList>(data);
+        if (!l)
+        {
+            return el;
+        }
+
+        bool changed = false;
+        std::vector<RR_INTRUSIVE_PTR<MessageElement> > elements2;
+        elements2.reserve(l->Elements.size());
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageElement>& e, l->Elements)
+        {
+            elements2.push_back(ASIOStreamBaseTransport_fragment_element(e, min_size, element_count, indexes, arrays));
+            changed = changed || elements2.back() != e;
+        }
+        if (!changed)
+        {
+            return el;
+        }
+        data2 = CreateMessageElementNestedElementList(l->Type, l->TypeName, RR_MOVE(elements2));
+    }
+
+    RR_INTRUSIVE_PTR<MessageElement> el2 = CreateMessageElement();
+    el2->ElementFlags = el->ElementFlags;
+    el2->ElementName = el->ElementName;
+    el2->ElementNameCode = el->ElementNameCode;
+    el2->ElementNumber = el->ElementNumber;
+    el2->ElementTypeName = el->ElementTypeName;
+    el2->ElementTypeNameCode = el->ElementTypeNameCode;
+    el2->MetaData = el->MetaData;
+    el2->Extended = el->Extended;
+    el2->SetData(data2);
+    return el2;
+}
+
+// Lists elements in the same depth first order used by ASIOStreamBaseTransport_fragment_element()
+static void ASIOStreamBaseTransport_flatten_elements(const std::vector<RR_INTRUSIVE_PTR<MessageElement> >& elements,
+                                                     std::vector<RR_INTRUSIVE_PTR<MessageElement> >& out)
+{
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageElement>& e, elements)
+    {
+        out.push_back(e);
+        if (IsTypeNumeric(e->ElementType))
+        {
+            continue;
+        }
+        RR_INTRUSIVE_PTR<MessageElementNestedElementList> l =
+            RR_DYNAMIC_POINTER_CAST<MessageElementNestedElementList>(e->GetData());
+        if (l)
+        {
+            ASIOStreamBaseTransport_flatten_elements(l->Elements, out);
+        }
+    }
+}
+
+static void ASIOStreamBaseTransport_copy_routing(const RR_INTRUSIVE_PTR<MessageHeader>& h,
+                                                 const RR_INTRUSIVE_PTR<MessageHeader>& h2)
+{
+    h2->SenderNodeName = h->SenderNodeName;
+    h2->ReceiverNodeName = h->ReceiverNodeName;
+    h2->SenderNodeID = h->SenderNodeID;
+    h2->ReceiverNodeID = h->ReceiverNodeID;
+    h2->SenderEndpoint = h->SenderEndpoint;
+    h2->ReceiverEndpoint = h->ReceiverEndpoint;
+}
+
+bool ASIOStreamBaseTransport::FragmentMessage(const RR_INTRUSIVE_PTR<Message>& m,
+                                              std::vector<RR_INTRUSIVE_PTR<Message> >& fragments)
+{
+    // The first message is a copy of m with the large arrays replaced by empty arrays, and with
+    // a "begin" entry inserted before the original entries that lists the replaced elements. It
+    // is followed by "data" messages that each carry up to fragment_size bytes of one array.
+
+    std::vector<uint32_t> indexes;
+    std::vector<RR_INTRUSIVE_PTR<RRBaseArray> > arrays;
+    uint32_t element_count = 0;
+
+    RR_INTRUSIVE_PTR<Message> m2 = CreateMessage();
+    m2->header = CreateMessageHeader();
+    ASIOStreamBaseTransport_copy_routing(m->header, m2->header);
+    m2->header->MessageFlags = m->header->MessageFlags;
+    m2->header->Priority = m->header->Priority;
+    m2->header->MetaData = m->header->MetaData;
+    m2->header->MessageID = m->header->MessageID;
+    m2->header->MessageResID = m->header->MessageResID;
+    m2->header->Extended = m->header->Extended;
+
+    RR_INTRUSIVE_PTR<MessageEntry> mm = CreateMessageEntry(MessageEntryType_StreamFragment, "begin");
+    m2->entries.push_back(mm);
+
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        RR_INTRUSIVE_PTR<MessageEntry> e2 = CreateMessageEntry(static_cast<MessageEntryType>(e->EntryType), "");
+        e2->EntryFlags = e->EntryFlags;
+        e2->ServicePath = e->ServicePath;
+        e2->ServicePathCode = e->ServicePathCode;
+        e2->MemberName = e->MemberName;
+        e2->MemberNameCode = e->MemberNameCode;
+        e2->RequestID = e->RequestID;
+        e2->Error = e->Error;
+        e2->MetaData = e->MetaData;
+        e2->Extended = e->Extended;
+        e2->elements.reserve(e->elements.size());
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageElement>& el, e->elements)
+        {
+            e2->elements.push_back(
+                ASIOStreamBaseTransport_fragment_element(el, fragment_size / 4, element_count, indexes, arrays));
+        }
+        m2->entries.push_back(e2);
+    }
+
+    if (arrays.empty())
+    {
+        return false;
+    }
+
+    uint32_t id = ++send_fragment_id;
+
+    std::vector<uint32_t> types;
+    std::vector<uint64_t> counts;
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<RRBaseArray>& a, arrays)
+    {
+        types.push_back(a->GetTypeID());
+        counts.push_back(a->size());
+    }
+
+    mm->RequestID = id;
+    mm->AddElement("indexes", VectorToRRArray<uint32_t>(indexes));
+    mm->AddElement("types", VectorToRRArray<uint32_t>(types));
+    mm->AddElement("counts", VectorToRRArray<uint64_t>(counts));
+
+    if (m2->ComputeSize4() > boost::numeric_cast<size_t>(max_message_size - 100))
+    {
+        return false;
+    }
+
+    fragments.push_back(m2);
+
+    for (size_t i = 0; i < arrays.size(); i++)
+    {
+        RR_SHARED_PTR<ASIOStreamBaseTransport_fragment_view> view =
+            RR_MAKE_SHARED<ASIOStreamBaseTransport_fragment_view>(arrays[i]);
+        uint8_t* p = static_cast<uint8_t*>(arrays[i]->void_ptr());
+        size_t len = arrays[i]->size() * arrays[i]->ElementSize();
+        for (size_t offset = 0; offset < len; offset += fragment_size)
+        {
+            RR_INTRUSIVE_PTR<Message> f = CreateMessage();
+            f->header = CreateMessageHeader();
+            ASIOStreamBaseTransport_copy_routing(m->header, f->header);
+            RR_INTRUSIVE_PTR<MessageEntry> fe = f->AddEntry(MessageEntryType_StreamFragment, "data");
+            fe->RequestID = id;
+            fe->AddElement("index", ScalarToRRArray(boost::numeric_cast<uint32_t>(i)));
+            fe->AddElement("offset", ScalarToRRArray(boost::numeric_cast<uint64_t>(offset)));
+            fe->AddElement("data", AttachRRArray<uint8_t>(p + offset, std::min(fragment_size, len - offset), view));
+            fragments.push_back(f);
+        }
+    }
+
+    return true;
+}
+
+RR_INTRUSIVE_PTR<Message> ASIOStreamBaseTransport::FragmentMessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if (!(active_capabilities_message4_fragment & TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE))
+    {
+        throw ProtocolException("Fragmented messages not enabled");
+    }
+
+    RR_INTRUSIVE_PTR<MessageEntry> mm = m->entries.at(0);
+
+    if (mm->MemberName == "begin")
+    {
+        if (recv_fragments.find(mm->RequestID) != recv_fragments.end())
+        {
+            throw ProtocolException("Duplicate fragmented message");
+        }
+
+        std::vector<uint32_t> indexes =
+            RRArrayToVector<uint32_t>(rr_null_check(mm->FindElement("indexes")->CastData<RRArray<uint32_t> >()));
+        std::vector<uint32_t> types =
+            RRArrayToVector<uint32_t>(rr_null_check(mm->FindElement("types")->CastData<RRArray<uint32_t> >()));
+        std::vector<uint64_t> counts =
+            RRArrayToVector<uint64_t>(rr_null_check(mm->FindElement("counts")->CastData<RRArray<uint64_t> >()));
+        if (indexes.empty() || types.size() != indexes.size() || counts.size() != indexes.size())
+        {
+            throw ProtocolException("Invalid fragmented message");
+        }
+
+        fragment_recv_entry e;
+        e.message = CreateMessage();
+        e.message->header = m->header;
+        e.message->entries.assign(m->entries.begin() + 1, m->entries.end());
+
+        std::vector<RR_INTRUSIVE_PTR<MessageElement> > elements;
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e1, e.message->entries)
+        {
+            ASIOStreamBaseTransport_flatten_elements(e1->elements, elements);
+        }
+
+        for (size_t i = 0; i < indexes.size(); i++)
+        {
+            DataTypes type = static_cast<DataTypes>(types[i]);
+            if (indexes[i] >= elements.size() || !IsTypeNumeric(type) || elements[indexes[i]]->ElementType != type)
+            {
+                throw ProtocolException("Invalid fragmented message");
+            }
+            uint64_t len = counts[i] * RRArrayElementSize(type);
+            if (len / RRArrayElementSize(type) != counts[i] || len > max_fragmented_message_size - e.size)
             {
-                detail::PostHandler(node, ee->callback, true, false);
+                throw ProtocolException("Fragmented message larger than maximum fragmented message size");
+            }
+            e.size += boost::numeric_cast<size_t>(len);
+        }
 
-                if (replaced)
-                {
-                    ee = send_queue.erase(ee);
-                }
-                else
-                {
-                    *ee = e;
-                    replaced = true;
-                    ++ee;
-                }
+        if (e.size + recv_fragments_size > max_fragmented_message_size)
+        {
+            throw ProtocolException("Fragmented message larger than maximum fragmented message size");
+        }
+
+        if (!recv_large_transfer_authorized)
+        {
+            if (IsLargeTransferAuthorized())
+            {
+                recv_large_transfer_authorized = true;
             }
             else
             {
-                ++ee;
+                throw ProtocolException("Attempt to receive fragmented message before authorized");
             }
         }
 
-        if (!replaced)
+        // The destination arrays are attached to the message now, and filled in place as fragments arrive
+        for (size_t i = 0; i < indexes.size(); i++)
         {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(), "Enqueuing message");
-            send_queue.push_back(e);
+            RR_INTRUSIVE_PTR<RRBaseArray> a =
+                AllocateRRArrayByType(static_cast<DataTypes>(types[i]), boost::numeric_cast<size_t>(counts[i]));
+            elements[indexes[i]]->SetData(a);
+            e.arrays.push_back(a);
         }
+
+        e.received.resize(e.arrays.size(), 0);
+        e.remaining = e.size;
+        recv_fragments_size += e.size;
+        recv_fragments.insert(std::make_pair(mm->RequestID, e));
+        return RR_INTRUSIVE_PTR<Message>();
     }
-    else
+
+    if (mm->MemberName == "data")
     {
+        RR_UNORDERED_MAP<uint32_t, fragment_recv_entry>::iterator e = recv_fragments.find(mm->RequestID);
+        if (e == recv_fragments.end())
+        {
+            throw ProtocolException("Unknown fragmented message");
+        }
 
-        BeginSendMessage(m, callback);
+        uint32_t index = RRArrayToScalar(rr_null_check(mm->FindElement("index")->CastData<RRArray<uint32_t> >()));
+        uint64_t offset = RRArrayToScalar(rr_null_check(mm->FindElement("offset")->CastData<RRArray<uint64_t> >()));
+        RR_INTRUSIVE_PTR<RRArray<uint8_t> > data =
+            rr_null_check(mm->FindElement("data")->CastData<RRArray<uint8_t> >());
+
+        if (index >= e->second.arrays.size())
+        {
+            throw ProtocolException("Invalid message fragment");
+        }
+
+        // Fragments of each array are sent in order
+        RR_INTRUSIVE_PTR<RRBaseArray>& a = e->second.arrays[index];
+        size_t& received = e->second.received[index];
+        if (offset != received || data->size() > a->size() * a->ElementSize() - received)
+        {
+            throw ProtocolException("Invalid message fragment");
+        }
+
+        memcpy(static_cast<uint8_t*>(a->void_ptr()) + received, data->data(), data->size());
+        received += data->size();
+        e->second.remaining -= data->size();
+        if (e->second.remaining > 0)
+        {
+            return RR_INTRUSIVE_PTR<Message>();
+        }
+
+        RR_INTRUSIVE_PTR<Message> ret = e->second.message;
+        recv_fragments_size -= e->second.size;
+        recv_fragments.erase(e);
+        return ret;
     }
+
+    throw ProtocolException("Invalid message fragment");
 }
 
 void ASIOStreamBaseTransport::SimpleAsyncSendMessage(
@@ -418,15 +926,8 @@ void ASIOStreamBaseTransport::SimpleAsyncEndSendMessage(const RR_SHARED_PTR<Robo
     }
 }
 
-void ASIOStreamBaseTransport::BeginSendMessage(
-    const RR_INTRUSIVE_PTR<Message>& m,
-    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback)
+bool ASIOStreamBaseTransport::SendMessageVersion4(const RR_INTRUSIVE_PTR<Message>& m)
 {
-    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(), "Begin sending message to stream");
-
-    size_t message_size = 0;
-    bool send_4 = send_version4.load();
-
     // Don't use version 4 for special requests
 
     // TODO: find more elegant solution for this
@@ -437,99 +938,206 @@ void ASIOStreamBaseTransport::BeginSendMessage(
         {
             if (m->entries[0]->MemberName == "CreateConnection")
             {
-                send_4 = false;
+                return false;
             }
         }
     }
 
+    return send_version4.load();
+}
+
+size_t ASIOStreamBaseTransport::PrepareSendMessage(const RR_INTRUSIVE_PTR<Message>& m, bool send_4)
+{
     if (!send_4)
     {
-        message_size = m->ComputeSize();
+        return m->ComputeSize();
+    }
 
-        if (!disable_async_io)
+    if (!GetRemoteNodeID().IsAnyNode() && GetRemoteEndpoint() != 0)
+    {
+        if (m->header->SenderNodeID == GetNode()->NodeID() && m->header->ReceiverNodeID == GetRemoteNodeID() &&
+            m->header->SenderEndpoint == GetLocalEndpoint() && m->header->ReceiverEndpoint == GetRemoteEndpoint())
         {
-            async_send_version = 2;
-            sending = true;
-            send_message_size = message_size;
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
-                                               "Sending message size " << message_size
-                                                                       << " using message version 2 with asyncio");
-            BeginSendMessage1(m, callback);
-            return;
+            if (!(m->entries.size() == 1 && m->entries[0]->EntryType < 500))
+            {
+                m->header->MessageFlags &= ~(MessageFlags_ROUTING_INFO | MessageFlags_ENDPOINT_INFO);
+            }
         }
+    }
 
-        if (message_size > sendbuf_len)
-        {
+    if (use_string_table4.load())
+    {
+        this->string_table4->MessageReplaceStringsWithCodes(m);
+    }
 
-            sendbuf = shared_array<uint8_t>(new uint8_t[message_size]);
-            sendbuf_len = message_size;
-        }
+    return m->ComputeSize4();
+}
 
-        ArrayBinaryWriter w(sendbuf.get(), 0, message_size);
-        m->Write(w);
+void ASIOStreamBaseTransport::BeginSendMessage(
+    const RR_INTRUSIVE_PTR<Message>& m,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(), "Begin sending message to stream");
+
+    bool send_4 = SendMessageVersion4(m);
+    size_t message_size = PrepareSendMessage(m, send_4);
+
+    if (max_send_batch_count > 1 && send_queue_size > 0 && message_size <= max_send_batch_size)
+    {
+        BeginSendMessageBatch(m, callback, send_4, message_size);
+        return;
+    }
+
+    if (!disable_async_io)
+    {
+        async_send_version = send_4 ? 4 : 2;
+        sending = true;
+        send_message_size = message_size;
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
-                                           "Sending message size " << message_size
-                                                                   << " using message version 2 buffer");
+                                           "Sending message size " << message_size << " using message version "
+                                                                   << async_send_version << " with asyncio");
+        BeginSendMessage1(m, callback);
+        return;
+    }
+
+    if (message_size > sendbuf_len)
+    {
+
+        sendbuf = shared_array<uint8_t>(new uint8_t[message_size]);
+        sendbuf_len = message_size;
+    }
+
+    ArrayBinaryWriter w(sendbuf.get(), 0, message_size);
+    if (!send_4)
+    {
+        m->Write(w);
     }
     else
     {
-        if (!GetRemoteNodeID().IsAnyNode() && GetRemoteEndpoint() != 0)
-        {
-            if (m->header->SenderNodeID == GetNode()->NodeID() && m->header->ReceiverNodeID == GetRemoteNodeID() &&
-                m->header->SenderEndpoint == GetLocalEndpoint() && m->header->ReceiverEndpoint == GetRemoteEndpoint())
-            {
-                if (!(m->entries.size() == 1 && m->entries[0]->EntryType < 500))
-                {
-                    m->header->MessageFlags &= ~(MessageFlags_ROUTING_INFO | MessageFlags_ENDPOINT_INFO);
-                }
-            }
-        }
+        m->Write4(w);
+    }
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                       "Sending message size " << message_size << " using message version "
+                                                               << (send_4 ? 4 : 2) << " buffer");
 
-        message_size = m->ComputeSize4();
+    boost::function<void(const boost::system::error_code& error, size_t bytes_transferred)> f =
+        boost::bind(&ASIOStreamBaseTransport::EndSendMessage, shared_from_this(), 0, RR_BOOST_PLACEHOLDERS(_1),
+                    RR_BOOST_PLACEHOLDERS(_2), m, message_size, callback, sendbuf);
+
+    const_buffers buf;
+    buf.push_back(const_buffer(sendbuf.get(), message_size));
 
-        if (use_string_table4.load())
+    this->async_write_some(buf, f);
+
+    sending = true;
+    send_message_size = message_size;
+}
+
+void ASIOStreamBaseTransport::BeginSendMessageBatch(
+    const RR_INTRUSIVE_PTR<Message>& m,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& callback, bool send_4,
+    size_t message_size)
+{
+    // Serialize the message and as many queued messages as fit in the batch
+    // budget into sendbuf so they go out in a single write. Each message
+    // keeps its own framing so the receiver does not need to know about batching.
+
+    std::vector<boost::tuple<RR_INTRUSIVE_PTR<Message>, bool, size_t> > batch;
+    RR_SHARED_PTR<std::vector<boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> > > callbacks =
+        RR_MAKE_SHARED<std::vector<boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> > >();
+
+    batch.push_back(boost::make_tuple(m, send_4, message_size));
+    callbacks->push_back(callback);
+    size_t batch_size = message_size;
+
+    while (send_queue_size > 0 && batch.size() < max_send_batch_count)
+    {
+        const RR_INTRUSIVE_PTR<Message>& m2 = PeekSendQueue().message;
+        bool send2_4 = SendMessageVersion4(m2);
+        // Size before string table replacement is an upper bound
+        size_t m2_size_max = send2_4 ? m2->ComputeSize4() : m2->ComputeSize();
+        if (batch_size + m2_size_max > max_send_batch_size)
         {
-            this->string_table4->MessageReplaceStringsWithCodes(m);
-            message_size = m->ComputeSize4();
+            break;
         }
 
-        if (!disable_async_io)
+        message_queue_entry e = PopSendQueue();
+        try
         {
-            sending = true;
-            send_message_size = message_size;
-            async_send_version = 4;
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
-                                               "Sending message size " << message_size
-                                                                       << " using message version 4 with asyncio");
-            BeginSendMessage1(m, callback);
-            return;
+            size_t m2_size = PrepareSendMessage(e.message, send2_4);
+            batch.push_back(boost::make_tuple(e.message, send2_4, m2_size));
+            callbacks->push_back(e.callback);
+            batch_size += m2_size;
         }
-
-        if (message_size > sendbuf_len)
+        catch (std::exception& exp)
         {
-
-            sendbuf = shared_array<uint8_t>(new uint8_t[message_size]);
-            sendbuf_len = message_size;
+            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                               "Error adding message to send batch " << exp.what());
+            detail::PostHandlerWithException(node, e.callback, RR_MAKE_SHARED<ConnectionException>(exp.what()), true,
+                                             false);
         }
+    }
 
-        ArrayBinaryWriter w(sendbuf.get(), 0, message_size);
-        m->Write4(w);
-        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
-                                           "Sending message size " << message_size
-                                                                   << " using message version 4 buffer");
+    if (batch_size > sendbuf_len)
+    {
+        sendbuf = shared_array<uint8_t>(new uint8_t[batch_size]);
+        sendbuf_len = batch_size;
     }
 
+    size_t pos = 0;
+    for (size_t i = 0; i < batch.size(); i++)
+    {
+        const RR_INTRUSIVE_PTR<Message>& m2 = batch[i].get<0>();
+        size_t m2_size = batch[i].get<2>();
+        ArrayBinaryWriter w(sendbuf.get() + pos, 0, m2_size);
+        if (batch[i].get<1>())
+        {
+            m2->Write4(w);
+        }
+        else
+        {
+            m2->Write(w);
+        }
+        pos += m2_size;
+    }
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                       "Sending batch of " << batch.size() << " messages size " << batch_size);
+
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> batch_callback =
+        boost::bind(&ASIOStreamBaseTransport::EndSendMessageBatch, node, callbacks, RR_BOOST_PLACEHOLDERS(_1));
+
     boost::function<void(const boost::system::error_code& error, size_t bytes_transferred)> f =
         boost::bind(&ASIOStreamBaseTransport::EndSendMessage, shared_from_this(), 0, RR_BOOST_PLACEHOLDERS(_1),
-                    RR_BOOST_PLACEHOLDERS(_2), m, message_size, callback, sendbuf);
+                    RR_BOOST_PLACEHOLDERS(_2), m, batch_size, batch_callback, sendbuf);
 
     const_buffers buf;
-    buf.push_back(const_buffer(sendbuf.get(), message_size));
+    buf.push_back(const_buffer(sendbuf.get(), batch_size));
 
     this->async_write_some(buf, f);
 
     sending = true;
-    send_message_size = message_size;
+    send_message_size = batch_size;
+}
+
+void ASIOStreamBaseTransport::EndSendMessageBatch(
+    RR_WEAK_PTR<RobotRaconteurNode> node,
+    const RR_SHARED_PTR<std::vector<boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> > >&
+        callbacks,
+    const RR_SHARED_PTR<RobotRaconteurException>& err)
+{
+    typedef boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> callback_type;
+    BOOST_FOREACH (callback_type& c, *callbacks)
+    {
+        if (err)
+        {
+            detail::InvokeHandlerWithException(node, c, err);
+        }
+        else
+        {
+            detail::InvokeHandler(node, c);
+        }
+    }
 }
 
 void ASIOStreamBaseTransport::BeginSendMessage1(
@@ -715,11 +1323,10 @@ void ASIOStreamBaseTransport::EndSendMessage1()
 
     bool c = connected.load();
 
-    if (!send_queue.empty() && c && !send_pause_request)
+    if (send_queue_size > 0 && c && !send_pause_request)
     {
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(), "Dequeing next message");
-        message_queue_entry m = send_queue.front();
-        send_queue.pop_front();
+        message_queue_entry m = PopSendQueue();
         try
         {
             BeginSendMessage(m.message, m.callback);
@@ -794,10 +1401,9 @@ void ASIOStreamBaseTransport::AsyncResumeSend()
     bool c = connected.load();
 
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(), "Send resumed");
-    if (!send_queue.empty() && c && !send_pause_request && !sending)
+    if (send_queue_size > 0 && c && !send_pause_request && !sending)
     {
-        message_queue_entry m = send_queue.front();
-        send_queue.pop_front();
+        message_queue_entry m = PopSendQueue();
         try
         {
             BeginSendMessage(m.message, m.callback);
@@ -1129,6 +1735,39 @@ void ASIOStreamBaseTransport::EndReceiveMessage3(const RR_INTRUSIVE_PTR<Message>
                 CheckStreamCapability_MessageReceived(message);
                 EndReceiveMessage4();
             }
+            else if (message->entries.at(0)->EntryType == MessageEntryType_StreamFragment)
+            {
+                RR_INTRUSIVE_PTR<Message> message2;
+                try
+                {
+                    message2 = FragmentMessageReceived(message);
+                }
+                catch (std::exception& exp)
+                {
+                    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                                       "Error receiving message fragment: " << exp.what()
+                                                                                            << ", closing transport");
+                    Close();
+                    return;
+                }
+                EndReceiveMessage4();
+                if (message2)
+                {
+                    try
+                    {
+                        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                                           "Dispatching reassembled fragmented message to node");
+                        MessageReceived(message2);
+                    }
+                    catch (std::exception& exp)
+                    {
+                        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                                           "Error dispatching message: " << exp.what()
+                                                                                         << ", closing transport");
+                        Close();
+                    }
+                }
+            }
             else
             {
                 EndReceiveMessage4();
@@ -1657,15 +2296,21 @@ void ASIOStreamBaseTransport::Close()
             RobotRaconteurNode::TryPostToThreadPool(node, boost::bind(f, ec));
         }
 
-        for (std::list<message_queue_entry>::iterator e = send_queue.begin(); e != send_queue.end();)
+        send_queue_index.clear();
+
+        for (size_t i = 0; i < send_queue.size(); i++)
         {
-            boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> f = e->callback;
-            e = send_queue.erase(e);
-            detail::PostHandlerWithException(node, f, RR_MAKE_SHARED<ConnectionException>("Transport Closed"), true,
-                                             false);
+            std::list<message_queue_entry>& lane = send_queue[i];
+            for (std::list<message_queue_entry>::iterator e = lane.begin(); e != lane.end();)
+            {
+                boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> f = e->callback;
+                e = lane.erase(e);
+                detail::PostHandlerWithException(node, f, RR_MAKE_SHARED<ConnectionException>("Transport Closed"),
+                                                 true, false);
+            }
         }
 
-        send_queue.clear();
+        send_queue_size = 0;
     }
     catch (std::exception&)
     {}
@@ -2196,6 +2841,11 @@ void ASIOStreamBaseTransport::BeginStreamOp(
                                    TransportCapabilityCode_MESSAGE4_STRINGTABLE_MESSAGE_LOCAL |
                                    TransportCapabilityCode_MESSAGE4_STRINGTABLE_STANDARD_TABLE);
                 }
+                if (max_fragmented_message_size > 0)
+                {
+                    caps.push_back(TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE |
+                                   TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE);
+                }
             }
             mm->AddElement("capabilities", VectorToRRArray<uint32_t>(caps));
             m->entries.push_back(mm);
@@ -2353,6 +3003,7 @@ RR_INTRUSIVE_PTR<MessageEntry> ASIOStreamBaseTransport::ProcessStreamOpRequest(
                 uint32_t message2_basic_caps = TransportCapabilityCode_MESSAGE2_BASIC_ENABLE;
                 uint32_t message4_basic_caps = 0;
                 uint32_t message4_string_caps = 0;
+                uint32_t message4_fragment_caps = 0;
 
                 std::vector<uint32_t> ret_caps;
 
@@ -2383,6 +3034,11 @@ RR_INTRUSIVE_PTR<MessageEntry> ASIOStreamBaseTransport::ProcessStreamOpRequest(
                                           TransportCapabilityCode_MESSAGE4_STRINGTABLE_MESSAGE_LOCAL |
                                           TransportCapabilityCode_MESSAGE4_STRINGTABLE_STANDARD_TABLE));
                     }
+
+                    if (cap_page == TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE)
+                    {
+                        message4_fragment_caps = (cap_value & TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE);
+                    }
                 }
 
                 if (!(message2_basic_caps & TransportCapabilityCode_MESSAGE2_BASIC_ENABLE))
@@ -2416,6 +3072,13 @@ RR_INTRUSIVE_PTR<MessageEntry> ASIOStreamBaseTransport::ProcessStreamOpRequest(
                         active_capabilities_message4_stringtable = message4_string_caps;
                         use_string_table4.store(true);
                     }
+                    if ((message4_fragment_caps & TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE) &&
+                        max_fragmented_message_size > 0)
+                    {
+                        message4_fragment_caps |= TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE;
+                        ret_caps.push_back(message4_fragment_caps);
+                        active_capabilities_message4_fragment = message4_fragment_caps;
+                    }
                 }
 
                 ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
@@ -2635,6 +3298,7 @@ RR_SHARED_PTR<RRObject> ASIOStreamBaseTransport::UnpackStreamOpResponse(const RR
             uint32_t message2_basic_caps = TransportCapabilityCode_MESSAGE2_BASIC_ENABLE;
             uint32_t message4_basic_caps = 0;
             uint32_t message4_string_caps = 0;
+            uint32_t message4_fragment_caps = 0;
 
             RR_INTRUSIVE_PTR<RRArray<uint32_t> > caps_array = rr_null_check(elem_caps->CastData<RRArray<uint32_t> >());
             std::vector<uint32_t> caps_array1 = RRArrayToVector<uint32_t>(caps_array);
@@ -2748,6 +3412,20 @@ RR_SHARED_PTR<RRObject> ASIOStreamBaseTransport::UnpackStreamOpResponse(const RR
                         }
                     }
                 }
+
+                if (cap_page == TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE)
+                {
+                    if (cap_value != 0 && (disable_message4 || max_fragmented_message_size == 0 ||
+                                           cap_value != TransportCapabilityCode_MESSAGE4_FRAGMENT_ENABLE))
+                    {
+                        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(
+                            node, Transport, GetLocalEndpoint(),
+                            "CreateConnection invalid version 4 fragment caps returned by server");
+                        throw ProtocolException("Invalid Message Version 4 Fragment capabilities");
+                    }
+
+                    message4_fragment_caps = cap_value;
+                }
             }
 
             active_capabilities_message2_basic = message2_basic_caps | TransportCapabilityCode_MESSAGE2_BASIC_PAGE;
@@ -2765,6 +3443,11 @@ RR_SHARED_PTR<RRObject> ASIOStreamBaseTransport::UnpackStreamOpResponse(const RR
                     string_table4->SetTableFlags(RR_MOVE(string_table_flags));
                     use_string_table4.store(true);
                 }
+                if (message4_fragment_caps)
+                {
+                    active_capabilities_message4_fragment =
+                        message4_fragment_caps | TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE;
+                }
             }
             else
             {
@@ -2775,6 +3458,13 @@ RR_SHARED_PTR<RRObject> ASIOStreamBaseTransport::UnpackStreamOpResponse(const RR
                         "CreateConnection invalid version 4 string table settings returned by server");
                     throw ProtocolException("Message 4 must be enabled for String Table 4");
                 }
+                if (message4_fragment_caps != 0)
+                {
+                    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(
+                        node, Transport, GetLocalEndpoint(),
+                        "CreateConnection invalid version 4 fragment settings returned by server");
+                    throw ProtocolException("Message 4 must be enabled for Fragment");
+                }
             }
         }
 
@@ -2820,6 +3510,16 @@ void ASIOStreamBaseTransport::SetDisableMessage4(bool d) { disable_message4 = d;
 bool ASIOStreamBaseTransport::GetDisableStringTable() { return disable_string_table; }
 void ASIOStreamBaseTransport::SetDisableStringTable(bool d) { disable_string_table = d; }
 
+uint64_t ASIOStreamBaseTransport::GetSendQueueWireCoalescedCount() { return send_queue_wire_coalesced_count.load(); }
+uint64_t ASIOStreamBaseTransport::GetSendQueueConnectionTestDroppedCount()
+{
+    return send_queue_connection_test_dropped_count.load();
+}
+uint64_t ASIOStreamBaseTransport::GetSendQueuePreemptedCount() { return send_queue_preempted_count.load(); }
+
+size_t ASIOStreamBaseTransport::GetMaxFragmentedMessageSize() { return max_fragmented_message_size; }
+void ASIOStreamBaseTransport::SetMaxFragmentedMessageSize(size_t size) { max_fragmented_message_size = size; }
+
 bool ASIOStreamBaseTransport::CheckCapabilityActive(uint32_t cap)
 {
     uint32_t cap_page = cap & TranspartCapabilityCode_PAGE_MASK;
@@ -2840,6 +3540,11 @@ bool ASIOStreamBaseTransport::CheckCapabilityActive(uint32_t cap)
         return (cap_value & (active_capabilities_message4_stringtable & (~TranspartCapabilityCode_PAGE_MASK))) != 0;
     }
 
+    if (cap_page == TransportCapabilityCode_MESSAGE4_FRAGMENT_PAGE)
+    {
+        return (cap_value & (active_capabilities_message4_fragment & (~TranspartCapabilityCode_PAGE_MASK))) != 0;
+    }
+
     return false;
 }
 
@@ -41,6 +41,7 @@ AsyncMessageReaderImpl::AsyncMessageReaderImpl()
     buf_avail_pos = 0;
     buf_read_pos = 0;
     message_pos = 0;
+    array_allocator = RRArrayBufferPool::GetDefault();
 }
 
 size_t& AsyncMessageReaderImpl::message_len() { return state_stack.front().limit; }
@@ -740,7 +741,7 @@ AsyncMessageReaderImpl::return_type AsyncMessageReaderImpl::Read(const const_buf
 
         case MessageElement_readarray1: {
             MessageElement* el = data<MessageElement>();
-            RR_INTRUSIVE_PTR<RRBaseArray> a = AllocateRRArrayByType(el->ElementType, el->DataCount);
+            RR_INTRUSIVE_PTR<RRBaseArray> a = AllocateRRArrayByType(el->ElementType, el->DataCount, array_allocator);
             size_t n = a->ElementSize() * a->size();
             size_t p = read_some_bytes(a->void_ptr(), n);
             size_t l = el->ElementSize;
@@ -1351,7 +1352,7 @@ AsyncMessageReaderImpl::return_type AsyncMessageReaderImpl::Read4(const const_bu
 
         case MessageElement_readarray1: {
             MessageElement* el = data<MessageElement>();
-            RR_INTRUSIVE_PTR<RRBaseArray> a = AllocateRRArrayByType(el->ElementType, el->DataCount);
+            RR_INTRUSIVE_PTR<RRBaseArray> a = AllocateRRArrayByType(el->ElementType, el->DataCount, array_allocator);
             size_t n = a->ElementSize() * a->size();
             size_t p = read_some_bytes(a->void_ptr(), n);
             size_t l = el->ElementSize;
@@ -1491,4 +1492,16 @@ RR_INTRUSIVE_PTR<Message> AsyncMessageReaderImpl::GetNextMessage()
     return m;
 }
 
+RR_SHARED_PTR<RRArrayAllocator> AsyncMessageReaderImpl::GetArrayAllocator() { return array_allocator; }
+
+void AsyncMessageReaderImpl::SetArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+{
+    if (!allocator)
+    {
+        array_allocator = RRArrayBufferPool::GetDefault();
+        return;
+    }
+    array_allocator = allocator;
+}
+
 } // namespace RobotRaconteur
@@ -132,6 +132,8 @@ class ROBOTRACONTEUR_CORE_API AsyncMessageReaderImpl : public AsyncMessageReader
 
     size_t message_pos;
 
+    RR_SHARED_PTR<RRArrayAllocator> array_allocator;
+
   public:
     AsyncMessageReaderImpl();
     RR_OVIRTUAL ~AsyncMessageReaderImpl() RR_OVERRIDE {}
@@ -192,5 +194,8 @@ class ROBOTRACONTEUR_CORE_API AsyncMessageReaderImpl : public AsyncMessageReader
 
     RR_OVIRTUAL bool MessageReady() RR_OVERRIDE;
     RR_OVIRTUAL RR_INTRUSIVE_PTR<Message> GetNextMessage() RR_OVERRIDE;
+
+    RR_OVIRTUAL RR_SHARED_PTR<RRArrayAllocator> GetArrayAllocator() RR_OVERRIDE;
+    RR_OVIRTUAL void SetArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator) RR_OVERRIDE;
 };
 } // namespace RobotRaconteur
@@ -1054,7 +1054,13 @@ AsyncMessageWriterImpl::return_type AsyncMessageWriterImpl::Write4(size_t write_
             MessageEntry* ee = data<MessageEntry>();
             RR_INTRUSIVE_PTR<MessageElement> el = ee->elements.at(param1());
             param1()++;
+            if (el->Encoded4)
+            {
+                push_state(MessageElement_writeencoded, MessageEntry_writeelements, el->ElementSize, el->Encoded4);
+                continue;
+            }
             push_state(MessageElement_elementsize, MessageEntry_writeelements, el->ElementSize, el);
+            continue;
         }
         case MessageElement_elementsize: {
             R(write_uint_x(data<MessageElement>()->ElementSize));
@@ -1240,6 +1246,38 @@ AsyncMessageWriterImpl::return_type AsyncMessageWriterImpl::Write4(size_t write_
             }
         }
 
+        case MessageElement_writeencoded: {
+            // Element encoded by MessageElement::Encode4(), write the bytes as is
+            RR_INTRUSIVE_PTR<RRBaseArray> a = RR_STATIC_POINTER_CAST<RRBaseArray>(state_stack.back().data);
+            size_t n = a->size();
+            if (n != distance_from_limit())
+                throw ProtocolException("Invalid encoded element length");
+            if (n <= 255)
+            {
+                if (write_all_bytes(a->void_ptr(), n))
+                {
+                    state() = MessageElement_finishwritedata;
+                    continue;
+                }
+            }
+
+            prepare_continue(work_bufs, work_bufs_used, write_bufs);
+
+            size_t p = quota_available();
+            if (n <= p)
+            {
+                write_bufs.push_back(boost::asio::buffer(a->void_ptr(), n));
+                message_pos += n;
+                state() = MessageElement_finishwritedata;
+                continue;
+            }
+
+            write_bufs.push_back(boost::asio::buffer(a->void_ptr(), p));
+            message_pos += p;
+            push_state(MessageElement_writearray2, MessageElement_finishwritedata, n - p, a, p, n);
+            return WriteReturn_continue;
+        }
+
         // Handle string interruption
         case Header_writestring: {
             size_t& p1 = param1();
@@ -1272,6 +1310,11 @@ AsyncMessageWriterImpl::return_type AsyncMessageWriterImpl::Write4(size_t write_
 
             RR_INTRUSIVE_PTR<MessageElement> el = s->Elements.at(param1());
             param1()++;
+            if (el->Encoded4)
+            {
+                push_state(MessageElement_writeencoded, MessageElement_writenested2, el->ElementSize, el->Encoded4);
+                continue;
+            }
             push_state(MessageElement_elementsize, MessageElement_writenested2, el->ElementSize, el);
             continue;
         }
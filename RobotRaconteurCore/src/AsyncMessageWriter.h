@@ -97,6 +97,7 @@ class ROBOTRACONTEUR_CORE_API AsyncMessageWriterImpl : public AsyncMessageWriter
         MessageElement_writearray2,
         MessageElement_writenested1,
         MessageElement_writenested2,
+        MessageElement_writeencoded,
 
         // String handling
         Header_writestring,
@@ -217,6 +217,150 @@ ROBOTRACONTEUR_CORE_API RR_INTRUSIVE_PTR<RRBaseArray> AllocateRRArrayByType(Data
     throw DataTypeException("Invalid data type");
 }
 
+ROBOTRACONTEUR_CORE_API RR_INTRUSIVE_PTR<RRBaseArray> AllocateRRArrayByType(
+    DataTypes type, size_t length, const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+{
+    switch (type)
+    {
+
+    case DataTypes_double_t:
+        return AllocateRRArray<double>(length, allocator);
+    case DataTypes_single_t:
+        return AllocateRRArray<float>(length, allocator);
+    case DataTypes_int8_t:
+        return AllocateRRArray<int8_t>(length, allocator);
+    case DataTypes_uint8_t:
+        return AllocateRRArray<uint8_t>(length, allocator);
+    case DataTypes_int16_t:
+        return AllocateRRArray<int16_t>(length, allocator);
+    case DataTypes_uint16_t:
+        return AllocateRRArray<uint16_t>(length, allocator);
+    case DataTypes_int32_t:
+        return AllocateRRArray<int32_t>(length, allocator);
+    case DataTypes_uint32_t:
+        return AllocateRRArray<uint32_t>(length, allocator);
+    case DataTypes_int64_t:
+        return AllocateRRArray<int64_t>(length, allocator);
+    case DataTypes_uint64_t:
+        return AllocateRRArray<uint64_t>(length, allocator);
+    case DataTypes_string_t:
+        return AllocateRRArray<char>(length, allocator);
+    case DataTypes_cdouble_t:
+        return AllocateRRArray<cdouble>(length, allocator);
+    case DataTypes_csingle_t:
+        return AllocateRRArray<cfloat>(length, allocator);
+    case DataTypes_bool_t:
+        return AllocateRRArray<rr_bool>(length, allocator);
+    default:
+        throw DataTypeException("Invalid data type");
+    }
+
+    throw DataTypeException("Invalid data type");
+}
+
+RRArrayBufferPool::RRArrayBufferPool(size_t max_buffer_size, size_t max_cached_bytes)
+{
+    this->max_buffer_size =
+        std::min(max_buffer_size, static_cast<size_t>(1) << (size_class_count - 1 + min_size_class_shift));
+    for (size_t i = 0; i < size_class_count; i++)
+    {
+        size_t class_size = static_cast<size_t>(1) << (i + min_size_class_shift);
+        size_classes[i].max_buffers = std::max(max_cached_bytes / class_size, static_cast<size_t>(2));
+    }
+}
+
+size_t RRArrayBufferPool::GetSizeClass(size_t size)
+{
+    size_t i = 0;
+    while (i < size_class_count - 1 && (static_cast<size_t>(1) << (i + min_size_class_shift)) < size)
+    {
+        i++;
+    }
+    return i;
+}
+
+void* RRArrayBufferPool::Allocate(size_t size)
+{
+    if (size > max_buffer_size)
+    {
+        return ::operator new(size);
+    }
+
+    size_t i = GetSizeClass(size);
+    {
+        boost::mutex::scoped_lock lock(size_classes[i].lock);
+        if (!size_classes[i].buffers.empty())
+        {
+            void* p = size_classes[i].buffers.back();
+            size_classes[i].buffers.pop_back();
+            return p;
+        }
+    }
+
+    return ::operator new(static_cast<size_t>(1) << (i + min_size_class_shift));
+}
+
+void RRArrayBufferPool::Release(void* p, size_t size)
+{
+    if (!p)
+    {
+        return;
+    }
+
+    if (size > max_buffer_size)
+    {
+        ::operator delete(p);
+        return;
+    }
+
+    size_t i = GetSizeClass(size);
+    {
+        boost::mutex::scoped_lock lock(size_classes[i].lock);
+        if (size_classes[i].buffers.size() < size_classes[i].max_buffers)
+        {
+            size_classes[i].buffers.push_back(p);
+            return;
+        }
+    }
+
+    ::operator delete(p);
+}
+
+size_t RRArrayBufferPool::GetCachedBufferCount()
+{
+    size_t count = 0;
+    for (size_t i = 0; i < size_class_count; i++)
+    {
+        boost::mutex::scoped_lock lock(size_classes[i].lock);
+        count += size_classes[i].buffers.size();
+    }
+    return count;
+}
+
+void RRArrayBufferPool::Clear()
+{
+    for (size_t i = 0; i < size_class_count; i++)
+    {
+        std::vector<void*> buffers;
+        {
+            boost::mutex::scoped_lock lock(size_classes[i].lock);
+            buffers.swap(size_classes[i].buffers);
+        }
+        BOOST_FOREACH (void* p, buffers)
+        {
+            ::operator delete(p);
+        }
+    }
+}
+
+RRArrayBufferPool::~RRArrayBufferPool() { Clear(); }
+
+RR_SHARED_PTR<RRArrayBufferPool> RRArrayBufferPool::GetDefault()
+{
+    static RR_SHARED_PTR<RRArrayBufferPool> default_pool = RR_MAKE_SHARED<RRArrayBufferPool>();
+    return default_pool;
+}
+
 ROBOTRACONTEUR_CORE_API size_t RRArrayElementSize(DataTypes type)
 {
     switch (type)
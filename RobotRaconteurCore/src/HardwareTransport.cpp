@@ -1087,11 +1087,8 @@ void HardwareTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message
     try
     {
         std::string connecturl = scheme + ":///";
-        // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-        Transport::m_CurrentThreadTransportConnectionURL.reset(new std::string(RR_MOVE(connecturl)));
-        Transport::m_CurrentThreadTransport.reset(new RR_SHARED_PTR<ITransportConnection>(
-            RR_STATIC_POINTER_CAST<HardwareTransportConnection>(shared_from_this())));
-        // NOLINTEND(cppcoreguidelines-owning-memory)
+        Transport::SetCurrentThreadTransportContext(
+            connecturl, RR_STATIC_POINTER_CAST<HardwareTransportConnection>(shared_from_this()));
         p->MessageReceived(m);
     }
     catch (std::exception& exp)
@@ -1102,8 +1099,7 @@ void HardwareTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message
         Close();
     }
 
-    Transport::m_CurrentThreadTransportConnectionURL.reset(0);
-    Transport::m_CurrentThreadTransport.reset(0);
+    Transport::ClearCurrentThreadTransportContext();
 }
 
 void HardwareTransportConnection::Close()
@@ -39,6 +39,7 @@ IntraTransport::IntraTransport(const RR_SHARED_PTR<RobotRaconteurNode>& node) :
 
     closed = false;
     is_init = false;
+    inline_dispatch.store(false);
 
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "IntraTransport created");
 }
@@ -572,6 +573,14 @@ void IntraTransport::StartClient()
     DiscoverAllNodes();
 }
 
+bool IntraTransport::GetInlineDispatch() { return inline_dispatch.load(); }
+
+void IntraTransport::SetInlineDispatch(bool inline_dispatch)
+{
+    this->inline_dispatch.store(inline_dispatch);
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "InlineDispatch set to: " << inline_dispatch);
+}
+
 static void IntraTransport_NodeDetected1(RR_WEAK_PTR<RobotRaconteurNode> node, const NodeDiscoveryInfo& info)
 {
     RR_SHARED_PTR<RobotRaconteurNode> node1 = node.lock();
@@ -610,50 +619,124 @@ IntraTransportConnection::IntraTransportConnection(const RR_SHARED_PTR<IntraTran
     this->m_LocalEndpoint = local_endpoint;
     m_RemoteEndpoint = 0;
     this->recv_queue_post_requested = false;
+    this->recv_queue_drain_pos = 0;
+    this->inline_dispatch = parent->GetInlineDispatch();
     this->node = parent->GetNode();
 }
 
+// Set while a message is being delivered inline on the sending thread. Messages sent by the
+// receiver during inline delivery are queued instead of recursing into another inline delivery.
+static boost::thread_specific_ptr<bool> IntraTransportConnection_inline_active;
+
+static bool IntraTransportConnection_is_inline_active()
+{
+    bool* a = IntraTransportConnection_inline_active.get();
+    return a && *a;
+}
+
+static void IntraTransportConnection_set_inline_active(bool v)
+{
+    bool* a = IntraTransportConnection_inline_active.get();
+    if (!a)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        IntraTransportConnection_inline_active.reset(new bool(v));
+        return;
+    }
+    *a = v;
+}
+
 void IntraTransportConnection::AcceptMessage(const RR_INTRUSIVE_PTR<Message>& m)
 {
-    boost::mutex::scoped_lock lock(recv_queue_lock);
-    recv_queue.push_back(m);
-    if (!recv_queue_post_requested)
     {
-        RR_WEAK_PTR<IntraTransportConnection> c = shared_from_this();
-        RobotRaconteurNode::TryPostToThreadPool(node,
-                                                boost::bind(&IntraTransportConnection::ProcessNextRecvMessage, c));
+        boost::mutex::scoped_lock lock(recv_queue_lock);
+        if (!recv_queue_post_requested && recv_queue.empty() && recv_queue_drain_pos == recv_queue_drain.size() &&
+            inline_dispatch && !IntraTransportConnection_is_inline_active())
+        {
+            // Nothing is queued, so delivering on this thread keeps message order
+            lock.unlock();
+            DeliverInlineMessage(m);
+            return;
+        }
+
+        recv_queue.push_back(m);
+        if (recv_queue_post_requested)
+        {
+            // A delivery is already queued and will pick up this message
+            return;
+        }
+        recv_queue_post_requested = true;
     }
+
+    RR_WEAK_PTR<IntraTransportConnection> c = shared_from_this();
+    RobotRaconteurNode::TryPostToThreadPool(node, boost::bind(&IntraTransportConnection::ProcessRecvMessages, c));
+}
+
+void IntraTransportConnection::DeliverInlineMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    IntraTransportConnection_set_inline_active(true);
+    DeliverRecvMessage(m);
+    IntraTransportConnection_set_inline_active(false);
 }
 
-void IntraTransportConnection::ProcessNextRecvMessage(RR_WEAK_PTR<IntraTransportConnection> c)
+void IntraTransportConnection::ProcessRecvMessages(RR_WEAK_PTR<IntraTransportConnection> c)
 {
     RR_SHARED_PTR<IntraTransportConnection> c1 = c.lock();
     if (!c1)
         return;
 
     RR_INTRUSIVE_PTR<Message> m;
+    bool more = false;
 
     {
         boost::mutex::scoped_lock lock(c1->recv_queue_lock);
-        if (c1->recv_queue.empty())
+        if (c1->recv_queue_drain_pos == c1->recv_queue_drain.size())
         {
-            c1->recv_queue_post_requested = false;
-            return;
+            // Take every waiting message at once instead of locking the sender out per message
+            c1->recv_queue_drain.clear();
+            c1->recv_queue_drain_pos = 0;
+            c1->recv_queue.swap(c1->recv_queue_drain);
         }
-        m = c1->recv_queue.front();
-        c1->recv_queue.pop_front();
-        if (c1->recv_queue.empty())
+
+        if (c1->recv_queue_drain.empty())
         {
             c1->recv_queue_post_requested = false;
+            return;
         }
-        else
+
+        RR_SWAP(m, c1->recv_queue_drain[c1->recv_queue_drain_pos]);
+        c1->recv_queue_drain_pos++;
+
+        more = c1->recv_queue_drain_pos < c1->recv_queue_drain.size() || !c1->recv_queue.empty();
+        if (!more)
         {
-            RobotRaconteurNode::TryPostToThreadPool(c1->node,
-                                                    boost::bind(&IntraTransportConnection::ProcessNextRecvMessage, c));
+            c1->recv_queue_post_requested = false;
         }
     }
 
-    c1->MessageReceived(m);
+    // Hand off the next message before delivering this one. Handlers may block waiting for a
+    // later message on the same connection, such as the response to a callback.
+    if (more)
+    {
+        RobotRaconteurNode::TryPostToThreadPool(c1->node,
+                                                boost::bind(&IntraTransportConnection::ProcessRecvMessages, c));
+    }
+
+    c1->DeliverRecvMessage(m);
+}
+
+void IntraTransportConnection::DeliverRecvMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    try
+    {
+        MessageReceived(m);
+    }
+    catch (std::exception& exp)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                           "IntraTransport failed receiving message: " << exp.what());
+        RobotRaconteurNode::TryHandleException(node, &exp);
+    }
 }
 
 void IntraTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
@@ -724,12 +807,8 @@ void IntraTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>&
 
     try
     {
-        std::string connecturl = "rr+intra:///";
-        // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-        Transport::m_CurrentThreadTransportConnectionURL.reset(new std::string(RR_MOVE(connecturl)));
-        Transport::m_CurrentThreadTransport.reset(new RR_SHARED_PTR<ITransportConnection>(
-            RR_STATIC_POINTER_CAST<IntraTransportConnection>(shared_from_this())));
-        // NOLINTEND(cppcoreguidelines-owning-memory)
+        Transport::SetCurrentThreadTransportContext(
+            "rr+intra:///", RR_STATIC_POINTER_CAST<IntraTransportConnection>(shared_from_this()));
         p->MessageReceived(m);
     }
     catch (std::exception& exp)
@@ -740,8 +819,7 @@ void IntraTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>&
         Close();
     }
 
-    Transport::m_CurrentThreadTransportConnectionURL.reset(0);
-    Transport::m_CurrentThreadTransport.reset(0);
+    Transport::ClearCurrentThreadTransportContext();
 }
 
 void IntraTransportConnection::SendMessage(const RR_INTRUSIVE_PTR<Message>& m)
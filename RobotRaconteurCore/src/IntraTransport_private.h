@@ -55,7 +55,11 @@ class ROBOTRACONTEUR_CORE_API IntraTransportConnection : public ITransportConnec
     RR_OVIRTUAL RR_SHARED_PTR<Transport> GetTransport() RR_OVERRIDE;
 
   protected:
-    static void ProcessNextRecvMessage(RR_WEAK_PTR<IntraTransportConnection> c);
+    static void ProcessRecvMessages(RR_WEAK_PTR<IntraTransportConnection> c);
+
+    void DeliverRecvMessage(const RR_INTRUSIVE_PTR<Message>& m);
+
+    void DeliverInlineMessage(const RR_INTRUSIVE_PTR<Message>& m);
 
     void SimpleAsyncEndSendMessage(const RR_SHARED_PTR<RobotRaconteurException>& err);
 
@@ -81,8 +85,14 @@ class ROBOTRACONTEUR_CORE_API IntraTransportConnection : public ITransportConnec
 
     boost::atomic<bool> connected;
 
+    // recv_queue is filled by senders. The delivering thread swaps it with recv_queue_drain
+    // when the drain is used up, so the lock is held briefly and the vectors keep their storage.
+    // recv_queue_post_requested is true while a delivery task is queued.
     boost::mutex recv_queue_lock;
-    std::list<RR_INTRUSIVE_PTR<Message> > recv_queue;
+    std::vector<RR_INTRUSIVE_PTR<Message> > recv_queue;
+    std::vector<RR_INTRUSIVE_PTR<Message> > recv_queue_drain;
+    size_t recv_queue_drain_pos;
     bool recv_queue_post_requested;
+    bool inline_dispatch;
 };
 } // namespace RobotRaconteur
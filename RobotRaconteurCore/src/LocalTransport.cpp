@@ -112,6 +112,8 @@ LocalTransport::LocalTransport(const RR_SHARED_PTR<RobotRaconteurNode>& node) :
     disable_string_table = true;
 #endif
     disable_async_message_io = false;
+    max_send_batch_size = 64 * 1024;
+    max_send_batch_count = 1;
 
     closed = false;
 
@@ -668,7 +670,7 @@ void LocalTransport::StartServerAsNodeName(boost::string_ref name, bool public_)
             {
 
                 RR_SHARED_PTR<detail::LocalTransport_socket> socket(
-                    new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_io_context()));
+                    new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_next_io_context()));
                 boost::asio::local::stream_protocol::endpoint ep(pipename);
                 acceptor = RR_SHARED_PTR<detail::LocalTransport_acceptor>(
                     new detail::LocalTransport_acceptor(GetNode()->GetThreadPool()->get_io_context()));
@@ -747,7 +749,7 @@ void LocalTransport::StartServerAsNodeName(boost::string_ref name, bool public_)
         }
 
         RR_SHARED_PTR<detail::LocalTransport_socket> socket(
-            new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_io_context()));
+            new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_next_io_context()));
         acceptor->acceptor.async_accept(*socket->socket,
                                         boost::bind(&LocalTransport::handle_accept, shared_from_this(), acceptor,
                                                     socket, boost::asio::placeholders::error));
@@ -864,7 +866,7 @@ void LocalTransport::StartServerAsNodeID(const NodeID& nodeid1, bool public_)
             {
 
                 RR_SHARED_PTR<detail::LocalTransport_socket> socket(
-                    new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_io_context()));
+                    new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_next_io_context()));
                 boost::asio::local::stream_protocol::endpoint ep(pipename);
                 acceptor = RR_SHARED_PTR<detail::LocalTransport_acceptor>(
                     new detail::LocalTransport_acceptor(GetNode()->GetThreadPool()->get_io_context(), ep));
@@ -918,7 +920,7 @@ void LocalTransport::StartServerAsNodeID(const NodeID& nodeid1, bool public_)
         }
 
         RR_SHARED_PTR<detail::LocalTransport_socket> socket(
-            new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_io_context()));
+            new detail::LocalTransport_socket(GetNode()->GetThreadPool()->get_next_io_context()));
         acceptor->acceptor.async_accept(*socket->socket,
                                         boost::bind(&LocalTransport::handle_accept, shared_from_this(), acceptor,
                                                     socket, boost::asio::placeholders::error));
@@ -1040,7 +1042,7 @@ void LocalTransport::handle_accept(const RR_SHARED_PTR<LocalTransport>& parent,
     boost::mutex::scoped_lock lock(parent->acceptor_lock);
 
     RR_SHARED_PTR<detail::LocalTransport_socket> socket2(
-        new detail::LocalTransport_socket(parent->GetNode()->GetThreadPool()->get_io_context()));
+        new detail::LocalTransport_socket(parent->GetNode()->GetThreadPool()->get_next_io_context()));
     acceptor->acceptor.async_accept(*socket2->socket, boost::bind(&LocalTransport::handle_accept, parent, acceptor,
                                                                   socket2, boost::asio::placeholders::error));
 }
@@ -1191,6 +1193,55 @@ void LocalTransport::SetDisableAsyncMessageIO(bool d)
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "DisableAsyncMessageIO set to: " << d);
 }
 
+int32_t LocalTransport::GetMaxSendBatchSize()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return max_send_batch_size;
+}
+
+void LocalTransport::SetMaxSendBatchSize(int32_t size)
+{
+    if (size < 0)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, -1, "Invalid MaxSendBatchSize: " << size);
+        throw InvalidArgumentException("Invalid maximum send batch size");
+    }
+    boost::mutex::scoped_lock lock(parameter_lock);
+    max_send_batch_size = size;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "MaxSendBatchSize set to " << size << " bytes");
+}
+
+int32_t LocalTransport::GetMaxSendBatchCount()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return max_send_batch_count;
+}
+
+void LocalTransport::SetMaxSendBatchCount(int32_t count)
+{
+    if (count < 1)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, -1, "Invalid MaxSendBatchCount: " << count);
+        throw InvalidArgumentException("Invalid maximum send batch count");
+    }
+    boost::mutex::scoped_lock lock(parameter_lock);
+    max_send_batch_count = count;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "MaxSendBatchCount set to " << count);
+}
+
+RR_SHARED_PTR<RRArrayAllocator> LocalTransport::GetReceiveArrayAllocator()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return receive_array_allocator;
+}
+
+void LocalTransport::SetReceiveArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    receive_array_allocator = allocator;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "ReceiveArrayAllocator set");
+}
+
 void LocalTransport::EnableNodeDiscoveryListening()
 {
     boost::mutex::scoped_lock lock(discovery_lock);
@@ -1284,6 +1335,13 @@ LocalTransportConnection::LocalTransportConnection(const RR_SHARED_PTR<LocalTran
     this->disable_message4 = parent->GetDisableMessage4();
     this->disable_string_table = parent->GetDisableStringTable();
     this->disable_async_io = parent->GetDisableAsyncMessageIO();
+    this->max_send_batch_size = boost::numeric_cast<size_t>(parent->GetMaxSendBatchSize());
+    this->max_send_batch_count = boost::numeric_cast<size_t>(parent->GetMaxSendBatchCount());
+    RR_SHARED_PTR<RRArrayAllocator> receive_array_allocator = parent->GetReceiveArrayAllocator();
+    if (receive_array_allocator)
+    {
+        async_reader->SetArrayAllocator(receive_array_allocator);
+    }
 }
 
 void LocalTransportConnection::AsyncAttachSocket(
@@ -1375,12 +1433,8 @@ void LocalTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>&
 
     try
     {
-        std::string connecturl = "rr+local:///";
-        // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-        Transport::m_CurrentThreadTransportConnectionURL.reset(new std::string(RR_MOVE(connecturl)));
-        Transport::m_CurrentThreadTransport.reset(new RR_SHARED_PTR<ITransportConnection>(
-            RR_STATIC_POINTER_CAST<LocalTransportConnection>(shared_from_this())));
-        // NOLINTEND(cppcoreguidelines-owning-memory)
+        Transport::SetCurrentThreadTransportContext(
+            "rr+local:///", RR_STATIC_POINTER_CAST<LocalTransportConnection>(shared_from_this()));
         p->MessageReceived(m);
     }
     catch (std::exception& exp)
@@ -1391,8 +1445,7 @@ void LocalTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>&
         Close();
     }
 
-    Transport::m_CurrentThreadTransportConnectionURL.reset(0);
-    Transport::m_CurrentThreadTransport.reset(0);
+    Transport::ClearCurrentThreadTransportContext();
 }
 
 void LocalTransportConnection::async_write_some(
@@ -73,6 +73,244 @@ ROBOTRACONTEUR_CORE_API void CalculateMatrixBlocks(uint32_t element_size, std::v
     block_count_edge = block_count;
     block_count_edge[split_dim] = count[split_dim] % split_dim_block;
 }
+
+// Sends the block requests of a chunked memory transfer, keeping up to window requests in flight.
+// Responses are passed to process_response as they arrive, in any order.
+class MemoryClient_transfer : public RR_ENABLE_SHARED_FROM_THIS<MemoryClient_transfer>, private boost::noncopyable
+{
+  public:
+    boost::function<RR_INTRUSIVE_PTR<MessageEntry>(size_t)> create_request;
+    boost::function<void(size_t, const RR_INTRUSIVE_PTR<MessageEntry>&)> process_response;
+
+    MemoryClient_transfer(const RR_SHARED_PTR<ServiceStub>& stub, uint32_t window, int32_t timeout,
+                          const RR_SHARED_PTR<void>& buffer_storage,
+                          RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+        : stub(stub), node(stub->RRGetNode()), buffer_storage(buffer_storage), handler(RR_MOVE(handler)),
+          block_count(0), window(window), timeout(timeout), next_block(0), in_flight(0), completed(false)
+    {}
+
+    void Start(size_t block_count)
+    {
+        {
+            boost::mutex::scoped_lock lock(this_lock);
+            this->block_count = block_count;
+        }
+        SendRequests();
+    }
+
+    void Fail(const RR_SHARED_PTR<RobotRaconteurException>& err)
+    {
+        {
+            boost::mutex::scoped_lock lock(this_lock);
+            if (completed)
+            {
+                return;
+            }
+            completed = true;
+        }
+        detail::InvokeHandlerWithException(node, handler, err);
+    }
+
+  protected:
+    RR_SHARED_PTR<ServiceStub> stub;
+    RR_WEAK_PTR<RobotRaconteurNode> node;
+    RR_SHARED_PTR<void> buffer_storage;
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> handler;
+    size_t block_count;
+    uint32_t window;
+    int32_t timeout;
+
+    boost::mutex this_lock;
+    size_t next_block;
+    uint32_t in_flight;
+    bool completed;
+    RR_SHARED_PTR<RobotRaconteurException> err;
+
+    void SendRequests()
+    {
+        while (true)
+        {
+            size_t block = 0;
+            {
+                boost::mutex::scoped_lock lock(this_lock);
+                if (err || next_block >= block_count || in_flight >= window)
+                {
+                    break;
+                }
+                block = next_block++;
+                in_flight++;
+            }
+
+            try
+            {
+                RR_INTRUSIVE_PTR<MessageEntry> m = create_request(block);
+                stub->AsyncProcessRequest(m,
+                                          boost::bind(&MemoryClient_transfer::EndRequest, shared_from_this(), block,
+                                                      RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2)),
+                                          timeout);
+            }
+            catch (std::exception& exp)
+            {
+                boost::mutex::scoped_lock lock(this_lock);
+                in_flight--;
+                if (!err)
+                {
+                    err = RobotRaconteurExceptionUtil::ExceptionToSharedPtr(exp);
+                }
+            }
+        }
+
+        CheckComplete();
+    }
+
+    void EndRequest(size_t block, const RR_INTRUSIVE_PTR<MessageEntry>& ret,
+                    const RR_SHARED_PTR<RobotRaconteurException>& err1)
+    {
+        RR_SHARED_PTR<RobotRaconteurException> err2 = err1;
+        if (!err2)
+        {
+            try
+            {
+                if (process_response)
+                {
+                    process_response(block, ret);
+                }
+            }
+            catch (std::exception& exp)
+            {
+                err2 = RobotRaconteurExceptionUtil::ExceptionToSharedPtr(exp);
+            }
+        }
+
+        {
+            boost::mutex::scoped_lock lock(this_lock);
+            in_flight--;
+            if (err2 && !err)
+            {
+                err = err2;
+            }
+        }
+
+        SendRequests();
+    }
+
+    void CheckComplete()
+    {
+        RR_SHARED_PTR<RobotRaconteurException> err1;
+        {
+            boost::mutex::scoped_lock lock(this_lock);
+            if (completed || in_flight > 0 || (!err && next_block < block_count))
+            {
+                return;
+            }
+            completed = true;
+            err1 = err;
+        }
+
+        if (err1)
+        {
+            detail::InvokeHandlerWithException(node, handler, err1);
+        }
+        else
+        {
+            detail::InvokeHandler(node, handler);
+        }
+    }
+};
+
+static std::vector<MultiDimArrayMemoryClient_block> MultiDimArrayMemoryClient_CalculateBlocks(
+    size_t element_size, const std::vector<uint64_t>& memorypos, const std::vector<uint64_t>& bufferpos,
+    const std::vector<uint64_t>& count, uint64_t max_elems)
+{
+    std::vector<MultiDimArrayMemoryClient_block> blocks;
+
+    uint32_t split_dim = 0;
+    uint64_t split_dim_block = 0;
+    uint64_t split_elem_count = 0;
+    uint32_t splits_count = 0;
+    uint32_t split_remainder = 0;
+    std::vector<uint64_t> block_count;
+    std::vector<uint64_t> block_count_edge;
+
+    CalculateMatrixBlocks(boost::numeric_cast<uint32_t>(element_size), count, max_elems, split_dim, split_dim_block,
+                          split_elem_count, splits_count, split_remainder, block_count, block_count_edge);
+
+    uint64_t block_elemcount = 1;
+    uint64_t block_elemcount_edge = 1;
+    for (size_t i = 0; i < count.size(); i++)
+    {
+        block_elemcount *= block_count[i];
+        block_elemcount_edge *= block_count_edge[i];
+    }
+
+    bool done = false;
+    std::vector<uint64_t> current_pos = std::vector<uint64_t>(count.size());
+
+    while (!done)
+    {
+        for (uint32_t i = 0; i <= splits_count; i++)
+        {
+            if (i == splits_count && split_remainder == 0)
+            {
+                break;
+            }
+
+            current_pos[split_dim] = split_dim_block * boost::numeric_cast<uint64_t>(i);
+
+            MultiDimArrayMemoryClient_block b;
+            b.bufferpos.resize(bufferpos.size());
+            b.memorypos.resize(bufferpos.size());
+            for (size_t j = 0; j < bufferpos.size(); j++)
+            {
+                b.bufferpos[j] = current_pos[j] + bufferpos[j];
+                b.memorypos[j] = current_pos[j] + memorypos[j];
+            }
+
+            if (i < splits_count)
+            {
+                b.count = block_count;
+                b.elemcount = block_elemcount;
+            }
+            else
+            {
+                b.count = block_count_edge;
+                b.elemcount = block_elemcount_edge;
+            }
+            blocks.push_back(RR_MOVE(b));
+        }
+
+        if (split_dim == boost::numeric_cast<uint32_t>(count.size() - 1))
+        {
+            done = true;
+        }
+        else
+        {
+            current_pos[split_dim + 1]++;
+            if (current_pos[split_dim + 1] >= count[split_dim + 1])
+            {
+                if (split_dim + 1 == boost::numeric_cast<uint32_t>(count.size() - 1))
+                {
+                    done = true;
+                }
+                else
+                {
+                    current_pos[split_dim + 1] = 0;
+                    for (size_t j = split_dim + 2; j < count.size(); j++)
+                    {
+                        if (current_pos[j - 1] >= count[j - 1])
+                        {
+                            current_pos[j]++;
+                        }
+                    }
+                    if (current_pos[count.size() - 1] >= count[count.size() - 1])
+                        done = true;
+                }
+            }
+        }
+    }
+
+    return blocks;
+}
 } // namespace detail
 
 RR_SHARED_PTR<RobotRaconteurNode> ArrayMemoryServiceSkelBase::GetNode()
@@ -388,6 +626,23 @@ uint64_t ArrayMemoryClientBase::Length()
 
 RobotRaconteur::MemberDefinition_Direction ArrayMemoryClientBase::Direction() { return direction; }
 
+uint32_t ArrayMemoryClientBase::NegotiateMaxTransferSize()
+{
+    uint32_t my_max_size = GetNode()->GetMemoryMaxTransferSize();
+    if (remote_max_size > my_max_size)
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Negotiated MaxTransferSize: " << my_max_size << " bytes");
+        return my_max_size;
+    }
+    else
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Negotiated MaxTransferSize: " << remote_max_size << " bytes");
+        return remote_max_size;
+    }
+}
+
 uint32_t ArrayMemoryClientBase::GetMaxTransferSize()
 {
 
@@ -402,21 +657,169 @@ uint32_t ArrayMemoryClientBase::GetMaxTransferSize()
             m->AddElement("parameter", stringToRRArray("MaxTransferSize"));
             RR_INTRUSIVE_PTR<MessageEntry> ret = GetStub()->ProcessRequest(m);
             remote_max_size = RRArrayToScalar(ret->FindElement("return")->CastData<RRArray<uint32_t> >());
+            max_size_read = true;
         }
-        uint32_t my_max_size = GetNode()->GetMemoryMaxTransferSize();
-        if (remote_max_size > my_max_size)
-        {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Negotiated MaxTransferSize: " << my_max_size << " bytes");
-            return my_max_size;
-        }
-        else
+        return NegotiateMaxTransferSize();
+    }
+}
+
+void ArrayMemoryClientBase::AsyncGetMaxTransferSize(
+    RR_MOVE_ARG(boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+{
+    {
+        boost::mutex::scoped_lock lock(max_size_lock);
+        if (max_size_read)
         {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Negotiated MaxTransferSize: " << remote_max_size << " bytes");
-            return remote_max_size;
+            uint32_t max_size = NegotiateMaxTransferSize();
+            lock.unlock();
+            detail::InvokeHandler(node, handler, max_size);
+            return;
         }
     }
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Requesting memory service MaxTransferSize");
+    RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_MemoryGetParam, GetMemberName());
+    m->AddElement("parameter", stringToRRArray("MaxTransferSize"));
+    // The stub owns this memory client, so holding the stub keeps this client alive
+    RR_SHARED_PTR<ServiceStub> stub1 = GetStub();
+    stub1->AsyncProcessRequest(m, boost::bind(&ArrayMemoryClientBase::EndGetMaxTransferSize, this,
+                                              RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), stub1,
+                                              RR_MOVE(handler)));
+}
+
+void ArrayMemoryClientBase::EndGetMaxTransferSize(
+    const RR_INTRUSIVE_PTR<MessageEntry>& ret, const RR_SHARED_PTR<RobotRaconteurException>& err,
+    const RR_SHARED_PTR<ServiceStub>& stub,
+    const boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(stub);
+    if (err)
+    {
+        detail::InvokeHandlerWithException(node, handler, err);
+        return;
+    }
+
+    uint32_t max_size = 0;
+    try
+    {
+        boost::mutex::scoped_lock lock(max_size_lock);
+        remote_max_size = RRArrayToScalar(ret->FindElement("return")->CastData<RRArray<uint32_t> >());
+        max_size_read = true;
+        max_size = NegotiateMaxTransferSize();
+    }
+    catch (std::exception& exp)
+    {
+        detail::InvokeHandlerWithException(node, handler, exp);
+        return;
+    }
+
+    detail::InvokeHandler(node, handler, max_size);
+}
+
+RR_INTRUSIVE_PTR<MessageEntry> ArrayMemoryClientBase::CreateReadRequest(uint64_t memorypos, uint64_t max_elems,
+                                                                        uint64_t count, size_t block)
+{
+    uint64_t block_pos = max_elems * block;
+    uint64_t block_count = std::min(max_elems, count - block_pos);
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Requesting memory read block " << block << " with " << block_count
+                                                                            << " elements");
+    RR_INTRUSIVE_PTR<MessageEntry> e = CreateMessageEntry(MessageEntryType_MemoryRead, GetMemberName());
+    e->AddElement("memorypos", ScalarToRRArray(memorypos + block_pos));
+    e->AddElement("count", ScalarToRRArray(block_count));
+    return e;
+}
+
+void ArrayMemoryClientBase::ProcessReadResponse(void* buffer, uint64_t bufferpos, uint64_t max_elems, uint64_t count,
+                                                size_t block, const RR_INTRUSIVE_PTR<MessageEntry>& ret)
+{
+    uint64_t block_pos = max_elems * block;
+    uint64_t block_count = std::min(max_elems, count - block_pos);
+    UnpackReadResult(ret->FindElement("data")->CastData<MessageElementData>(), buffer, bufferpos + block_pos,
+                     block_count);
+}
+
+RR_INTRUSIVE_PTR<MessageEntry> ArrayMemoryClientBase::CreateWriteRequest(uint64_t memorypos, const void* buffer,
+                                                                         uint64_t bufferpos, uint64_t max_elems,
+                                                                         uint64_t count, size_t block)
+{
+    uint64_t block_pos = max_elems * block;
+    uint64_t block_count = std::min(max_elems, count - block_pos);
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Requesting memory write block " << block << " with " << block_count
+                                                                             << " elements");
+    RR_INTRUSIVE_PTR<MessageEntry> e = CreateMessageEntry(MessageEntryType_MemoryWrite, GetMemberName());
+    e->AddElement("memorypos", ScalarToRRArray(memorypos + block_pos));
+    e->AddElement("count", ScalarToRRArray(block_count));
+    e->AddElement("data", PackWriteRequest(buffer, bufferpos + block_pos, block_count));
+    return e;
+}
+
+void ArrayMemoryClientBase::StartReadTransfer(uint32_t max_transfer_size,
+                                              const RR_SHARED_PTR<RobotRaconteurException>& err,
+                                              const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer,
+                                              uint64_t memorypos, void* buffer, uint64_t bufferpos, uint64_t count)
+{
+    if (err)
+    {
+        transfer->Fail(err);
+        return;
+    }
+
+    try
+    {
+        uint64_t max_elems = boost::numeric_cast<uint64_t>(max_transfer_size / element_size);
+        size_t blocks = boost::numeric_cast<size_t>((count + max_elems - 1) / max_elems);
+
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Memory read of " << count << " elements in " << blocks << " blocks");
+
+        transfer->create_request = boost::bind(&ArrayMemoryClientBase::CreateReadRequest, this, memorypos,
+                                               max_elems, count, RR_BOOST_PLACEHOLDERS(_1));
+        transfer->process_response =
+            boost::bind(&ArrayMemoryClientBase::ProcessReadResponse, this, buffer, bufferpos, max_elems, count,
+                        RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2));
+        transfer->Start(blocks);
+    }
+    catch (std::exception& exp)
+    {
+        transfer->Fail(RobotRaconteurExceptionUtil::ExceptionToSharedPtr(exp));
+    }
+}
+
+void ArrayMemoryClientBase::StartWriteTransfer(uint32_t max_transfer_size,
+                                               const RR_SHARED_PTR<RobotRaconteurException>& err,
+                                               const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer,
+                                               uint64_t memorypos, const void* buffer, uint64_t bufferpos,
+                                               uint64_t count)
+{
+    if (err)
+    {
+        transfer->Fail(err);
+        return;
+    }
+
+    try
+    {
+        if ((boost::numeric_cast<int64_t>(GetBufferLength(buffer)) - boost::numeric_cast<int64_t>(bufferpos)) <
+            boost::numeric_cast<int64_t>(count))
+            throw OutOfRangeException("Invalid buffer length");
+
+        uint64_t max_elems = boost::numeric_cast<uint64_t>(max_transfer_size / element_size);
+        size_t blocks = boost::numeric_cast<size_t>((count + max_elems - 1) / max_elems);
+
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Memory write of " << count << " elements in " << blocks << " blocks");
+
+        transfer->create_request = boost::bind(&ArrayMemoryClientBase::CreateWriteRequest, this, memorypos,
+                                               buffer, bufferpos, max_elems, count, RR_BOOST_PLACEHOLDERS(_1));
+        transfer->Start(blocks);
+    }
+    catch (std::exception& exp)
+    {
+        transfer->Fail(RobotRaconteurExceptionUtil::ExceptionToSharedPtr(exp));
+    }
 }
 
 void ArrayMemoryClientBase::ReadBase(uint64_t memorypos, void* buffer, uint64_t bufferpos, uint64_t count)
@@ -455,31 +858,16 @@ void ArrayMemoryClientBase::ReadBase(uint64_t memorypos, void* buffer, uint64_t
     }
     else
     {
-        uint64_t blocks = count / boost::numeric_cast<uint64_t>(max_elems);
-        uint64_t blockrem = count % boost::numeric_cast<uint64_t>(max_elems);
-
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                "Memory read request too large, reading in " << blocks << " blocks");
-
-        for (uint64_t i = 0; i < blocks; i++)
-        {
-            uint64_t bufferpos_i = bufferpos + max_elems * i;
-            uint64_t memorypos_i = memorypos + max_elems * i;
-
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Memory read block " << i);
-            ReadBase(memorypos_i, buffer, bufferpos_i, max_elems);
-        }
-
-        if (blockrem > 0)
-        {
-            uint64_t bufferpos_i = bufferpos + max_elems * blocks;
-            uint64_t memorypos_i = memorypos + max_elems * blocks;
+                                                "Memory read request too large, reading in blocks");
 
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Memory read block remaining");
-            ReadBase(memorypos_i, buffer, bufferpos_i, blockrem);
-        }
+        RR_SHARED_PTR<detail::sync_async_handler<void> > h = RR_MAKE_SHARED<detail::sync_async_handler<void> >();
+        RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+            GetStub(), GetNode()->GetMemoryMaxTransferWindow(), GetNode()->GetRequestTimeout(), RR_SHARED_PTR<void>(),
+            boost::bind(&detail::sync_async_handler<void>::operator(), h, RR_BOOST_PLACEHOLDERS(_1)));
+        StartReadTransfer(max_transfer_size, RR_SHARED_PTR<RobotRaconteurException>(), transfer, memorypos, buffer,
+                          bufferpos, count);
+        h->end_void();
     }
 }
 
@@ -522,36 +910,56 @@ void ArrayMemoryClientBase::WriteBase(uint64_t memorypos, const void* buffer, ui
     }
     else
     {
-        if ((boost::numeric_cast<int64_t>(GetBufferLength(buffer)) - boost::numeric_cast<int64_t>(bufferpos)) <
-            boost::numeric_cast<int64_t>(count))
-            throw OutOfRangeException("Invalid buffer length");
-
-        uint64_t blocks = count / boost::numeric_cast<uint64_t>(max_elems);
-        uint64_t blockrem = count % boost::numeric_cast<uint64_t>(max_elems);
-
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                "Memory write request too large, writing in " << blocks << " blocks");
-
-        for (uint64_t i = 0; i < blocks; i++)
-        {
-            uint64_t bufferpos_i = bufferpos + max_elems * i;
-            uint64_t memorypos_i = memorypos + max_elems * i;
+                                                "Memory write request too large, writing in blocks");
+
+        RR_SHARED_PTR<detail::sync_async_handler<void> > h = RR_MAKE_SHARED<detail::sync_async_handler<void> >();
+        RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+            GetStub(), GetNode()->GetMemoryMaxTransferWindow(), GetNode()->GetRequestTimeout(), RR_SHARED_PTR<void>(),
+            boost::bind(&detail::sync_async_handler<void>::operator(), h, RR_BOOST_PLACEHOLDERS(_1)));
+        StartWriteTransfer(max_transfer_size, RR_SHARED_PTR<RobotRaconteurException>(), transfer, memorypos, buffer,
+                           bufferpos, count);
+        h->end_void();
+    }
+}
 
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Memory write block " << i);
-            WriteBase(memorypos_i, buffer, bufferpos_i, max_elems);
-        }
+void ArrayMemoryClientBase::AsyncReadBase(
+    uint64_t memorypos, void* buffer, const RR_SHARED_PTR<void>& buffer_storage, uint64_t bufferpos, uint64_t count,
+    RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler, int32_t timeout)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Begin async memory read with " << count << " elements");
+    if (direction == MemberDefinition_Direction_writeonly)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Attempt to read a write only memory");
+        throw WriteOnlyMemberException("Write only member");
+    }
 
-        if (blockrem > 0)
-        {
-            uint64_t bufferpos_i = bufferpos + max_elems * blocks;
-            uint64_t memorypos_i = memorypos + max_elems * blocks;
+    RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+        GetStub(), GetNode()->GetMemoryMaxTransferWindow(), timeout, buffer_storage, RR_MOVE(handler));
+    AsyncGetMaxTransferSize(boost::bind(&ArrayMemoryClientBase::StartReadTransfer, this, RR_BOOST_PLACEHOLDERS(_1),
+                                        RR_BOOST_PLACEHOLDERS(_2), transfer, memorypos, buffer, bufferpos, count));
+}
 
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Memory write block remaining");
-            WriteBase(memorypos_i, buffer, bufferpos_i, blockrem);
-        }
+void ArrayMemoryClientBase::AsyncWriteBase(
+    uint64_t memorypos, const void* buffer, const RR_SHARED_PTR<void>& buffer_storage, uint64_t bufferpos,
+    uint64_t count, RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler,
+    int32_t timeout)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Begin async memory write with " << count << " elements");
+    if (direction == MemberDefinition_Direction_readonly)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Attempt to write a read only memory");
+        throw ReadOnlyMemberException("Read only member");
     }
+
+    RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+        GetStub(), GetNode()->GetMemoryMaxTransferWindow(), timeout, buffer_storage, RR_MOVE(handler));
+    AsyncGetMaxTransferSize(boost::bind(&ArrayMemoryClientBase::StartWriteTransfer, this, RR_BOOST_PLACEHOLDERS(_1),
+                                        RR_BOOST_PLACEHOLDERS(_2), transfer, memorypos, buffer, bufferpos, count));
 }
 
 void ArrayMemoryClientBase::Shutdown() {}
@@ -618,6 +1026,23 @@ uint64_t MultiDimArrayMemoryClientBase::DimCount()
     return RRArrayToScalar(ret->FindElement("return")->CastData<RRArray<uint64_t> >());
 }
 
+uint32_t MultiDimArrayMemoryClientBase::NegotiateMaxTransferSize()
+{
+    uint32_t my_max_size = GetNode()->GetMemoryMaxTransferSize();
+    if (remote_max_size > my_max_size)
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Negotiated MaxTransferSize: " << my_max_size << " bytes");
+        return my_max_size;
+    }
+    else
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Negotiated MaxTransferSize: " << remote_max_size << " bytes");
+        return remote_max_size;
+    }
+}
+
 uint32_t MultiDimArrayMemoryClientBase::GetMaxTransferSize()
 {
     {
@@ -630,21 +1055,64 @@ uint32_t MultiDimArrayMemoryClientBase::GetMaxTransferSize()
             m->AddElement("parameter", stringToRRArray("MaxTransferSize"));
             RR_INTRUSIVE_PTR<MessageEntry> ret = GetStub()->ProcessRequest(m);
             remote_max_size = RRArrayToScalar(ret->FindElement("return")->CastData<RRArray<uint32_t> >());
+            max_size_read = true;
         }
-        uint32_t my_max_size = GetNode()->GetMemoryMaxTransferSize();
-        if (remote_max_size > my_max_size)
-        {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Negotiated MaxTransferSize: " << my_max_size << " bytes");
-            return my_max_size;
-        }
-        else
+        return NegotiateMaxTransferSize();
+    }
+}
+
+void MultiDimArrayMemoryClientBase::AsyncGetMaxTransferSize(
+    RR_MOVE_ARG(boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+{
+    {
+        boost::mutex::scoped_lock lock(max_size_lock);
+        if (max_size_read)
         {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                    "Negotiated MaxTransferSize: " << remote_max_size << " bytes");
-            return remote_max_size;
+            uint32_t max_size = NegotiateMaxTransferSize();
+            lock.unlock();
+            detail::InvokeHandler(node, handler, max_size);
+            return;
         }
     }
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Requesting memory service MaxTransferSize");
+    RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_MemoryGetParam, GetMemberName());
+    m->AddElement("parameter", stringToRRArray("MaxTransferSize"));
+    // The stub owns this memory client, so holding the stub keeps this client alive
+    RR_SHARED_PTR<ServiceStub> stub1 = GetStub();
+    stub1->AsyncProcessRequest(m, boost::bind(&MultiDimArrayMemoryClientBase::EndGetMaxTransferSize, this,
+                                              RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), stub1,
+                                              RR_MOVE(handler)));
+}
+
+void MultiDimArrayMemoryClientBase::EndGetMaxTransferSize(
+    const RR_INTRUSIVE_PTR<MessageEntry>& ret, const RR_SHARED_PTR<RobotRaconteurException>& err,
+    const RR_SHARED_PTR<ServiceStub>& stub,
+    const boost::function<void(const uint32_t&, const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(stub);
+    if (err)
+    {
+        detail::InvokeHandlerWithException(node, handler, err);
+        return;
+    }
+
+    uint32_t max_size = 0;
+    try
+    {
+        boost::mutex::scoped_lock lock(max_size_lock);
+        remote_max_size = RRArrayToScalar(ret->FindElement("return")->CastData<RRArray<uint32_t> >());
+        max_size_read = true;
+        max_size = NegotiateMaxTransferSize();
+    }
+    catch (std::exception& exp)
+    {
+        detail::InvokeHandlerWithException(node, handler, exp);
+        return;
+    }
+
+    detail::InvokeHandler(node, handler, max_size);
 }
 
 static std::string std_vec_uint64_t_to_string(const std::vector<uint64_t>& v)
@@ -652,6 +1120,113 @@ static std::string std_vec_uint64_t_to_string(const std::vector<uint64_t>& v)
     return boost::join(v | boost::adaptors::transformed(boost::lexical_cast<std::string, uint64_t>), ",");
 }
 
+RR_INTRUSIVE_PTR<MessageEntry> MultiDimArrayMemoryClientBase::CreateReadRequest(
+    const RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> >& blocks, size_t block)
+{
+    const detail::MultiDimArrayMemoryClient_block& b = blocks->at(block);
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Requesting memory read block " << block << " with "
+                                                                            << std_vec_uint64_t_to_string(b.count)
+                                                                            << " count");
+    RR_INTRUSIVE_PTR<MessageEntry> e = CreateMessageEntry(MessageEntryType_MemoryRead, GetMemberName());
+    e->AddElement("memorypos", VectorToRRArray<uint64_t>(b.memorypos));
+    e->AddElement("count", VectorToRRArray<uint64_t>(b.count));
+    return e;
+}
+
+void MultiDimArrayMemoryClientBase::ProcessReadResponse(
+    void* buffer, const RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> >& blocks, size_t block,
+    const RR_INTRUSIVE_PTR<MessageEntry>& ret)
+{
+    const detail::MultiDimArrayMemoryClient_block& b = blocks->at(block);
+    UnpackReadResult(ret->FindElement("data")->CastData<MessageElementData>(), buffer, b.bufferpos, b.count,
+                     b.elemcount);
+}
+
+RR_INTRUSIVE_PTR<MessageEntry> MultiDimArrayMemoryClientBase::CreateWriteRequest(
+    const void* buffer, const RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> >& blocks,
+    size_t block)
+{
+    const detail::MultiDimArrayMemoryClient_block& b = blocks->at(block);
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Requesting memory write block " << block << " with "
+                                                                             << std_vec_uint64_t_to_string(b.count)
+                                                                             << " count");
+    RR_INTRUSIVE_PTR<MessageEntry> e = CreateMessageEntry(MessageEntryType_MemoryWrite, GetMemberName());
+    e->AddElement("memorypos", VectorToRRArray<uint64_t>(b.memorypos));
+    e->AddElement("count", VectorToRRArray<uint64_t>(b.count));
+    e->AddElement("data", PackWriteRequest(buffer, b.bufferpos, b.count, b.elemcount));
+    return e;
+}
+
+void MultiDimArrayMemoryClientBase::StartReadTransfer(
+    uint32_t max_transfer_size, const RR_SHARED_PTR<RobotRaconteurException>& err,
+    const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer, const std::vector<uint64_t>& memorypos,
+    void* buffer, const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count)
+{
+    if (err)
+    {
+        transfer->Fail(err);
+        return;
+    }
+
+    try
+    {
+        uint64_t max_elems = boost::numeric_cast<uint64_t>(max_transfer_size / element_size);
+        RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> > blocks =
+            RR_MAKE_SHARED<std::vector<detail::MultiDimArrayMemoryClient_block> >(
+                detail::MultiDimArrayMemoryClient_CalculateBlocks(element_size, memorypos, bufferpos, count,
+                                                                  max_elems));
+
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Memory read of " << std_vec_uint64_t_to_string(count) << " count in "
+                                                                  << blocks->size() << " blocks");
+
+        transfer->create_request = boost::bind(&MultiDimArrayMemoryClientBase::CreateReadRequest, this, blocks,
+                                               RR_BOOST_PLACEHOLDERS(_1));
+        transfer->process_response = boost::bind(&MultiDimArrayMemoryClientBase::ProcessReadResponse, this, buffer,
+                                                 blocks, RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2));
+        transfer->Start(blocks->size());
+    }
+    catch (std::exception& exp)
+    {
+        transfer->Fail(RobotRaconteurExceptionUtil::ExceptionToSharedPtr(exp));
+    }
+}
+
+void MultiDimArrayMemoryClientBase::StartWriteTransfer(
+    uint32_t max_transfer_size, const RR_SHARED_PTR<RobotRaconteurException>& err,
+    const RR_SHARED_PTR<detail::MemoryClient_transfer>& transfer, const std::vector<uint64_t>& memorypos,
+    const void* buffer, const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count)
+{
+    if (err)
+    {
+        transfer->Fail(err);
+        return;
+    }
+
+    try
+    {
+        uint64_t max_elems = boost::numeric_cast<uint64_t>(max_transfer_size / element_size);
+        RR_SHARED_PTR<std::vector<detail::MultiDimArrayMemoryClient_block> > blocks =
+            RR_MAKE_SHARED<std::vector<detail::MultiDimArrayMemoryClient_block> >(
+                detail::MultiDimArrayMemoryClient_CalculateBlocks(element_size, memorypos, bufferpos, count,
+                                                                  max_elems));
+
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Memory write of " << std_vec_uint64_t_to_string(count)
+                                                                   << " count in " << blocks->size() << " blocks");
+
+        transfer->create_request = boost::bind(&MultiDimArrayMemoryClientBase::CreateWriteRequest, this, buffer,
+                                               blocks, RR_BOOST_PLACEHOLDERS(_1));
+        transfer->Start(blocks->size());
+    }
+    catch (std::exception& exp)
+    {
+        transfer->Fail(RobotRaconteurExceptionUtil::ExceptionToSharedPtr(exp));
+    }
+}
+
 void MultiDimArrayMemoryClientBase::ReadBase(const std::vector<uint64_t>& memorypos, void* buffer,
                                              const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count)
 {
@@ -696,87 +1271,16 @@ void MultiDimArrayMemoryClientBase::ReadBase(const std::vector<uint64_t>& memory
     }
     else
     {
-        // We need to read the array in chunks.  This is a little complicated...
-
-        uint32_t split_dim = 0;
-        uint64_t split_dim_block = 0;
-        uint64_t split_elem_count = 0;
-        uint32_t splits_count = 0;
-        uint32_t split_remainder = 0;
-        std::vector<uint64_t> block_count;
-        std::vector<uint64_t> block_count_edge;
-
-        detail::CalculateMatrixBlocks(element_size, count, max_elems, split_dim, split_dim_block, split_elem_count,
-                                      splits_count, split_remainder, block_count, block_count_edge);
-
-        bool done = false;
-        std::vector<uint64_t> current_pos = std::vector<uint64_t>(count.size());
-
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
                                                 "Memory read request too large, reading in blocks");
 
-        while (!done)
-        {
-            for (uint32_t i = 0; i < splits_count; i++)
-            {
-                current_pos[split_dim] = split_dim_block * boost::numeric_cast<uint64_t>(i);
-
-                std::vector<uint64_t> current_buf_pos = std::vector<uint64_t>(bufferpos.size());
-                std::vector<uint64_t> current_mem_pos = std::vector<uint64_t>(bufferpos.size());
-
-                for (size_t j = 0; j < current_buf_pos.size(); j++)
-                {
-                    current_buf_pos[j] = current_pos[j] + bufferpos[j];
-                    current_mem_pos[j] = current_pos[j] + memorypos[j];
-                }
-
-                ReadBase(current_mem_pos, buffer, current_buf_pos, block_count);
-            }
-
-            if (split_remainder != 0)
-            {
-                current_pos[split_dim] = split_dim_block * boost::numeric_cast<uint64_t>(splits_count);
-                std::vector<uint64_t> current_buf_pos = std::vector<uint64_t>(bufferpos.size());
-                std::vector<uint64_t> current_mem_pos = std::vector<uint64_t>(bufferpos.size());
-
-                for (size_t j = 0; j < current_buf_pos.size(); j++)
-                {
-                    current_buf_pos[j] = current_pos[j] + bufferpos[j];
-                    current_mem_pos[j] = current_pos[j] + memorypos[j];
-                }
-
-                ReadBase(current_mem_pos, buffer, current_buf_pos, block_count_edge);
-            }
-
-            if (split_dim == boost::numeric_cast<uint32_t>(count.size() - 1))
-            {
-                done = true;
-            }
-            else
-            {
-                current_pos[split_dim + 1]++;
-                if (current_pos[split_dim + 1] >= count[split_dim + 1])
-                {
-                    if (split_dim + 1 == boost::numeric_cast<uint32_t>(count.size() - 1))
-                    {
-                        done = true;
-                    }
-                    else
-                    {
-                        current_pos[split_dim + 1] = 0;
-                        for (size_t j = split_dim + 2; j < count.size(); j++)
-                        {
-                            if (current_pos[j - 1] >= count[j - 1])
-                            {
-                                current_pos[j]++;
-                            }
-                        }
-                        if (current_pos[count.size() - 1] >= count[count.size() - 1])
-                            done = true;
-                    }
-                }
-            }
-        }
+        RR_SHARED_PTR<detail::sync_async_handler<void> > h = RR_MAKE_SHARED<detail::sync_async_handler<void> >();
+        RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+            GetStub(), GetNode()->GetMemoryMaxTransferWindow(), GetNode()->GetRequestTimeout(), RR_SHARED_PTR<void>(),
+            boost::bind(&detail::sync_async_handler<void>::operator(), h, RR_BOOST_PLACEHOLDERS(_1)));
+        StartReadTransfer(max_transfer_size, RR_SHARED_PTR<RobotRaconteurException>(), transfer, memorypos, buffer,
+                          bufferpos, count);
+        h->end_void();
     }
 }
 
@@ -826,86 +1330,61 @@ void MultiDimArrayMemoryClientBase::WriteBase(const std::vector<uint64_t>& memor
     }
     else
     {
-        uint32_t split_dim = 0;
-        uint64_t split_dim_block = 0;
-        uint64_t split_elem_count = 0;
-        uint32_t splits_count = 0;
-        uint32_t split_remainder = 0;
-        std::vector<uint64_t> block_count;
-        std::vector<uint64_t> block_count_edge;
-
-        detail::CalculateMatrixBlocks(element_size, count, max_elems, split_dim, split_dim_block, split_elem_count,
-                                      splits_count, split_remainder, block_count, block_count_edge);
-
-        bool done = false;
-        std::vector<uint64_t> current_pos = std::vector<uint64_t>(count.size());
-
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
-                                                "Memory write request too large, reading in blocks");
-
-        while (!done)
-        {
-            for (uint32_t i = 0; i < splits_count; i++)
-            {
-                current_pos[split_dim] = split_dim_block * boost::numeric_cast<uint64_t>(i);
-
-                std::vector<uint64_t> current_buf_pos = std::vector<uint64_t>(bufferpos.size());
-                std::vector<uint64_t> current_mem_pos = std::vector<uint64_t>(bufferpos.size());
-
-                for (size_t j = 0; j < current_buf_pos.size(); j++)
-                {
-                    current_buf_pos[j] = current_pos[j] + bufferpos[j];
-                    current_mem_pos[j] = current_pos[j] + memorypos[j];
-                }
-
-                WriteBase(current_mem_pos, buffer, current_buf_pos, block_count);
-            }
-
-            if (split_remainder != 0)
-            {
-                current_pos[split_dim] = split_dim_block * boost::numeric_cast<uint64_t>(splits_count);
-                std::vector<uint64_t> current_buf_pos(bufferpos.size());
-                std::vector<uint64_t> current_mem_pos(bufferpos.size());
+                                                "Memory write request too large, writing in blocks");
+
+        RR_SHARED_PTR<detail::sync_async_handler<void> > h = RR_MAKE_SHARED<detail::sync_async_handler<void> >();
+        RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+            GetStub(), GetNode()->GetMemoryMaxTransferWindow(), GetNode()->GetRequestTimeout(), RR_SHARED_PTR<void>(),
+            boost::bind(&detail::sync_async_handler<void>::operator(), h, RR_BOOST_PLACEHOLDERS(_1)));
+        StartWriteTransfer(max_transfer_size, RR_SHARED_PTR<RobotRaconteurException>(), transfer, memorypos, buffer,
+                           bufferpos, count);
+        h->end_void();
+    }
+}
 
-                for (size_t j = 0; j < current_buf_pos.size(); j++)
-                {
-                    current_buf_pos[j] = current_pos[j] + bufferpos[j];
-                    current_mem_pos[j] = current_pos[j] + memorypos[j];
-                }
+void MultiDimArrayMemoryClientBase::AsyncReadBase(
+    const std::vector<uint64_t>& memorypos, void* buffer, const RR_SHARED_PTR<void>& buffer_storage,
+    const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count,
+    RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler, int32_t timeout)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Begin async memory read with " << std_vec_uint64_t_to_string(count)
+                                                                            << " count");
+    if (direction == MemberDefinition_Direction_writeonly)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Attempt to read a write only memory");
+        throw WriteOnlyMemberException("Write only member");
+    }
 
-                WriteBase(current_mem_pos, buffer, current_buf_pos, block_count_edge);
-            }
+    RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+        GetStub(), GetNode()->GetMemoryMaxTransferWindow(), timeout, buffer_storage, RR_MOVE(handler));
+    AsyncGetMaxTransferSize(boost::bind(&MultiDimArrayMemoryClientBase::StartReadTransfer, this,
+                                        RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), transfer, memorypos,
+                                        buffer, bufferpos, count));
+}
 
-            if (split_dim == boost::numeric_cast<uint32_t>(count.size() - 1))
-            {
-                done = true;
-            }
-            else
-            {
-                current_pos[split_dim + 1]++;
-                if (current_pos[split_dim + 1] >= count[split_dim + 1])
-                {
-                    if (split_dim + 1 == boost::numeric_cast<uint32_t>(count.size() - 1))
-                    {
-                        done = true;
-                    }
-                    else
-                    {
-                        current_pos[split_dim + 1] = 0;
-                        for (size_t j = split_dim + 2; j < count.size(); j++)
-                        {
-                            if (current_pos[j - 1] >= count[j - 1])
-                            {
-                                current_pos[j]++;
-                            }
-                        }
-                        if (current_pos[count.size() - 1] >= count[count.size() - 1])
-                            done = true;
-                    }
-                }
-            }
-        }
+void MultiDimArrayMemoryClientBase::AsyncWriteBase(
+    const std::vector<uint64_t>& memorypos, const void* buffer, const RR_SHARED_PTR<void>& buffer_storage,
+    const std::vector<uint64_t>& bufferpos, const std::vector<uint64_t>& count,
+    RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>) handler, int32_t timeout)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                            "Begin async memory write with " << std_vec_uint64_t_to_string(count)
+                                                                             << " count");
+    if (direction == MemberDefinition_Direction_readonly)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Client, endpoint, service_path, m_MemberName,
+                                                "Attempt to write a read only memory");
+        throw ReadOnlyMemberException("Read only member");
     }
+
+    RR_SHARED_PTR<detail::MemoryClient_transfer> transfer = RR_MAKE_SHARED<detail::MemoryClient_transfer>(
+        GetStub(), GetNode()->GetMemoryMaxTransferWindow(), timeout, buffer_storage, RR_MOVE(handler));
+    AsyncGetMaxTransferSize(boost::bind(&MultiDimArrayMemoryClientBase::StartWriteTransfer, this,
+                                        RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), transfer, memorypos,
+                                        buffer, bufferpos, count));
 }
 
 void MultiDimArrayMemoryClientBase::Shutdown() {}
@@ -1028,6 +1028,7 @@ void MessageElement::SetData(const RR_INTRUSIVE_PTR<MessageElementData>& value)
     }
 
     ElementSize = std::numeric_limits<uint32_t>::max();
+    Encoded4.reset();
 }
 
 uint32_t MessageElement::ComputeSize()
@@ -1311,6 +1312,11 @@ void MessageElement::Read(ArrayBinaryReader& r)
 
 uint32_t MessageElement::ComputeSize4()
 {
+    if (Encoded4)
+    {
+        return boost::numeric_cast<uint32_t>(Encoded4->size());
+    }
+
     size_t s = 3;
 
     if (ElementFlags & MessageElementFlags_ELEMENT_NAME_STR)
@@ -1398,6 +1404,11 @@ uint32_t MessageElement::ComputeSize4()
 
 void MessageElement::UpdateData4()
 {
+    if (Encoded4)
+    {
+        ElementSize = boost::numeric_cast<uint32_t>(Encoded4->size());
+        return;
+    }
 
     std::string datatype;
     if (!dat)
@@ -1498,6 +1509,12 @@ void MessageElement::Write4(ArrayBinaryWriter& w)
 {
     UpdateData4();
 
+    if (Encoded4)
+    {
+        w.Write(Encoded4->data(), 0, Encoded4->size());
+        return;
+    }
+
     w.PushRelativeLimit(ElementSize);
 
     w.WriteUintX(ElementSize);
@@ -1577,6 +1594,17 @@ void MessageElement::Write4(ArrayBinaryWriter& w)
     w.PopLimit();
 }
 
+void MessageElement::Encode4()
+{
+    Encoded4.reset();
+    UpdateData4();
+
+    RR_INTRUSIVE_PTR<RRArray<uint8_t> > buf = AllocateRRArray<uint8_t>(ElementSize);
+    ArrayBinaryWriter w(buf->data(), 0, buf->size());
+    Write4(w);
+    Encoded4 = buf;
+}
+
 void MessageElement::Read4(ArrayBinaryReader& r)
 {
 
@@ -1881,6 +1909,15 @@ RR_INTRUSIVE_PTR<MessageElement> ShallowCopyMessageElement(const RR_INTRUSIVE_PT
     mm2->DataCount = mm->DataCount;
     mm2->Extended = mm->Extended;
 
+    if (mm->Encoded4)
+    {
+        // The nested elements are not written, so they can be shared
+        mm2->SetData(mm->GetData());
+        mm2->ElementSize = mm->ElementSize;
+        mm2->Encoded4 = mm->Encoded4;
+        return mm2;
+    }
+
     switch (mm->ElementType)
     {
 
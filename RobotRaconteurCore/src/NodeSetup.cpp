@@ -17,6 +17,25 @@ void RobotRaconteurNodeSetup::DoSetup(const RR_SHARED_PTR<RobotRaconteurNode>& n
         node->SetLogLevelFromString(log_level_str);
     }
 
+    int32_t thread_pool_shards = config->GetOptionOrDefaultAsInt("thread-pool-shards", 0);
+    if (thread_pool_shards > 0)
+    {
+        try
+        {
+            bool shard_affinity = config->GetOptionOrDefaultAsBool("thread-pool-shard-affinity", false);
+            node->SetThreadPoolFactory(RR_MAKE_SHARED<ShardedThreadPoolFactory>(
+                boost::numeric_cast<size_t>(thread_pool_shards), shard_affinity));
+            ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, NodeSetup, -1,
+                                              "Sharded thread pool configured with " << thread_pool_shards
+                                                                                     << " shards");
+        }
+        catch (std::exception& exp)
+        {
+            ROBOTRACONTEUR_LOG_ERROR_COMPONENT(node, NodeSetup, -1,
+                                               "Sharded thread pool configuration failed: " << exp.what());
+        }
+    }
+
     if (config->GetOptionOrDefaultAsBool("local-tap-enable"))
     {
         std::string tap_name = config->GetOptionOrDefaultAsString("local-tap-name");
@@ -632,6 +651,9 @@ void CommandLineConfigParser::FillOptionsDescription(boost::program_options::opt
     h.add<std::string>("local-tap-name", "name of local tap", RobotRaconteurNodeSetupFlags_LOCAL_TAP_NAME);
 
     h.add<bool>("jumbo-message", "enable jumbo messages (up to 100 MB)", RobotRaconteurNodeSetupFlags_JUMBO_MESSAGE);
+
+    h.add<int32_t>("thread-pool-shards", "number of thread pool shards, 0 for the default thread pool");
+    h.add<bool>("thread-pool-shard-affinity", "pin thread pool shard threads to CPU cores");
 }
 
 CommandLineConfigParser::CommandLineConfigParser(uint32_t allowed_overrides, const std::string& prefix)
@@ -58,6 +58,12 @@ PipeEndpointBase::PipeEndpointBase(const RR_SHARED_PTR<PipeBase>& parent, int32_
     send_packet_number = 0;
     recv_packet_number = 0;
 
+    send_window = 0;
+    send_credits = 0;
+    send_closed = false;
+    recv_window = 0;
+    recv_consumed = 0;
+
     this->index = index;
     this->parent = parent;
     this->endpoint = endpoint;
@@ -107,6 +113,8 @@ void PipeEndpointBase::AsyncClose(boost::function<void(const RR_SHARED_PTR<Robot
         recv_packets_wait.notify_all();
     }
 
+    AbortPendingSends();
+
     {
         boost::mutex::scoped_lock lock(sendlock);
         GetParent()->AsyncClose(shared_from_this(), false, endpoint, RR_MOVE(handler), timeout);
@@ -130,6 +138,8 @@ void PipeEndpointBase::RemoteClose()
         recv_packets_wait.notify_all();
     }
 
+    AbortPendingSends();
+
     RR_PIPE_ENDPOINT_LISTENER_ITER(p1->PipeEndpointClosed(shared_from_this()));
 
     try
@@ -150,6 +160,13 @@ void PipeEndpointBase::RemoteClose()
 void PipeEndpointBase::AsyncSendPacketBase(
     const RR_INTRUSIVE_PTR<RRValue>& packet,
     RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+{
+    AsyncSendPacketBase(packet, RR_INTRUSIVE_PTR<MessageElement>(), RR_MOVE(handler));
+}
+
+void PipeEndpointBase::AsyncSendPacketBase(
+    const RR_INTRUSIVE_PTR<RRValue>& packet, const RR_INTRUSIVE_PTR<MessageElement>& packet_element,
+    RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
 {
     if (direction == MemberDefinition_Direction_readonly)
     {
@@ -161,13 +178,30 @@ void PipeEndpointBase::AsyncSendPacketBase(
     try
     {
         boost::mutex::scoped_lock lock(sendlock);
-        send_packet_number = (send_packet_number < UINT_MAX) ? send_packet_number + 1 : 0;
+        if (send_window > 0)
+        {
+            if (send_closed)
+            {
+                throw InvalidOperationException("Pipe endpoint has been closed");
+            }
 
-        GetParent()->AsyncSendPipePacket(packet, index, send_packet_number, RequestPacketAck, endpoint, unreliable,
-                                         RR_MOVE(handler));
-        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
-                                                "Sent pipe packet " << send_packet_number << " pipe endpoint index "
-                                                                    << index);
+            // Packets wait in order for credits from the peer
+            if (send_credits == 0 || !send_pending.empty())
+            {
+                detail::PipeEndpointBase_pending_send p;
+                p.packet = packet;
+                p.packet_element = packet_element;
+                p.handler = RR_MOVE(handler);
+                send_pending.push_back(RR_MOVE(p));
+                ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                                        "Send window full, queued pipe packet for pipe endpoint index "
+                                                            << index);
+                return;
+            }
+            send_credits--;
+        }
+
+        DoAsyncSendPacketBase(packet, packet_element, RR_MOVE(handler));
     }
     catch (std::exception& exp)
     {
@@ -178,6 +212,27 @@ void PipeEndpointBase::AsyncSendPacketBase(
     }
 }
 
+void PipeEndpointBase::DoAsyncSendPacketBase(
+    const RR_INTRUSIVE_PTR<RRValue>& packet, const RR_INTRUSIVE_PTR<MessageElement>& packet_element,
+    RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+{
+    send_packet_number = (send_packet_number < UINT_MAX) ? send_packet_number + 1 : 0;
+
+    if (!packet_element)
+    {
+        GetParent()->AsyncSendPipePacket(packet, index, send_packet_number, RequestPacketAck, endpoint, unreliable,
+                                         RR_MOVE(handler));
+    }
+    else
+    {
+        GetParent()->AsyncSendPipePacketElement(packet_element, index, send_packet_number, RequestPacketAck, endpoint,
+                                                unreliable, RR_MOVE(handler));
+    }
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                            "Sent pipe packet " << send_packet_number << " pipe endpoint index "
+                                                                << index);
+}
+
 RR_INTRUSIVE_PTR<RRValue> PipeEndpointBase::ReceivePacketBase()
 {
     RR_INTRUSIVE_PTR<RRValue> o;
@@ -257,18 +312,25 @@ bool PipeEndpointBase::TryReceivePacketBaseWait(RR_INTRUSIVE_PTR<RRValue>& packe
     if (!peek)
     {
         recv_packets.pop_front();
+        uint32_t credits = ConsumeRecvCredits(1);
+        if (credits > 0)
+        {
+            lock.unlock();
+            SendRecvCredits(credits);
+        }
     }
     return true;
 }
 
 static bool PipeEndpointBase_PipePacketReceived_recvpacket(std::deque<RR_INTRUSIVE_PTR<RRValue> >& q,
-                                                           RR_INTRUSIVE_PTR<RRValue>& packet)
+                                                           uint32_t& consumed, RR_INTRUSIVE_PTR<RRValue>& packet)
 {
     std::deque<RR_INTRUSIVE_PTR<RRValue> >::iterator e = q.begin();
     if (e == q.end())
         return false;
     packet = *e;
     q.pop_front();
+    consumed++;
     return true;
 }
 
@@ -288,9 +350,11 @@ void PipeEndpointBase::PipePacketReceived(const RR_INTRUSIVE_PTR<RRValue>& packe
             return;
         recv_packets.push_back(packet);
 
+        // Unreliable endpoints do not use flow control
+        uint32_t consumed = 0;
         RR_PIPE_ENDPOINT_LISTENER_ITER(p1->PipePacketReceived(
             shared_from_this(), boost::bind(&PipeEndpointBase_PipePacketReceived_recvpacket, boost::ref(recv_packets),
-                                            RR_BOOST_PLACEHOLDERS(_1))));
+                                            boost::ref(consumed), RR_BOOST_PLACEHOLDERS(_1))));
 
         if (!recv_packets.empty())
         {
@@ -311,10 +375,20 @@ void PipeEndpointBase::PipePacketReceived(const RR_INTRUSIVE_PTR<RRValue>& packe
     }
     else
     {
+        uint32_t credits = 0;
         {
             boost::mutex::scoped_lock lock(recvlock);
             if (ignore_incoming_packets)
+            {
+                // Discarded packets are consumed immediately
+                credits = ConsumeRecvCredits(1);
+                lock.unlock();
+                if (credits > 0)
+                {
+                    SendRecvCredits(credits);
+                }
                 return;
+            }
             if (packetnum == increment_packet_number(recv_packet_number))
             {
                 recv_packets.push_back(packet);
@@ -337,9 +411,12 @@ void PipeEndpointBase::PipePacketReceived(const RR_INTRUSIVE_PTR<RRValue>& packe
                     }
                 }
 
+                uint32_t consumed = 0;
                 RR_PIPE_ENDPOINT_LISTENER_ITER(p1->PipePacketReceived(
-                    shared_from_this(), boost::bind(&PipeEndpointBase_PipePacketReceived_recvpacket,
-                                                    boost::ref(recv_packets), RR_BOOST_PLACEHOLDERS(_1))));
+                    shared_from_this(),
+                    boost::bind(&PipeEndpointBase_PipePacketReceived_recvpacket, boost::ref(recv_packets),
+                                boost::ref(consumed), RR_BOOST_PLACEHOLDERS(_1))));
+                credits = ConsumeRecvCredits(consumed);
 
                 if (!recv_packets.empty())
                 {
@@ -367,6 +444,11 @@ void PipeEndpointBase::PipePacketReceived(const RR_INTRUSIVE_PTR<RRValue>& packe
                 out_of_order_packets.insert(std::make_pair(packetnum, packet));
             }
         }
+
+        if (credits > 0)
+        {
+            SendRecvCredits(credits);
+        }
     }
 }
 
@@ -379,6 +461,161 @@ void PipeEndpointBase::PipePacketAckReceived(uint32_t packetnum)
     fire_PacketAckReceivedEvent(packetnum);
 }
 
+void PipeEndpointBase::InitFlowControl(uint32_t send_window, uint32_t recv_window)
+{
+    {
+        boost::mutex::scoped_lock lock(sendlock);
+        this->send_window = send_window;
+        send_credits = send_window;
+    }
+
+    uint32_t credits = 0;
+    {
+        boost::mutex::scoped_lock lock(recvlock);
+        this->recv_window = recv_window;
+        // Packets may have been consumed before the connection completed
+        credits = ConsumeRecvCredits(0);
+    }
+
+    if (send_window > 0 || recv_window > 0)
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                                "Flow control enabled for pipe endpoint index "
+                                                    << index << " send window " << send_window << " receive window "
+                                                    << recv_window);
+    }
+
+    if (credits > 0)
+    {
+        SendRecvCredits(credits);
+    }
+}
+
+void PipeEndpointBase::PipeCreditsReceived(uint32_t credits)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                            "Received " << credits << " send credits for pipe endpoint " << index);
+
+    boost::mutex::scoped_lock lock(sendlock);
+    if (send_window == 0)
+        return;
+
+    send_credits = (credits < std::numeric_limits<uint32_t>::max() - send_credits)
+                       ? send_credits + credits
+                       : std::numeric_limits<uint32_t>::max();
+
+    while (send_credits > 0 && !send_pending.empty())
+    {
+        detail::PipeEndpointBase_pending_send p = RR_MOVE(send_pending.front());
+        send_pending.pop_front();
+        send_credits--;
+        try
+        {
+            boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)> h = p.handler;
+            DoAsyncSendPacketBase(p.packet, p.packet_element, RR_MOVE(h));
+        }
+        catch (std::exception& exp)
+        {
+            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                                    "Sending queued packet failed pipe endpoint index "
+                                                        << index << ": " << exp.what());
+            detail::PostHandlerWithException<uint32_t>(node, p.handler, exp, MessageErrorType_UnknownError, true,
+                                                       false);
+        }
+    }
+
+    send_credits_wait.notify_all();
+}
+
+uint32_t PipeEndpointBase::ConsumeRecvCredits(uint32_t count)
+{
+    recv_consumed += count;
+    if (recv_window == 0 || closed)
+        return 0;
+
+    // Grant credits in batches of half the window to limit the number of grant messages
+    if (recv_consumed == 0 || recv_consumed < std::max(recv_window / 2, static_cast<uint32_t>(1)))
+        return 0;
+
+    uint32_t credits = recv_consumed;
+    recv_consumed = 0;
+    return credits;
+}
+
+void PipeEndpointBase::SendRecvCredits(uint32_t credits)
+{
+    try
+    {
+        GetParent()->AsyncSendPipeCredits(index, credits, endpoint);
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                                "Granted " << credits << " credits for pipe endpoint " << index);
+    }
+    catch (std::exception& exp)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Member, endpoint, service_path, member_name,
+                                                "Sending credits failed pipe endpoint index " << index << ": "
+                                                                                              << exp.what());
+    }
+}
+
+void PipeEndpointBase::AbortPendingSends()
+{
+    std::deque<detail::PipeEndpointBase_pending_send> pending;
+    {
+        boost::mutex::scoped_lock lock(sendlock);
+        send_closed = true;
+        send_pending.swap(pending);
+        send_credits_wait.notify_all();
+    }
+
+    BOOST_FOREACH (detail::PipeEndpointBase_pending_send& p, pending)
+    {
+        RR_SHARED_PTR<RobotRaconteurException> err =
+            RR_MAKE_SHARED<InvalidOperationException>("Pipe endpoint has been closed");
+        detail::PostHandlerWithException<uint32_t>(node, p.handler, err, true, false);
+    }
+}
+
+uint32_t PipeEndpointBase::GetSendWindow()
+{
+    boost::mutex::scoped_lock lock(sendlock);
+    return send_window;
+}
+
+uint32_t PipeEndpointBase::GetSendCredits()
+{
+    boost::mutex::scoped_lock lock(sendlock);
+    return send_credits;
+}
+
+uint32_t PipeEndpointBase::GetRecvWindow()
+{
+    boost::mutex::scoped_lock lock(recvlock);
+    return recv_window;
+}
+
+bool PipeEndpointBase::TryWaitSendWindow(int32_t timeout)
+{
+    boost::mutex::scoped_lock lock(sendlock);
+    boost::chrono::steady_clock::time_point deadline =
+        boost::chrono::steady_clock::now() + boost::chrono::milliseconds(timeout);
+    while (send_window > 0 && (send_credits == 0 || !send_pending.empty()))
+    {
+        if (send_closed || timeout == 0)
+            return false;
+
+        if (timeout < 0)
+        {
+            send_credits_wait.wait(lock);
+        }
+        else if (send_credits_wait.wait_until(lock, deadline) == boost::cv_status::timeout)
+        {
+            return false;
+        }
+    }
+    return send_window == 0 || !send_closed;
+}
+
 uint32_t PipeEndpointBase::increment_packet_number(uint32_t packetnum)
 {
     return (packetnum < std::numeric_limits<uint32_t>::max()) ? packetnum + 1 : 0;
@@ -436,6 +673,8 @@ void PipeEndpointBase::AddListener(const RR_SHARED_PTR<PipeEndpointBaseListener>
 
 void PipeEndpointBase::Shutdown()
 {
+    AbortPendingSends();
+
     boost::mutex::scoped_lock lock(recvlock);
     closed = true;
     recv_packets_wait.notify_all();
@@ -468,10 +707,25 @@ PipeBase::PipeBase()
     unreliable = false;
     rawelements = false;
     direction = MemberDefinition_Direction_both;
+    flow_control_window.store(0);
 }
 
+uint32_t PipeBase::GetFlowControlWindow() { return flow_control_window.load(); }
+
+void PipeBase::SetFlowControlWindow(uint32_t window) { flow_control_window.store(window); }
+
 void PipeBase::DispatchPacketAck(const RR_INTRUSIVE_PTR<MessageElement>& me, const RR_SHARED_PTR<PipeEndpointBase>& e)
 {
+    // Credit grants are sent as a dictionary, packet acks as a scalar packet number
+    if (me->ElementType == DataTypes_dictionary_t)
+    {
+        RR_INTRUSIVE_PTR<MessageElementNestedElementList> elems1 = me->CastDataToNestedList(DataTypes_dictionary_t);
+        uint32_t credits =
+            RRArrayToScalar(MessageElement::FindElement(elems1->Elements, "credits")->CastData<RRArray<uint32_t> >());
+        e->PipeCreditsReceived(credits);
+        return;
+    }
+
     uint32_t pnum = 0;
     pnum = RRArrayToScalar(me->CastData<RRArray<uint32_t> >());
     e->PipePacketAckReceived(pnum);
@@ -505,22 +759,30 @@ bool PipeBase::DispatchPacket(const RR_INTRUSIVE_PTR<MessageElement>& me, const
 RR_INTRUSIVE_PTR<MessageElement> PipeBase::PackPacket(const RR_INTRUSIVE_PTR<RRValue>& data, int32_t index,
                                                       uint32_t packetnumber, bool requestack)
 {
-    // Use message 2
-    std::vector<RR_INTRUSIVE_PTR<MessageElement> > elems;
-    elems.push_back(CreateMessageElement("packetnumber", ScalarToRRArray(packetnumber)));
+    return PackPacketFromElement(PackPacketElement(data), index, packetnumber, requestack);
+}
 
+RR_INTRUSIVE_PTR<MessageElement> PipeBase::PackPacketElement(const RR_INTRUSIVE_PTR<RRValue>& data)
+{
     if (!rawelements)
     {
         RR_INTRUSIVE_PTR<MessageElementData> pdata = PackData(data);
-        elems.push_back(CreateMessageElement("packet", pdata));
-    }
-    else
-    {
-        RR_INTRUSIVE_PTR<MessageElement> pme = rr_cast<MessageElement>(data);
-        pme->ElementName = "packet";
-        elems.push_back(pme);
+        return CreateMessageElement("packet", pdata);
     }
 
+    RR_INTRUSIVE_PTR<MessageElement> pme = rr_cast<MessageElement>(data);
+    pme->ElementName = "packet";
+    return pme;
+}
+
+RR_INTRUSIVE_PTR<MessageElement> PipeBase::PackPacketFromElement(const RR_INTRUSIVE_PTR<MessageElement>& packet,
+                                                                 int32_t index, uint32_t packetnumber, bool requestack)
+{
+    // Use message 2
+    std::vector<RR_INTRUSIVE_PTR<MessageElement> > elems;
+    elems.push_back(CreateMessageElement("packetnumber", ScalarToRRArray(packetnumber)));
+    elems.push_back(packet);
+
     if (requestack)
     {
         elems.push_back(CreateMessageElement("requestack", ScalarToRRArray(static_cast<uint32_t>(1))));
@@ -533,6 +795,16 @@ RR_INTRUSIVE_PTR<MessageElement> PipeBase::PackPacket(const RR_INTRUSIVE_PTR<RRV
     return me;
 }
 
+RR_INTRUSIVE_PTR<MessageElement> PipeBase::PackCredits(int32_t index, uint32_t credits)
+{
+    std::vector<RR_INTRUSIVE_PTR<MessageElement> > elems;
+    elems.push_back(CreateMessageElement("credits", ScalarToRRArray(credits)));
+
+    RR_INTRUSIVE_PTR<MessageElementNestedElementList> delems =
+        CreateMessageElementNestedElementList(DataTypes_dictionary_t, "", RR_MOVE(elems));
+    return CreateMessageElement(index, delems);
+}
+
 RR_SHARED_PTR<RobotRaconteurNode> PipeBase::GetNode()
 {
     RR_SHARED_PTR<RobotRaconteurNode> n = node.lock();
@@ -773,6 +1045,35 @@ void PipeClientBase::AsyncSendPipePacket(
     GetStub()->AsyncSendPipeMessage(m, unreliable, h);
 }
 
+void PipeClientBase::AsyncSendPipePacketElement(
+    const RR_INTRUSIVE_PTR<MessageElement>& packet, int32_t index, uint32_t packetnumber, bool requestack,
+    uint32_t endpoint, bool unreliable,
+    RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+{
+    RR_UNUSED(endpoint);
+    RR_INTRUSIVE_PTR<MessageElement> me = PackPacketFromElement(packet, index, packetnumber, requestack);
+    RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_PipePacket, GetMemberName());
+    m->AddElement(me);
+
+    if (unreliable)
+        m->MetaData = "unreliable\n";
+
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+        boost::bind(handler, packetnumber, RR_BOOST_PLACEHOLDERS(_1));
+    GetStub()->AsyncSendPipeMessage(m, unreliable, h);
+}
+
+void PipeClientBase::AsyncSendPipeCredits(int32_t index, uint32_t credits, uint32_t endpoint)
+{
+    RR_UNUSED(endpoint);
+    RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_PipePacketRet, GetMemberName());
+    m->AddElement(PackCredits(index, credits));
+
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+        boost::bind(&PipeMember_empty_handler, RR_BOOST_PLACEHOLDERS(_1));
+    GetStub()->AsyncSendPipeMessage(m, false, h);
+}
+
 void PipeClientBase::AsyncClose(const RR_SHARED_PTR<PipeEndpointBase>& endpoint, bool remote, uint32_t ee,
                                 RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>)
                                     handler,
@@ -798,6 +1099,16 @@ void PipeClientBase::AsyncConnect_internal(
         handler,
     int32_t timeout)
 {
+    AsyncConnect_internal(index, RR_MOVE(handler), timeout, GetFlowControlWindow());
+}
+
+void PipeClientBase::AsyncConnect_internal(
+    int32_t index,
+    RR_MOVE_ARG(
+        boost::function<void(const RR_SHARED_PTR<PipeEndpointBase>&, const RR_SHARED_PTR<RobotRaconteurException>&)>)
+        handler,
+    int32_t timeout, uint32_t recv_window)
+{
 
     boost::mutex::scoped_lock lock2(pipeendpoints_lock);
 
@@ -812,6 +1123,9 @@ void PipeClientBase::AsyncConnect_internal(
     if (unreliable)
         m->AddElement("unreliable", ScalarToRRArray(static_cast<int32_t>(1)));
 
+    // Always sent so the service knows the client accepts credit grants
+    m->AddElement("recvwindow", ScalarToRRArray(recv_window));
+
     lock2.unlock();
 
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, m_MemberName,
@@ -821,13 +1135,13 @@ void PipeClientBase::AsyncConnect_internal(
                                    boost::bind(&PipeClientBase::AsyncConnect_internal1,
                                                RR_DYNAMIC_POINTER_CAST<PipeClientBase>(shared_from_this()),
                                                RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), index, key,
-                                               handler),
+                                               recv_window, handler),
                                    timeout);
 }
 
 void PipeClientBase::AsyncConnect_internal1(
     const RR_INTRUSIVE_PTR<MessageEntry>& ret, const RR_SHARED_PTR<RobotRaconteurException>& err, int32_t index,
-    int32_t key,
+    int32_t key, uint32_t recv_window,
     boost::function<void(const RR_SHARED_PTR<PipeEndpointBase>&, const RR_SHARED_PTR<RobotRaconteurException>&)>&
         handler)
 {
@@ -891,6 +1205,16 @@ void PipeClientBase::AsyncConnect_internal1(
 
         int32_t rindex = RRArrayToScalar((ret->FindElement("index")->CastData<RRArray<int32_t> >()));
 
+        // Services that do not support flow control do not return a receive window
+        bool flow_control = false;
+        uint32_t send_window = 0;
+        RR_INTRUSIVE_PTR<MessageElement> recv_window_el;
+        if (!runreliable && ret->TryFindElement("recvwindow", recv_window_el))
+        {
+            flow_control = true;
+            send_window = RRArrayToScalar(recv_window_el->CastData<RRArray<uint32_t> >());
+        }
+
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, m_MemberName,
                                                 "Connecting pipe endpoint " << index << " now using returned index "
                                                                             << rindex);
@@ -921,6 +1245,11 @@ void PipeClientBase::AsyncConnect_internal1(
 
         pipeendpoints.insert(std::make_pair(rindex, e));
 
+        if (flow_control)
+        {
+            e->InitFlowControl(send_window, recv_window);
+        }
+
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, endpoint, service_path, m_MemberName,
                                                 "Pipe endpoint index " << rindex << " connected");
 
@@ -1168,6 +1497,38 @@ void PipeServerBase::AsyncSendPipePacket(
     GetSkel()->AsyncSendPipeMessage(m, e, unreliable, boost::bind(handler, packetnumber, RR_BOOST_PLACEHOLDERS(_1)));
 }
 
+void PipeServerBase::AsyncSendPipePacketElement(
+    const RR_INTRUSIVE_PTR<MessageElement>& packet, int32_t index, uint32_t packetnumber, bool requestack, uint32_t e,
+    bool unreliable,
+    RR_MOVE_ARG(boost::function<void(uint32_t, const RR_SHARED_PTR<RobotRaconteurException>&)>) handler)
+{
+
+    {
+        boost::mutex::scoped_lock lock(pipeendpoints_lock);
+
+        if (pipeendpoints.find(pipe_endpoint_server_id(e, index)) == pipeendpoints.end())
+            throw InvalidOperationException("Pipe has been disconnect");
+    }
+
+    RR_INTRUSIVE_PTR<MessageElement> me = PackPacketFromElement(packet, index, packetnumber, requestack);
+    RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_PipePacket, GetMemberName());
+    m->AddElement(me);
+
+    if (unreliable)
+        m->MetaData = "unreliable\n";
+
+    GetSkel()->AsyncSendPipeMessage(m, e, unreliable, boost::bind(handler, packetnumber, RR_BOOST_PLACEHOLDERS(_1)));
+}
+
+void PipeServerBase::AsyncSendPipeCredits(int32_t index, uint32_t credits, uint32_t endpoint)
+{
+    RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_PipePacketRet, GetMemberName());
+    m->AddElement(PackCredits(index, credits));
+
+    GetSkel()->AsyncSendPipeMessage(m, endpoint, false,
+                                    boost::bind(&PipeMember_empty_handler, RR_BOOST_PLACEHOLDERS(_1)));
+}
+
 void PipeServerBase::AsyncClose(const RR_SHARED_PTR<PipeEndpointBase>& e, bool remote, uint32_t ee,
                                 RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>)
                                     handler,
@@ -1319,6 +1680,17 @@ RR_INTRUSIVE_PTR<MessageEntry> PipeServerBase::PipeCommand(const RR_INTRUSIVE_PT
                 if (direction == MemberDefinition_Direction_writeonly)
                     ep_direction = MemberDefinition_Direction_readonly;
                 RR_SHARED_PTR<PipeEndpointBase> p = CreateNewPipeEndpoint(index, e, isunreliable, ep_direction);
+
+                // Clients that support flow control send their receive window, possibly zero
+                RR_INTRUSIVE_PTR<MessageElement> recv_window_el;
+                if (!isunreliable && m->TryFindElement("recvwindow", recv_window_el))
+                {
+                    uint32_t send_window = RRArrayToScalar(recv_window_el->CastData<RRArray<uint32_t> >());
+                    uint32_t recv_window = GetFlowControlWindow();
+                    ret->AddElement("recvwindow", ScalarToRRArray(recv_window));
+                    p->InitFlowControl(send_window, recv_window);
+                }
+
                 pipeendpoints.insert(std::make_pair(pipe_endpoint_server_id(e, index), p));
 
                 lock.unlock();
@@ -1585,6 +1957,9 @@ void PipeBroadcasterBase::AsyncSendPacketBase(const RR_INTRUSIVE_PTR<RRValue>& p
     boost::mutex::scoped_lock lock2(op->keys_lock);
     int32_t count = 0;
 
+    // Pack the packet once and give each endpoint a shallow copy, see WireBroadcasterBase::SetOutValueBase
+    RR_INTRUSIVE_PTR<MessageElement> packet_element;
+
     for (std::list<RR_SHARED_PTR<detail::PipeBroadcasterBase_connected_endpoint> >::iterator ee = endpoints.begin();
          ee != endpoints.end();)
     {
@@ -1629,6 +2004,32 @@ void PipeBroadcasterBase::AsyncSendPacketBase(const RR_INTRUSIVE_PTR<RRValue>& p
                 continue;
             }
 
+            // Drop the packet for endpoints with a full flow control window instead of queueing it
+            if (!ep->TryWaitSendWindow(0))
+            {
+                ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, ep_endpoint, service_path, member_name,
+                                                        "PipeBroadcaster skipping send packet to pipe endpoint index "
+                                                            << ep_index << ": send window full");
+                continue;
+            }
+
+            if (!packet_element)
+            {
+                RR_SHARED_PTR<PipeServerBase> p = pipe.lock();
+                if (!p)
+                {
+                    throw InvalidOperationException("Pipe has been released");
+                }
+                if (!copy_element)
+                {
+                    packet_element = p->PackPacketElement(packet);
+                }
+                else
+                {
+                    packet_element = p->PackPacketElement(ShallowCopyMessageElement(rr_cast<MessageElement>(packet)));
+                }
+            }
+
             (*ee2)->active_send_count =
                 (*ee2)->active_send_count < std::numeric_limits<int32_t>::max() ? (*ee2)->active_send_count + 1 : 0;
             int32_t send_key = (*ee2)->active_send_count;
@@ -1636,20 +2037,10 @@ void PipeBroadcasterBase::AsyncSendPacketBase(const RR_INTRUSIVE_PTR<RRValue>& p
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, ep_endpoint, service_path, member_name,
                                                     "PipeBroadcaster sending packet to pipe endpoint index "
                                                         << ep_index);
-            if (!copy_element)
-            {
-                ep->AsyncSendPacketBase(packet, boost::bind(&PipeBroadcasterBase::handle_send, this->shared_from_this(),
-                                                            RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), *ee2,
-                                                            op, count, send_key, handler));
-            }
-            else
-            {
-                RR_INTRUSIVE_PTR<MessageElement> packet2 = ShallowCopyMessageElement(rr_cast<MessageElement>(packet));
-                ep->AsyncSendPacketBase(packet2,
-                                        boost::bind(&PipeBroadcasterBase::handle_send, this->shared_from_this(),
-                                                    RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), *ee2, op,
-                                                    count, send_key, handler));
-            }
+            ep->AsyncSendPacketBase(packet, ShallowCopyMessageElement(packet_element),
+                                    boost::bind(&PipeBroadcasterBase::handle_send, this->shared_from_this(),
+                                                RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2), *ee2, op, count,
+                                                send_key, handler));
             op->keys.push_back(count);
 
             count++;
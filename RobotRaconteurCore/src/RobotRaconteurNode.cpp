@@ -31,6 +31,7 @@
 
 #include "Discovery_private.h"
 #include "RobotRaconteurNode_connector_private.h"
+#include "RobotRaconteurNode_routing_private.h"
 
 #ifndef ROBOTRACONTEUR_EMSCRIPTEN
 #include <boost/asio/steady_timer.hpp>
@@ -60,10 +61,15 @@ RobotRaconteurNode::RobotRaconteurNode()
     TransportInactivityTimeout = 600000;
     RequestTimeout = 15000;
     MemoryMaxTransferSize = 102400;
+    MemoryMaxTransferWindow = 4;
     instance_is_init = false;
 
     log_level = RobotRaconteur_LogLevel_Warning;
 
+    endpoint_routes = RR_MAKE_SHARED<detail::NodeRoutingTable<Endpoint> >();
+    transport_routes = RR_MAKE_SHARED<detail::NodeRoutingTable<Transport> >();
+    tap_active.store(false);
+
     // ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Node, -1, "RobotRaconteurNode created");
 }
 
@@ -303,6 +309,7 @@ uint32_t RobotRaconteurNode::RegisterTransport(const RR_SHARED_PTR<Transport>& t
             transport_count++;
         transport->TransportID = transport_count;
         transports.insert(std::make_pair(transport_count, transport));
+        transport_routes->Publish(transports);
     }
 
     RR_SHARED_PTR<ITransportTimeProvider> t = RR_DYNAMIC_POINTER_CAST<ITransportTimeProvider>(transport);
@@ -447,6 +454,7 @@ void RobotRaconteurNode::Shutdown()
         {
             boost::mutex::scoped_lock lock(endpoint_lock);
             endpoints.clear();
+            endpoint_routes->Publish(endpoints);
         }
 
         {
@@ -478,7 +486,9 @@ void RobotRaconteurNode::Shutdown()
                 }
             }
 
+            boost::unique_lock<boost::shared_mutex> lock(transports_lock);
             transports.clear();
+            transport_routes->Publish(transports);
         }
 
         {
@@ -525,6 +535,7 @@ void RobotRaconteurNode::Shutdown()
 
     {
         boost::unique_lock<boost::shared_mutex> lock(tap_lock);
+        tap_active.store(false);
         if (tap)
         {
             tap->Close();
@@ -613,45 +624,30 @@ void RobotRaconteurNode::SendMessage(const RR_INTRUSIVE_PTR<Message>& m)
         throw ConnectionException("Could not route message");
     }
 
-    {
-        boost::shared_lock<boost::shared_mutex> lock3(tap_lock);
-        if (tap)
-        {
-            tap->RecordMessage(m);
-        }
-    }
+    RecordMessageTap(m);
 
-    RR_SHARED_PTR<Endpoint> e;
+    RR_SHARED_PTR<Endpoint> e = endpoint_routes->Find(m->header->SenderEndpoint);
+    if (!e)
     {
-        boost::mutex::scoped_lock lock(endpoint_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Endpoint> >::iterator e1 = endpoints.find(m->header->SenderEndpoint);
-        if (e1 == endpoints.end())
+        if (is_shutdown)
         {
-            if (is_shutdown)
-            {
-                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1, "Attempt to send message after node shutdown");
-                throw InvalidEndpointException("Attempt to send message after node shutdown");
-            }
-
-            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(
-                weak_this, Node, -1, "Attempt to send message using invalid endpoint " << m->header->SenderEndpoint);
-            throw InvalidEndpointException("Could not find endpoint");
+            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1, "Attempt to send message after node shutdown");
+            throw InvalidEndpointException("Attempt to send message after node shutdown");
         }
-        e = e1->second;
+
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1,
+                                           "Attempt to send message using invalid endpoint "
+                                               << m->header->SenderEndpoint);
+        throw InvalidEndpointException("Could not find endpoint");
     }
 
-    RR_SHARED_PTR<Transport> c;
+    RR_SHARED_PTR<Transport> c = transport_routes->Find(e->GetTransport());
+    if (!c)
     {
-        boost::shared_lock<boost::shared_mutex> lock(transports_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Transport> >::iterator e1 = transports.find(e->GetTransport());
-        if (e1 == transports.end())
-        {
-            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Transport, e->GetLocalEndpoint(),
-                                               "Could not find transport to send message from endpoint "
-                                                   << e->GetLocalEndpoint());
-            throw ConnectionException("Could not find transport");
-        }
-        c = e1->second;
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Transport, e->GetLocalEndpoint(),
+                                           "Could not find transport to send message from endpoint "
+                                               << e->GetLocalEndpoint());
+        throw ConnectionException("Could not find transport");
     }
 
     c->SendMessage(m);
@@ -670,45 +666,30 @@ void RobotRaconteurNode::AsyncSendMessage(
         throw ConnectionException("Could not route message");
     }
 
-    {
-        boost::shared_lock<boost::shared_mutex> lock3(tap_lock);
-        if (tap)
-        {
-            tap->RecordMessage(m);
-        }
-    }
+    RecordMessageTap(m);
 
-    RR_SHARED_PTR<Endpoint> e;
+    RR_SHARED_PTR<Endpoint> e = endpoint_routes->Find(m->header->SenderEndpoint);
+    if (!e)
     {
-        boost::mutex::scoped_lock lock(endpoint_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Endpoint> >::iterator e1 = endpoints.find(m->header->SenderEndpoint);
-        if (e1 == endpoints.end())
+        if (is_shutdown)
         {
-            if (is_shutdown)
-            {
-                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1, "Attempt to send message after node shutdown");
-                throw InvalidOperationException("Attempt to send message after node shutdown");
-            }
-
-            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(
-                weak_this, Node, -1, "Attempt to send message using invalid endpoint " << m->header->SenderEndpoint);
-            throw InvalidEndpointException("Could not find endpoint");
+            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1, "Attempt to send message after node shutdown");
+            throw InvalidOperationException("Attempt to send message after node shutdown");
         }
-        e = e1->second;
+
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1,
+                                           "Attempt to send message using invalid endpoint "
+                                               << m->header->SenderEndpoint);
+        throw InvalidEndpointException("Could not find endpoint");
     }
 
-    RR_SHARED_PTR<Transport> c;
+    RR_SHARED_PTR<Transport> c = transport_routes->Find(e->GetTransport());
+    if (!c)
     {
-        boost::shared_lock<boost::shared_mutex> lock(transports_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Transport> >::iterator e1 = transports.find(e->GetTransport());
-        if (e1 == transports.end())
-        {
-            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Transport, e->GetLocalEndpoint(),
-                                               "Could not find transport to send message from endpoint "
-                                                   << e->GetLocalEndpoint());
-            throw ConnectionException("Could not find transport");
-        }
-        c = e1->second;
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Transport, e->GetLocalEndpoint(),
+                                           "Could not find transport to send message from endpoint "
+                                               << e->GetLocalEndpoint());
+        throw ConnectionException("Could not find transport");
     }
 
     c->AsyncSendMessage(m, handler);
@@ -718,13 +699,7 @@ void RobotRaconteurNode::AsyncSendMessage(
 
 void RobotRaconteurNode::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
 {
-    {
-        boost::shared_lock<boost::shared_mutex> lock3(tap_lock);
-        if (tap)
-        {
-            tap->RecordMessage(m);
-        }
-    }
+    RecordMessageTap(m);
 
     try
     {
@@ -742,17 +717,7 @@ void RobotRaconteurNode::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
         else
         {
 
-            RR_SHARED_PTR<Endpoint> e;
-
-            {
-                boost::mutex::scoped_lock lock(endpoint_lock);
-                RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Endpoint> >::iterator e1 =
-                    endpoints.find(m->header->ReceiverEndpoint);
-                if (e1 != endpoints.end())
-                {
-                    e = e1->second;
-                }
-            }
+            RR_SHARED_PTR<Endpoint> e = endpoint_routes->Find(m->header->ReceiverEndpoint);
 
             if (e)
             {
@@ -784,18 +749,10 @@ void RobotRaconteurNode::TransportConnectionClosed(uint32_t endpoint)
 {
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(weak_this, Node, endpoint, "Node notified that transport connection was closed");
 
-    RR_SHARED_PTR<Endpoint> e;
+    RR_SHARED_PTR<Endpoint> e = endpoint_routes->Find(endpoint);
+    if (!e)
     {
-        boost::mutex::scoped_lock lock(endpoint_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Endpoint> >::iterator e1 = endpoints.find(endpoint);
-        if (e1 != endpoints.end())
-        {
-            e = e1->second;
-        }
-        else
-        {
-            return;
-        }
+        return;
     }
 
     e->TransportConnectionClosed(endpoint);
@@ -851,6 +808,24 @@ void RobotRaconteurNode::SetMemoryMaxTransferSize(uint32_t size)
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(weak_this, Node, -1, "MemoryMaxTransferSize set to: " << size << " bytes");
 }
 
+uint32_t RobotRaconteurNode::GetMemoryMaxTransferWindow()
+{
+    boost::mutex::scoped_lock lock(MemoryMaxTransferWindow_lock);
+    return MemoryMaxTransferWindow;
+}
+
+void RobotRaconteurNode::SetMemoryMaxTransferWindow(uint32_t window)
+{
+    if (window < 1)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(weak_this, Node, -1, "Invalid MemoryMaxTransferWindow: " << window);
+        throw InvalidArgumentException("MemoryMaxTransferWindow must be at least 1");
+    }
+    boost::mutex::scoped_lock lock(MemoryMaxTransferWindow_lock);
+    MemoryMaxTransferWindow = window;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(weak_this, Node, -1, "MemoryMaxTransferWindow set to: " << window);
+}
+
 const RR_SHARED_PTR<RobotRaconteur::DynamicServiceFactory> RobotRaconteurNode::GetDynamicServiceFactory()
 {
     boost::mutex::scoped_lock lock(dynamic_factory_lock);
@@ -1023,13 +998,7 @@ RR_INTRUSIVE_PTR<Message> RobotRaconteurNode::SpecialRequest(const RR_INTRUSIVE_
                                           "Could not find route to remote node");
     }
 
-    {
-        boost::shared_lock<boost::shared_mutex> lock3(tap_lock);
-        if (tap)
-        {
-            tap->RecordMessage(m);
-        }
-    }
+    RecordMessageTap(m);
 
     if (m->header->ReceiverEndpoint != 0 && m->entries.size() == 1 &&
         m->entries.at(0)->EntryType == MessageEntryType_ObjectTypeName)
@@ -1557,13 +1526,7 @@ RR_INTRUSIVE_PTR<Message> RobotRaconteurNode::SpecialRequest(const RR_INTRUSIVE_
         }
     }
 
-    {
-        boost::shared_lock<boost::shared_mutex> lock3(tap_lock);
-        if (tap)
-        {
-            tap->RecordMessage(ret);
-        }
-    }
+    RecordMessageTap(ret);
 
     return ret;
 }
@@ -1769,6 +1732,7 @@ uint32_t RobotRaconteurNode::RegisterEndpoint(const RR_SHARED_PTR<Endpoint>& e)
         }
         e->SetLocalEndpoint(id);
         endpoints.insert(std::make_pair(id, e));
+        endpoint_routes->Publish(endpoints);
 
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT(weak_this, Node, e->GetLocalEndpoint(),
                                            "Endpoint registered, RemoteNodeID " << e->GetRemoteNodeID().ToString()
@@ -1793,6 +1757,7 @@ void RobotRaconteurNode::DeleteEndpoint(const RR_SHARED_PTR<Endpoint>& e)
             if (e1 != endpoints.end())
             {
                 endpoints.erase(e1);
+                endpoint_routes->Publish(endpoints);
                 recent_endpoints.insert(std::make_pair(e->GetLocalEndpoint(), NowNodeTime()));
             }
         }
@@ -1805,15 +1770,7 @@ void RobotRaconteurNode::DeleteEndpoint(const RR_SHARED_PTR<Endpoint>& e)
 
     try
     {
-        RR_SHARED_PTR<Transport> c;
-        {
-            boost::shared_lock<boost::shared_mutex> lock(transports_lock);
-            RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Transport> >::iterator e1 = transports.find(e->GetTransport());
-            if (e1 != transports.end())
-            {
-                c = e1->second;
-            }
-        }
+        RR_SHARED_PTR<Transport> c = transport_routes->Find(e->GetTransport());
         if (c)
             c->CloseTransportConnection(e);
     }
@@ -1828,30 +1785,20 @@ void RobotRaconteurNode::DeleteEndpoint(const RR_SHARED_PTR<Endpoint>& e)
 
 void RobotRaconteurNode::CheckConnection(uint32_t endpoint)
 {
-    RR_SHARED_PTR<Endpoint> e;
+    RR_SHARED_PTR<Endpoint> e = endpoint_routes->Find(endpoint);
+    if (!e)
     {
-        boost::mutex::scoped_lock lock(endpoint_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Endpoint> >::iterator e1 = endpoints.find(endpoint);
-        if (e1 == endpoints.end())
+        if (is_shutdown)
         {
-            if (is_shutdown)
-            {
-                throw InvalidOperationException("Node has been shut down");
-            }
-
-            throw InvalidEndpointException("Invalid Endpoint");
+            throw InvalidOperationException("Node has been shut down");
         }
-        e = e1->second;
-    }
 
-    RR_SHARED_PTR<Transport> c;
-    {
-        boost::shared_lock<boost::shared_mutex> lock(transports_lock);
-        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<Transport> >::iterator e1 = transports.find(e->GetTransport());
-        if (e1 == transports.end())
-            throw ConnectionException("Transport connection not found");
-        c = e1->second;
+        throw InvalidEndpointException("Invalid Endpoint");
     }
+
+    RR_SHARED_PTR<Transport> c = transport_routes->Find(e->GetTransport());
+    if (!c)
+        throw ConnectionException("Transport connection not found");
     c->CheckConnection(endpoint);
 }
 
@@ -3227,6 +3174,21 @@ void RobotRaconteurNode::SetMessageTap(const RR_SHARED_PTR<MessageTap>& message_
 {
     boost::unique_lock<boost::shared_mutex> lock(tap_lock);
     tap = message_tap;
+    tap_active.store(static_cast<bool>(tap));
+}
+
+void RobotRaconteurNode::RecordMessageTap(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if (!tap_active.load(boost::memory_order_acquire))
+    {
+        return;
+    }
+
+    boost::shared_lock<boost::shared_mutex> lock(tap_lock);
+    if (tap)
+    {
+        tap->RecordMessage(m);
+    }
 }
 
 NodeDirectories RobotRaconteurNode::GetNodeDirectories()
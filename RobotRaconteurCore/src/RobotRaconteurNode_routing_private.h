@@ -0,0 +1,105 @@
+// Copyright 2011-2020 Wason Technology, LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "RobotRaconteur/RobotRaconteurNode.h"
+#include <boost/atomic.hpp>
+
+#pragma once
+
+namespace RobotRaconteur
+{
+namespace detail
+{
+// Read-mostly copy of the node endpoint and transport maps used to route every
+// message, and of the service path to skel map of each ServerContext. Writers
+// publish a new immutable snapshot while holding the lock protecting the
+// authoritative map. Readers keep the last snapshot they used in thread local
+// storage and only take snapshot_lock when the version has changed, so the
+// send and receive paths do not contend on a shared mutex.
+template <typename T, typename K>
+class NodeRoutingTable : private boost::noncopyable
+{
+  public:
+    NodeRoutingTable()
+    {
+        snapshot = RR_MAKE_SHARED<snapshot_type>();
+        snapshot->version = ++next_version();
+        version.store(snapshot->version);
+    }
+
+    void Publish(const RR_UNORDERED_MAP<K, RR_SHARED_PTR<T> >& routes)
+    {
+        RR_SHARED_PTR<snapshot_type> s = RR_MAKE_SHARED<snapshot_type>();
+        s->routes.insert(routes.begin(), routes.end());
+        // Versions are unique across all tables so a thread cached snapshot
+        // can never be mistaken for the snapshot of a different node
+        s->version = ++next_version();
+
+        boost::mutex::scoped_lock lock(snapshot_lock);
+        snapshot.swap(s);
+        version.store(snapshot->version, boost::memory_order_release);
+    }
+
+    RR_SHARED_PTR<T> Find(const K& id)
+    {
+        RR_SHARED_PTR<snapshot_type>* cached = local_snapshot.get();
+        if (!cached)
+        {
+            cached = new RR_SHARED_PTR<snapshot_type>();
+            local_snapshot.reset(cached);
+        }
+
+        if (!*cached || (*cached)->version != version.load(boost::memory_order_acquire))
+        {
+            boost::mutex::scoped_lock lock(snapshot_lock);
+            *cached = snapshot;
+        }
+
+        typename map_type::const_iterator e = (*cached)->routes.find(id);
+        if (e == (*cached)->routes.end())
+        {
+            return RR_SHARED_PTR<T>();
+        }
+        return e->second.lock();
+    }
+
+  private:
+    typedef RR_UNORDERED_MAP<K, RR_WEAK_PTR<T> > map_type;
+
+    struct snapshot_type
+    {
+        map_type routes;
+        uint64_t version;
+    };
+
+    boost::mutex snapshot_lock;
+    RR_SHARED_PTR<snapshot_type> snapshot;
+    boost::atomic<uint64_t> version;
+
+    // The node singleton is constructed during static initialization
+    static boost::atomic<uint64_t>& next_version()
+    {
+        static boost::atomic<uint64_t> v(0);
+        return v;
+    }
+
+    static boost::thread_specific_ptr<RR_SHARED_PTR<snapshot_type> > local_snapshot;
+};
+
+template <typename T, typename K>
+boost::thread_specific_ptr<RR_SHARED_PTR<typename NodeRoutingTable<T, K>::snapshot_type> >
+    NodeRoutingTable<T, K>::local_snapshot;
+
+} // namespace detail
+} // namespace RobotRaconteur
@@ -27,6 +27,7 @@
 #include "RobotRaconteur/Security.h"
 
 #include "Service_lock_private.h"
+#include "RobotRaconteurNode_routing_private.h"
 
 #include "RobotRaconteur/ErrorUtil.h"
 #include "RobotRaconteur/Generator.h"
@@ -48,6 +49,52 @@ static void rr_context_node_handler(const RR_SHARED_PTR<RobotRaconteurNode>& n,
     n->HandleException(e.get());
 }
 
+// The thread-specific current context values are allocated once per thread and then assigned, so
+// setting them for each request does not allocate. An empty value means not set.
+static void rr_context_set_current_path(boost::thread_specific_ptr<std::string>& p, boost::string_ref v)
+{
+    std::string* p1 = p.get();
+    if (!p1)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        p.reset(new std::string(v.begin(), v.end()));
+        return;
+    }
+    p1->assign(v.begin(), v.end());
+}
+
+static void rr_context_clear_current_path(boost::thread_specific_ptr<std::string>& p)
+{
+    std::string* p1 = p.get();
+    if (p1)
+    {
+        p1->clear();
+    }
+}
+
+template <typename T>
+static void rr_context_set_current(boost::thread_specific_ptr<RR_SHARED_PTR<T> >& p, const RR_SHARED_PTR<T>& v)
+{
+    RR_SHARED_PTR<T>* p1 = p.get();
+    if (!p1)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        p.reset(new RR_SHARED_PTR<T>(v));
+        return;
+    }
+    *p1 = v;
+}
+
+template <typename T>
+static void rr_context_clear_current(boost::thread_specific_ptr<RR_SHARED_PTR<T> >& p)
+{
+    RR_SHARED_PTR<T>* p1 = p.get();
+    if (p1)
+    {
+        p1->reset();
+    }
+}
+
 ServiceSkel::ServiceSkel() { ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Service, -1, "ServiceSkel created"); }
 
 void ServiceSkel::Init(boost::string_ref s, const RR_SHARED_PTR<RRObject>& o, const RR_SHARED_PTR<ServerContext>& c)
@@ -643,6 +690,7 @@ ServerContext::ServerContext(const RR_SHARED_PTR<ServiceFactory>& f, const RR_SH
     request_number = 0;
     m_ServiceDef = f;
     this->node = node;
+    skel_routes = RR_MAKE_SHARED<detail::NodeRoutingTable<ServiceSkel, MessageStringPtr> >();
 
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Client, -1,
                                        "ServerContext created with service type \"" << f->GetServiceName() << "\"");
@@ -661,32 +709,46 @@ void ServerContext::SendEvent(const RR_INTRUSIVE_PTR<MessageEntry>& m)
 
     try
     {
-        RR_INTRUSIVE_PTR<Message> mm = CreateMessage();
-
         std::vector<RR_SHARED_PTR<ServerEndpoint> > cc;
 
         {
+            boost::mutex::scoped_lock lock(client_endpoints_lock);
+            cc.reserve(client_endpoints.size());
+            boost::copy(client_endpoints | boost::adaptors::map_values, std::back_inserter(cc));
+        }
+
+        // Encode the elements once when there is more than one client. The copy sent to each
+        // client shares the encoded elements, so only the entry and message headers are written
+        // for each client.
+        RR_INTRUSIVE_PTR<MessageEntry> m1 = m;
+        if (cc.size() > 1)
+        {
+            try
+            {
+                RR_INTRUSIVE_PTR<MessageEntry> m3 = ShallowCopyMessageEntry(m);
+                BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageElement>& e, m3->elements)
+                {
+                    e->Encode4();
+                }
+                m1 = m3;
+            }
+            catch (std::exception& exp2)
             {
-                boost::mutex::scoped_lock lock(client_endpoints_lock);
-                boost::copy(client_endpoints | boost::adaptors::map_values, std::back_inserter(cc));
+                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, -1, m->ServicePath, m->MemberName,
+                                                        "Encoding event failed: " << exp2.what());
             }
+        }
 
-            BOOST_FOREACH (RR_SHARED_PTR<RobotRaconteur::ServerEndpoint>& c, cc)
-            {
+        RR_WEAK_PTR<ServerContext> weak_this = shared_from_this();
+
+        BOOST_FOREACH (RR_SHARED_PTR<RobotRaconteur::ServerEndpoint>& c, cc)
+        {
 
-                if (m_RequireValidUser)
+            if (m_RequireValidUser)
+            {
+                try
                 {
-                    try
-                    {
-                        if (c->GetAuthenticatedUsername().empty())
-                        {
-                            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(
-                                node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
-                                "Skipping sending event due to authentication failure");
-                            continue;
-                        }
-                    }
-                    catch (AuthenticationException&)
+                    if (c->GetAuthenticatedUsername().empty())
                     {
                         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath,
                                                                 m->MemberName,
@@ -694,40 +756,50 @@ void ServerContext::SendEvent(const RR_INTRUSIVE_PTR<MessageEntry>& m)
                         continue;
                     }
                 }
-
-                RR_INTRUSIVE_PTR<MessageEntry> m2;
-                try
-                {
-                    m2 = ShallowCopyMessageEntry(m);
-                }
-                catch (std::exception& exp2)
+                catch (AuthenticationException&)
                 {
-                    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath,
+                    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath,
                                                             m->MemberName,
-                                                            "ShallowCopyMessage failed: " << exp2.what());
-                    RobotRaconteurNode::TryHandleException(node, &exp2);
+                                                            "Skipping sending event due to authentication failure");
                     continue;
                 }
+            }
+
+            uint32_t ep = c->GetLocalEndpoint();
+
+            RR_INTRUSIVE_PTR<MessageEntry> m2;
+            try
+            {
+                m2 = ShallowCopyMessageEntry(m1);
+            }
+            catch (std::exception& exp2)
+            {
+                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, ep, m->ServicePath, m->MemberName,
+                                                        "ShallowCopyMessage failed: " << exp2.what());
+                RobotRaconteurNode::TryHandleException(node, &exp2);
+                UpdateEventStatistics(ep, false, false, true);
+                continue;
+            }
 
+            try
+            {
+                // The transport checks the connection when the message is sent
+                UpdateEventStatistics(ep, true, false, false);
+                boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+                    boost::bind(&ServerContext::EndSendEvent, weak_this, ep, RR_BOOST_PLACEHOLDERS(_1));
+                AsyncSendMessage(m2, c, h);
+            }
+            catch (std::exception& exp2)
+            {
+                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, ep, m->ServicePath, m->MemberName,
+                                                        "Sending event to client failed: " << exp2.what());
+                UpdateEventStatistics(ep, false, true, true);
                 try
                 {
-                    GetNode()->CheckConnection(c->GetLocalEndpoint());
-                    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
-                        boost::bind(&rr_context_emptyhandler, RR_BOOST_PLACEHOLDERS(_1));
-                    AsyncSendMessage(m2, c, h);
-                }
-                catch (std::exception& exp2)
-                {
-                    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath,
-                                                            m->MemberName,
-                                                            "Sending event to client failed: " << exp2.what());
-                    try
-                    {
-                        RemoveClient(c);
-                    }
-                    catch (std::exception&)
-                    {};
+                    RemoveClient(c);
                 }
+                catch (std::exception&)
+                {};
             }
         }
     }
@@ -737,6 +809,67 @@ void ServerContext::SendEvent(const RR_INTRUSIVE_PTR<MessageEntry>& m)
                                                 "Error sending event: " << exp.what());
     }
 }
+
+void ServerContext::EndSendEvent(RR_WEAK_PTR<ServerContext> context, uint32_t endpoint,
+                                 const RR_SHARED_PTR<RobotRaconteurException>& err)
+{
+    RR_SHARED_PTR<ServerContext> context1 = context.lock();
+    if (!context1)
+        return;
+
+    if (err)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(context1->node, Service, endpoint,
+                                           "Sending event to client failed: " << err->what());
+    }
+
+    context1->UpdateEventStatistics(endpoint, false, true, static_cast<bool>(err));
+}
+
+void ServerContext::UpdateEventStatistics(uint32_t endpoint, bool sent, bool completed, bool dropped)
+{
+    boost::mutex::scoped_lock lock(event_statistics_lock);
+    RR_UNORDERED_MAP<uint32_t, ServerContextEventStatistics>::iterator e = event_statistics.find(endpoint);
+    if (e == event_statistics.end())
+    {
+        if (!sent)
+        {
+            // Completion after the client was removed
+            return;
+        }
+        e = event_statistics.insert(std::make_pair(endpoint, ServerContextEventStatistics())).first;
+        e->second.LocalEndpoint = endpoint;
+    }
+
+    ServerContextEventStatistics& s = e->second;
+    if (sent)
+    {
+        s.SentCount++;
+        s.QueuedCount++;
+        s.MaxQueuedCount = (std::max)(s.MaxQueuedCount, s.QueuedCount);
+    }
+    if (completed && s.QueuedCount > 0)
+    {
+        s.QueuedCount--;
+    }
+    if (dropped)
+    {
+        s.DroppedCount++;
+    }
+}
+
+std::vector<ServerContextEventStatistics> ServerContext::GetEventStatistics()
+{
+    std::vector<ServerContextEventStatistics> o;
+    boost::mutex::scoped_lock lock(event_statistics_lock);
+    o.reserve(event_statistics.size());
+    boost::copy(event_statistics | boost::adaptors::map_values, std::back_inserter(o));
+    return o;
+}
+
+ServerContextEventStatistics::ServerContextEventStatistics()
+    : LocalEndpoint(0), SentCount(0), DroppedCount(0), QueuedCount(0), MaxQueuedCount(0)
+{}
 #undef SendMessage
 
 void ServerContext::SendMessage(const RR_INTRUSIVE_PTR<MessageEntry>& m, uint32_t e)
@@ -908,10 +1041,8 @@ void ServerContext::SetBaseObject(boost::string_ref name, const RR_SHARED_PTR<RR
             SetSecurityPolicy(policy);
         }
 
-        // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-        m_CurrentServicePath.reset(new std::string(name.to_string()));
-        m_CurrentServerContext.reset(new RR_SHARED_PTR<ServerContext>(shared_from_this()));
-        // NOLINTEND(cppcoreguidelines-owning-memory)
+        rr_context_set_current_path(m_CurrentServicePath, name);
+        rr_context_set_current(m_CurrentServerContext, shared_from_this());
 
         RR_SHARED_PTR<ServiceSkel> s = GetServiceDef()->CreateSkel(o->RRType(), name, o, shared_from_this());
 
@@ -921,11 +1052,12 @@ void ServerContext::SetBaseObject(boost::string_ref name, const RR_SHARED_PTR<RR
         {
             boost::mutex::scoped_lock lock(skels_lock);
             skels.insert(std::make_pair(name, s));
+            skel_routes->Publish(skels);
         }
 
-        m_CurrentServicePath.reset(0);
+        rr_context_clear_current_path(m_CurrentServicePath);
 
-        m_CurrentServerContext.reset(0);
+        rr_context_clear_current(m_CurrentServerContext);
 
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, -1, name, "",
                                                 "SetBaseObject completed successfully for service \""
@@ -944,6 +1076,13 @@ RR_SHARED_PTR<ServiceSkel> ServerContext::GetObjectSkel(MessageStringRef service
 
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, -1, servicepath, "", "GetObjectSkel");
 
+    // Paths that already have a skel are resolved without taking skels_lock or matching the path
+    RR_SHARED_PTR<ServiceSkel> cached_skel = skel_routes->Find(servicepath);
+    if (cached_skel)
+    {
+        return cached_skel;
+    }
+
     try
     {
         static boost::regex r_service_path("^[a-zA-Z](?:\\w*[a-zA-Z0-9])?(\\.[a-zA-Z](?:\\w*[a-zA-Z0-9])?(?:\\[(?:[a-"
@@ -990,15 +1129,13 @@ RR_SHARED_PTR<ServiceSkel> ServerContext::GetObjectSkel(MessageStringRef service
                 if (skel1 == 0)
                 {
 
-                    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-                    m_CurrentServicePath.reset(new std::string(RR_MOVE(ppath1)));
-                    m_CurrentServerContext.reset(new RR_SHARED_PTR<ServerContext>(shared_from_this()));
-                    // NOLINTEND(cppcoreguidelines-owning-memory)
+                    rr_context_set_current_path(m_CurrentServicePath, ppath1);
+                    rr_context_set_current(m_CurrentServerContext, shared_from_this());
                     RR_SHARED_PTR<RRObject> obj1 = skel->GetSubObj(p.at(i));
 
-                    m_CurrentServicePath.reset(0);
+                    rr_context_clear_current_path(m_CurrentServicePath);
 
-                    m_CurrentServerContext.reset(0);
+                    rr_context_clear_current(m_CurrentServerContext);
 
                     if (!obj1)
                     {
@@ -1015,6 +1152,7 @@ RR_SHARED_PTR<ServiceSkel> ServerContext::GetObjectSkel(MessageStringRef service
                         lock->AddSkel(skel1);
                     }
                     skels.insert(std::make_pair(ppath, skel1));
+                    skel_routes->Publish(skels);
                 }
 
                 skel = skel1;
@@ -1073,13 +1211,62 @@ boost::thread_specific_ptr<RR_SHARED_PTR<ServerContext> > ServerContext::m_Curre
 
 std::string ServerContext::GetCurrentServicePath()
 {
-    if (m_CurrentServicePath.get() == 0)
+    if (m_CurrentServicePath.get() == 0 || m_CurrentServicePath->empty())
         throw InvalidOperationException("Current server context not set");
     return std::string(*m_CurrentServicePath);
 }
 
 boost::thread_specific_ptr<std::string> ServerContext::m_CurrentServicePath;
 
+void ServerContext::DispatchPacketEntry(const RR_INTRUSIVE_PTR<MessageEntry>& m,
+                                        const RR_SHARED_PTR<ServerEndpoint>& c)
+{
+    // Fast lane for pipe and wire packets. Packets never return a response, so errors are only logged.
+    try
+    {
+        if (m_RequireValidUser)
+        {
+            if (ServerEndpoint::GetCurrentAuthenticatedUser() == 0)
+            {
+                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(
+                    node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
+                    "User attempted to access service without authenticating using EntryType " << m->EntryType);
+                throw PermissionDeniedException("User must authenticate before accessing this service");
+            }
+        }
+
+        rr_context_set_current_path(m_CurrentServicePath, m->ServicePath.str());
+        rr_context_set_current(m_CurrentServerContext, shared_from_this());
+
+        if (m->EntryType == MessageEntryType_WirePacket)
+        {
+            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
+                                                    "Received WirePacket, dispatching to member");
+            GetObjectSkel(m->ServicePath)->DispatchWireMessage(m, c->GetLocalEndpoint());
+        }
+        else
+        {
+            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
+                                                    "Received PipePacket, dispatching to member");
+            GetObjectSkel(m->ServicePath)->DispatchPipeMessage(m, c->GetLocalEndpoint());
+        }
+    }
+    catch (std::exception& e)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
+                                                "ProcessMessageEntry caught exception: " << e.what());
+    }
+    catch (...)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
+                                                "ProcessMessageEntry caught unknown exception");
+    }
+
+    rr_context_clear_current_path(m_CurrentServicePath);
+
+    rr_context_clear_current(m_CurrentServerContext);
+}
+
 RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRUSIVE_PTR<MessageEntry>& m,
                                                                   const RR_SHARED_PTR<ServerEndpoint>& c)
 {
@@ -1090,11 +1277,19 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
     bool noreturn = false;
     RR_INTRUSIVE_PTR<MessageEntry> ret = RR_INTRUSIVE_PTR<MessageEntry>();
 
-    if (m->EntryType == MessageEntryType_ServicePathReleasedRet)
+    switch (m->EntryType)
     {
+    case MessageEntryType_PipePacket:
+    case MessageEntryType_PipePacketRet:
+    case MessageEntryType_WirePacket:
+        DispatchPacketEntry(m, c);
+        return ret;
+    case MessageEntryType_ServicePathReleasedRet:
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                 "Received ServicePathReleasedRet");
-        return RR_INTRUSIVE_PTR<MessageEntry>();
+        return ret;
+    default:
+        break;
     }
 
     try
@@ -1115,11 +1310,6 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
             return ret;
         }
 
-        if (m->EntryType == MessageEntryType_ServiceCheckCapabilityReq)
-        {
-            ret = CheckServiceCapability(m, c);
-        }
-
         if (m_RequireValidUser)
         {
             if (ServerEndpoint::GetCurrentAuthenticatedUser() == 0)
@@ -1131,31 +1321,15 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
             }
         }
 
-        // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-        m_CurrentServicePath.reset(new std::string(m->ServicePath.str().to_string()));
-        m_CurrentServerContext.reset(new RR_SHARED_PTR<ServerContext>(shared_from_this()));
-        // NOLINTEND(cppcoreguidelines-owning-memory)
-
-        if (m->EntryType == MessageEntryType_PipePacket || m->EntryType == MessageEntryType_PipePacketRet)
-        {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
-                                                    "Received PipePacket, dispatching to member");
-            GetObjectSkel(m->ServicePath)->DispatchPipeMessage(m, c->GetLocalEndpoint());
-            ret.reset();
-            noreturn = true;
-        }
-
-        if (m->EntryType == MessageEntryType_WirePacket)
-        {
-            ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
-                                                    "Received WirePacket, dispatching to member");
-            GetObjectSkel(m->ServicePath)->DispatchWireMessage(m, c->GetLocalEndpoint());
-            ret.reset();
-            noreturn = true;
-        }
+        rr_context_set_current_path(m_CurrentServicePath, m->ServicePath.str());
+        rr_context_set_current(m_CurrentServerContext, shared_from_this());
 
-        if (m->EntryType == MessageEntryType_ObjectTypeName)
+        switch (m->EntryType)
         {
+        case MessageEntryType_ServiceCheckCapabilityReq:
+            ret = CheckServiceCapability(m, c);
+            break;
+        case MessageEntryType_ObjectTypeName: {
             RobotRaconteurVersion v;
             RR_INTRUSIVE_PTR<MessageElement> m_ver;
             if (m->TryFindElement("clientversion", m_ver))
@@ -1174,12 +1348,10 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
             ret = CreateMessageEntry(MessageEntryType_ObjectTypeNameRet, m->MemberName);
             std::string objtype = GetObjectType(m->ServicePath, v);
             ret->AddElement("objecttype", stringToRRArray(objtype));
+            break;
         }
-
         // Object member methods
-
-        if (m->EntryType == MessageEntryType_PropertyGetReq)
-        {
+        case MessageEntryType_PropertyGetReq: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received PropertyGet, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
@@ -1187,10 +1359,9 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
             ret = skel->CallGetProperty(m);
             if (!ret)
                 noreturn = true;
+            break;
         }
-
-        if (m->EntryType == MessageEntryType_PropertySetReq)
-        {
+        case MessageEntryType_PropertySetReq: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received PropertySet, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
@@ -1198,10 +1369,9 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
             ret = skel->CallSetProperty(m);
             if (!ret)
                 noreturn = true;
+            break;
         }
-
-        if (m->EntryType == MessageEntryType_FunctionCallReq)
-        {
+        case MessageEntryType_FunctionCallReq: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received FunctionCall, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
@@ -1209,41 +1379,40 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
             ret = skel->CallFunction(m);
             if (!ret)
                 noreturn = true;
+            break;
         }
-
-        if (m->EntryType == MessageEntryType_PipeConnectReq || m->EntryType == MessageEntryType_PipeDisconnectReq)
-        {
+        case MessageEntryType_PipeConnectReq:
+        case MessageEntryType_PipeDisconnectReq: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received PipeCommand, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
             check_lock(skel, m);
             ret = skel->CallPipeFunction(m, c->GetLocalEndpoint());
+            break;
         }
-
-        if (m->EntryType == MessageEntryType_WireConnectReq || m->EntryType == MessageEntryType_WireDisconnectReq ||
-            m->EntryType == MessageEntryType_WirePeekInValueReq ||
-            m->EntryType == MessageEntryType_WirePeekOutValueReq ||
-            m->EntryType == MessageEntryType_WirePokeOutValueReq)
-        {
+        case MessageEntryType_WireConnectReq:
+        case MessageEntryType_WireDisconnectReq:
+        case MessageEntryType_WirePeekInValueReq:
+        case MessageEntryType_WirePeekOutValueReq:
+        case MessageEntryType_WirePokeOutValueReq: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received WireCommand, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
             check_lock(skel, m);
             ret = skel->CallWireFunction(m, c->GetLocalEndpoint());
+            break;
         }
-
-        if (m->EntryType == MessageEntryType_MemoryWrite || m->EntryType == MessageEntryType_MemoryRead ||
-            m->EntryType == MessageEntryType_MemoryGetParam)
-        {
+        case MessageEntryType_MemoryWrite:
+        case MessageEntryType_MemoryRead:
+        case MessageEntryType_MemoryGetParam: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received MemoryCommand, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
             check_lock(skel, m);
             ret = skel->CallMemoryFunction(m, c);
+            break;
         }
-
-        else if (m->EntryType == MessageEntryType_CallbackCallRet)
-        {
+        case MessageEntryType_CallbackCallRet: {
             noreturn = true;
             RR_SHARED_PTR<outstanding_request> t;
             uint32_t requestid = m->RequestID;
@@ -1314,16 +1483,19 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
                     RobotRaconteurNode::TryHandleException(node, &exp2);
                 }
             }
+            break;
         }
-
-        if (m->EntryType == MessageEntryType_GeneratorNextReq)
-        {
+        case MessageEntryType_GeneratorNextReq: {
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, c->GetLocalEndpoint(), m->ServicePath, m->MemberName,
                                                     "Received GeneratorNext, dispatching to member");
             RR_SHARED_PTR<ServiceSkel> skel = GetObjectSkel(m->ServicePath);
             check_lock(skel, m);
             skel->CallGeneratorNext(m, c);
             noreturn = true;
+            break;
+        }
+        default:
+            break;
         }
     }
     catch (std::exception& e)
@@ -1360,9 +1532,9 @@ RR_INTRUSIVE_PTR<MessageEntry> ServerContext::ProcessMessageEntry(const RR_INTRU
         }
     }
 
-    m_CurrentServicePath.reset(0);
+    rr_context_clear_current_path(m_CurrentServicePath);
 
-    m_CurrentServerContext.reset(0);
+    rr_context_clear_current(m_CurrentServerContext);
 
     if (ret == 0 && !noreturn)
     {
@@ -1736,6 +1908,11 @@ void ServerContext::RemoveClient(const RR_SHARED_PTR<ServerEndpoint>& cendpoint)
     catch (std::exception&)
     {}
 
+    {
+        boost::mutex::scoped_lock lock(event_statistics_lock);
+        event_statistics.erase(ce);
+    }
+
     try
     {
         GetNode()->DeleteEndpoint(cendpoint);
@@ -2213,7 +2390,10 @@ void ServerContext::ReleaseServicePath1(const std::string& path)
                     boost::mutex::scoped_lock lock2(s->objectlock_lock);
                     RR_SHARED_PTR<ServerContext_ObjectLock> lock = s->objectlock.lock();
                     if (!lock)
+                    {
+                        skel_routes->Publish(skels);
                         return;
+                    }
                     if (lock->GetRootServicePath() == path1)
                     {
                         active_object_locks.erase(lock->GetUsername());
@@ -2232,6 +2412,8 @@ void ServerContext::ReleaseServicePath1(const std::string& path)
             s->ReleaseObject();
             ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Service, -1, path, "", "Object released");
         }
+
+        skel_routes->Publish(skels);
     }
 }
 
@@ -2590,12 +2772,12 @@ void ServerEndpoint::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
         SetLastMessageReceivedTime(GetNode()->NowNodeTime());
     }
     // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-    m_CurrentEndpoint.reset(new RR_SHARED_PTR<ServerEndpoint>(shared_from_this()));
+    rr_context_set_current(m_CurrentEndpoint, shared_from_this());
     m_CurrentAuthenticatedUser.reset(new RR_SHARED_PTR<AuthenticatedUser>(endpoint_authenticated_user));
     if (endpoint_authenticated_user != 0)
         endpoint_authenticated_user->UpdateLastAccess();
     service->MessageReceived(m, shared_from_this());
-    m_CurrentEndpoint.reset(0);
+    rr_context_clear_current(m_CurrentEndpoint);
     m_CurrentAuthenticatedUser.reset(0);
     // NOLINTEND(cppcoreguidelines-owning-memory)
 }
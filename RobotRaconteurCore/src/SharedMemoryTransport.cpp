@@ -0,0 +1,1898 @@
+// Copyright 2011-2020 Wason Technology, LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "boost_asio_win_unix_sockets_backport.h"
+
+#include "SharedMemoryTransport_private.h"
+#include "RobotRaconteur/Service.h"
+#include "RobotRaconteur/IOUtils.h"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/bind/placeholders.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/range/adaptors.hpp>
+#include <boost/range/algorithm.hpp>
+#include <boost/foreach.hpp>
+
+#ifndef ROBOTRACONTEUR_WINDOWS
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RobotRaconteur
+{
+
+static const char SharedMemoryTransport_connect_magic[8] = {'R', 'R', 'S', 'H', 'M', 'C', 'O', 'N'};
+static const char SharedMemoryTransport_ack_magic[8] = {'R', 'R', 'S', 'H', 'M', 'A', 'C', 'K'};
+static const char SharedMemoryTransport_array_magic[8] = {'R', 'R', 'S', 'H', 'M', 'A', 'R', 'R'};
+static const uint32_t SharedMemoryTransport_version = 1;
+static const size_t SharedMemoryTransport_connect_size = 36;
+static const size_t SharedMemoryTransport_ack_size = 28;
+static const size_t SharedMemoryTransport_max_name_size = 64;
+static const size_t SharedMemoryTransport_min_ring_size = 64 * 1024;
+static const size_t SharedMemoryTransport_max_ring_size = 1024 * 1024 * 1024;
+
+static boost::filesystem::path SharedMemoryTransport_GetTransportPath(const NodeDirectories& node_dirs)
+{
+    boost::filesystem::path path = node_dirs.user_run_dir / "transport" / "shm";
+
+    const char* subdirs[] = {"by-nodeid", "by-nodename", "socket", "segments"};
+    BOOST_FOREACH (const char* d, subdirs)
+    {
+        boost::system::error_code ec;
+        boost::filesystem::create_directories(path / d, ec);
+        if (ec)
+            throw SystemResourceException("Could not activate system for shared memory transport");
+    }
+
+    return path;
+}
+
+// Segment names are generated by the peer, so only accept plain file names
+static bool SharedMemoryTransport_IsValidSegmentName(boost::string_ref name, boost::string_ref extension)
+{
+    if (name.size() <= extension.size() || name.size() > SharedMemoryTransport_max_name_size)
+        return false;
+    if (!boost::ends_with(name, extension))
+        return false;
+    boost::string_ref stem = name.substr(0, name.size() - extension.size());
+    BOOST_FOREACH (char c, stem)
+    {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-')
+            return false;
+    }
+    return true;
+}
+
+static std::string SharedMemoryTransport_FindSocket(const ParseConnectionURLResult& url,
+                                                    const boost::filesystem::path& path)
+{
+    std::map<std::string, std::string> info_data;
+    if (!url.nodeid.IsAnyNode())
+    {
+        if (!NodeDirectoriesUtil::ReadInfoFile(path / "by-nodeid" / (url.nodeid.ToString("D") + ".info"), info_data))
+        {
+            return "";
+        }
+
+        if (!url.nodename.empty())
+        {
+            std::map<std::string, std::string>::iterator name1 = info_data.find("nodename");
+            if (name1 == info_data.end() || name1->second != url.nodename)
+            {
+                return "";
+            }
+        }
+    }
+    else
+    {
+        if (!NodeDirectoriesUtil::ReadInfoFile(path / "by-nodename" / (url.nodename + ".info"), info_data))
+        {
+            return "";
+        }
+    }
+
+    std::map<std::string, std::string>::iterator e = info_data.find("socket");
+    if (e == info_data.end())
+        return "";
+    return e->second;
+}
+
+static size_t SharedMemoryTransport_RecordSize(size_t len)
+{
+    return detail::SharedMemoryTransport_ring::record_header_size + ((len + 7) & ~static_cast<size_t>(7));
+}
+
+static bool SharedMemoryTransport_IsNumericArray(DataTypes type)
+{
+    switch (type)
+    {
+    case DataTypes_double_t:
+    case DataTypes_single_t:
+    case DataTypes_int8_t:
+    case DataTypes_uint8_t:
+    case DataTypes_int16_t:
+    case DataTypes_uint16_t:
+    case DataTypes_int32_t:
+    case DataTypes_uint32_t:
+    case DataTypes_int64_t:
+    case DataTypes_uint64_t:
+    case DataTypes_cdouble_t:
+    case DataTypes_csingle_t:
+    case DataTypes_bool_t:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool SharedMemoryTransport_IsNestedList(DataTypes type)
+{
+    switch (type)
+    {
+    case DataTypes_structure_t:
+    case DataTypes_vector_t:
+    case DataTypes_dictionary_t:
+    case DataTypes_multidimarray_t:
+    case DataTypes_list_t:
+    case DataTypes_pod_t:
+    case DataTypes_pod_array_t:
+    case DataTypes_pod_multidimarray_t:
+    case DataTypes_namedarray_array_t:
+    case DataTypes_namedarray_multidimarray_t:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool SharedMemoryTransport_HasSharedArrays(const std::vector<RR_INTRUSIVE_PTR<MessageElement> >& elements,
+                                                  size_t threshold)
+{
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageElement>& e, elements)
+    {
+        RR_INTRUSIVE_PTR<MessageElementData> dat = e->GetData();
+        if (!dat)
+            continue;
+        DataTypes type = dat->GetTypeID();
+        if (SharedMemoryTransport_IsNumericArray(type))
+        {
+            RR_INTRUSIVE_PTR<RRBaseArray> a = RR_STATIC_POINTER_CAST<RRBaseArray>(dat);
+            if (a->size() >= 2 && a->size() * a->ElementSize() >= threshold)
+                return true;
+        }
+        else if (SharedMemoryTransport_IsNestedList(type))
+        {
+            RR_INTRUSIVE_PTR<MessageElementNestedElementList> l =
+                RR_STATIC_POINTER_CAST<MessageElementNestedElementList>(dat);
+            if (SharedMemoryTransport_HasSharedArrays(l->Elements, threshold))
+                return true;
+        }
+    }
+    return false;
+}
+
+namespace detail
+{
+SharedMemoryTransport_ring::SharedMemoryTransport_ring(uint8_t* base, size_t size)
+{
+    BOOST_STATIC_ASSERT(sizeof(boost::atomic<uint64_t>) == 8);
+    BOOST_STATIC_ASSERT(sizeof(boost::atomic<uint32_t>) == 4);
+    write_pos = reinterpret_cast<boost::atomic<uint64_t>*>(base);
+    read_pos = reinterpret_cast<boost::atomic<uint64_t>*>(base + 64);
+    reader_waiting = reinterpret_cast<boost::atomic<uint32_t>*>(base + 128);
+    writer_waiting = reinterpret_cast<boost::atomic<uint32_t>*>(base + 132);
+    data = base + header_size;
+    this->size = size;
+    pending_write_pos = 0;
+    pending_read_pos = 0;
+}
+
+void SharedMemoryTransport_ring::Init()
+{
+    new (write_pos) boost::atomic<uint64_t>(0);
+    new (read_pos) boost::atomic<uint64_t>(0);
+    // The reader has not read anything yet, so the first write must ring the doorbell
+    new (reader_waiting) boost::atomic<uint32_t>(1);
+    new (writer_waiting) boost::atomic<uint32_t>(0);
+}
+
+size_t SharedMemoryTransport_ring::MaxRecordLength() const { return size / 2 - record_header_size; }
+
+uint8_t* SharedMemoryTransport_ring::BeginWrite(size_t len)
+{
+    size_t rec = SharedMemoryTransport_RecordSize(len);
+    uint64_t w = write_pos->load(boost::memory_order_relaxed);
+    uint64_t r = read_pos->load();
+
+    size_t offset = static_cast<size_t>(w % size);
+    size_t needed = rec;
+    bool wrap = offset + rec > size;
+    if (wrap)
+    {
+        needed += size - offset;
+    }
+
+    if (size - static_cast<size_t>(w - r) < needed)
+    {
+        return NULL;
+    }
+
+    if (wrap)
+    {
+        uint32_t header[2] = {SharedMemoryTransport_record_wrap,
+                              boost::numeric_cast<uint32_t>(size - offset - record_header_size)};
+        std::memcpy(data + offset, header, sizeof(header));
+        w += size - offset;
+        offset = 0;
+    }
+
+    pending_write_pos = w;
+    return data + offset + record_header_size;
+}
+
+bool SharedMemoryTransport_ring::EndWrite(uint32_t type, size_t len)
+{
+    uint32_t header[2] = {type, boost::numeric_cast<uint32_t>(len)};
+    std::memcpy(data + static_cast<size_t>(pending_write_pos % size), header, sizeof(header));
+    write_pos->store(pending_write_pos + SharedMemoryTransport_RecordSize(len));
+    return reader_waiting->load() != 0 && reader_waiting->exchange(0) != 0;
+}
+
+void SharedMemoryTransport_ring::SetWriterWaiting(bool waiting) { writer_waiting->store(waiting ? 1 : 0); }
+
+const uint8_t* SharedMemoryTransport_ring::BeginRead(uint32_t& type, size_t& len)
+{
+    uint64_t r = read_pos->load(boost::memory_order_relaxed);
+    uint64_t w = write_pos->load();
+
+    while (r != w)
+    {
+        size_t offset = static_cast<size_t>(r % size);
+        uint32_t header[2];
+        std::memcpy(header, data + offset, sizeof(header));
+        if (header[0] == SharedMemoryTransport_record_wrap)
+        {
+            r += size - offset;
+            continue;
+        }
+
+        size_t rec = SharedMemoryTransport_RecordSize(header[1]);
+        if (offset + rec > size || r + rec > w)
+        {
+            throw ProtocolException("Invalid shared memory ring buffer record");
+        }
+
+        type = header[0];
+        len = header[1];
+        pending_read_pos = r + rec;
+        return data + offset + record_header_size;
+    }
+
+    return NULL;
+}
+
+bool SharedMemoryTransport_ring::EndRead()
+{
+    read_pos->store(pending_read_pos);
+    return writer_waiting->load() != 0 && writer_waiting->exchange(0) != 0;
+}
+
+bool SharedMemoryTransport_ring::SetReaderWaiting()
+{
+    reader_waiting->store(1);
+    if (write_pos->load() == read_pos->load(boost::memory_order_relaxed))
+    {
+        return false;
+    }
+    reader_waiting->store(0);
+    return true;
+}
+
+SharedMemoryTransport_array_storage::SharedMemoryTransport_array_storage(const boost::filesystem::path& path,
+                                                                         size_t size)
+{
+    boost::interprocess::file_mapping f(path.string().c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region r(f, boost::interprocess::copy_on_write, 0, size);
+    region.swap(r);
+}
+
+void* SharedMemoryTransport_array_storage::Allocate(size_t size)
+{
+    if (size > region.get_size())
+    {
+        throw ProtocolException("Shared array segment too small");
+    }
+    return region.get_address();
+}
+
+void SharedMemoryTransport_array_storage::Release(void* p, size_t size)
+{
+    RR_UNUSED(p);
+    RR_UNUSED(size);
+}
+
+} // namespace detail
+
+SharedMemoryTransport::SharedMemoryTransport(const RR_SHARED_PTR<RobotRaconteurNode>& node) : Transport(node)
+{
+    if (!node)
+        throw InvalidArgumentException("Node cannot be null");
+
+    transportopen = false;
+    this->node = node;
+    is_server = false;
+
+    fds = RR_MAKE_SHARED<detail::SharedMemoryTransportFDs>();
+
+    ring_buffer_size = 4 * 1024 * 1024;
+    shared_array_threshold = 64 * 1024;
+
+    closed = false;
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "SharedMemoryTransport created");
+}
+
+SharedMemoryTransport::~SharedMemoryTransport() {}
+
+void SharedMemoryTransport::Close()
+{
+    {
+        boost::mutex::scoped_lock lock(closed_lock);
+        if (closed)
+            return;
+        closed = true;
+    }
+
+    try
+    {
+        boost::mutex::scoped_lock lock(acceptor_lock);
+        if (acceptor)
+        {
+            acceptor->acceptor.close();
+            acceptor.reset();
+        }
+    }
+    catch (std::exception&)
+    {}
+
+    std::vector<RR_SHARED_PTR<ITransportConnection> > t;
+
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        boost::copy(TransportConnections | boost::adaptors::map_values, std::back_inserter(t));
+    }
+
+    BOOST_FOREACH (RR_SHARED_PTR<ITransportConnection>& e, t)
+    {
+        try
+        {
+            e->Close();
+        }
+        catch (std::exception&)
+        {}
+    }
+
+    {
+        boost::mutex::scoped_lock lock(fds_lock);
+        fds.reset();
+        fds = RR_MAKE_SHARED<detail::SharedMemoryTransportFDs>();
+    }
+
+    {
+        boost::mutex::scoped_lock lock(acceptor_lock);
+        if (!socket_file_name.empty())
+        {
+            boost::system::error_code ec;
+            boost::filesystem::remove(socket_file_name, ec);
+        }
+    }
+
+    close_signal();
+
+    ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, -1, "SharedMemoryTransport closed");
+}
+
+bool SharedMemoryTransport::IsServer() const { return is_server; }
+
+bool SharedMemoryTransport::IsClient() const { return true; }
+
+std::string SharedMemoryTransport::GetUrlSchemeString() const { return "rr+shm"; }
+
+std::vector<std::string> SharedMemoryTransport::GetServerListenUrls()
+{
+    std::vector<std::string> o;
+    if (is_server)
+    {
+        NodeID nodeid = GetNode()->NodeID();
+        o.push_back("rr+shm:///?nodeid=" + nodeid.ToString("D"));
+    }
+    return o;
+}
+
+bool SharedMemoryTransport::CanConnectService(boost::string_ref url) { return (boost::starts_with(url, "rr+shm://")); }
+
+bool SharedMemoryTransport::IsSharedMemoryTransportSupported()
+{
+#ifdef ROBOTRACONTEUR_WINDOWS
+    return false;
+#else
+    return boost::atomic<uint64_t>::is_always_lock_free && boost::atomic<uint32_t>::is_always_lock_free;
+#endif
+}
+
+void SharedMemoryTransport::AsyncCreateTransportConnection(
+    boost::string_ref url, const RR_SHARED_PTR<Endpoint>& ep,
+    boost::function<void(const RR_SHARED_PTR<ITransportConnection>&, const RR_SHARED_PTR<RobotRaconteurException>&)>&
+        handler)
+{
+    ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                      "SharedMemoryTransport begin create transport connection with URL: " << url);
+
+    if (!IsSharedMemoryTransportSupported())
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                           "SharedMemoryTransport not supported on this operating system");
+        throw ConnectionException("SharedMemoryTransport not supported on this operating system");
+    }
+
+    ParseConnectionURLResult url_res = ParseConnectionURL(url);
+
+    if (url_res.nodename.empty() && url_res.nodeid.IsAnyNode())
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(
+            node, Transport, ep->GetLocalEndpoint(),
+            "SharedMemoryTransport NodeID and/or NodeName not specified in URL: " << url);
+        throw ConnectionException("NodeID and/or NodeName must be specified for SharedMemoryTransport");
+    }
+
+    if (url_res.port != -1)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                           "SharedMemoryTransport must not contain port, invalid URL: " << url);
+        throw ConnectionException("Invalid url for SharedMemoryTransport");
+    }
+    if (!url_res.path.empty() && url_res.path != "/")
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                           "SharedMemoryTransport must not contain a path, invalid URL: " << url);
+        throw ConnectionException("Invalid url for SharedMemoryTransport");
+    }
+    if (!url_res.host.empty() && url_res.host != "localhost")
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                           "SharedMemoryTransport must not contain a hostname, invalid URL: " << url);
+        throw ConnectionException("Invalid url for SharedMemoryTransport");
+    }
+
+    NodeDirectories node_dirs = GetNode()->GetNodeDirectories();
+    boost::filesystem::path transport_path = SharedMemoryTransport_GetTransportPath(node_dirs);
+
+    std::string socket_name = SharedMemoryTransport_FindSocket(url_res, transport_path);
+    if (socket_name.empty())
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                           "SharedMemoryTransport could not find node for URL: " << url);
+        throw ConnectionException("Could not connect to service");
+    }
+
+    RR_SHARED_PTR<detail::SharedMemoryTransport_socket> socket =
+        RR_MAKE_SHARED<detail::SharedMemoryTransport_socket>(boost::ref(GetNode()->GetThreadPool()->get_io_context()));
+    boost::system::error_code ec;
+    socket->socket->connect(boost::asio::local::stream_protocol::endpoint(socket_name), ec);
+    if (ec)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, ep->GetLocalEndpoint(),
+                                           "SharedMemoryTransport could not connect to socket \""
+                                               << socket_name << "\": " << ec.message());
+        throw ConnectionException("Could not connect to service");
+    }
+
+    RR_SHARED_PTR<SharedMemoryTransportConnection> connection =
+        RR_MAKE_SHARED<SharedMemoryTransportConnection>(shared_from_this(), false, ep->GetLocalEndpoint());
+
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+        boost::bind(&SharedMemoryTransport::AsyncCreateTransportConnection2, shared_from_this(), connection,
+                    RR_BOOST_PLACEHOLDERS(_1), handler);
+    connection->AsyncAttachClient(socket, url_res.nodeid, h);
+}
+
+void SharedMemoryTransport::AsyncCreateTransportConnection2(
+    const RR_SHARED_PTR<SharedMemoryTransportConnection>& connection, const RR_SHARED_PTR<RobotRaconteurException>& err,
+    const boost::function<void(const RR_SHARED_PTR<ITransportConnection>&,
+                               const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    if (err)
+    {
+        ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, connection->GetLocalEndpoint(),
+                                          "SharedMemoryTransport failed to connect: " << err->what());
+        try
+        {
+            handler(RR_SHARED_PTR<ITransportConnection>(), err);
+        }
+        catch (std::exception& err2)
+        {
+            RobotRaconteurNode::TryHandleException(node, &err2);
+        }
+        return;
+    }
+
+    register_transport(connection);
+
+    ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, connection->GetLocalEndpoint(),
+                                      "SharedMemoryTransport connected transport");
+    handler(connection, RR_SHARED_PTR<RobotRaconteurException>());
+}
+
+RR_SHARED_PTR<ITransportConnection> SharedMemoryTransport::CreateTransportConnection(boost::string_ref url,
+                                                                                     const RR_SHARED_PTR<Endpoint>& e)
+{
+    ROBOTRACONTEUR_ASSERT_MULTITHREADED(node);
+
+    RR_SHARED_PTR<detail::sync_async_handler<ITransportConnection> > d =
+        RR_MAKE_SHARED<detail::sync_async_handler<ITransportConnection> >(
+            RR_MAKE_SHARED<ConnectionException>("Timeout exception"));
+
+    boost::function<void(const RR_SHARED_PTR<ITransportConnection>&, const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+        boost::bind(&detail::sync_async_handler<ITransportConnection>::operator(), d, RR_BOOST_PLACEHOLDERS(_1),
+                    RR_BOOST_PLACEHOLDERS(_2));
+    AsyncCreateTransportConnection(url, e, h);
+
+    return d->end();
+}
+
+void SharedMemoryTransport::CloseTransportConnection(const RR_SHARED_PTR<Endpoint>& e)
+{
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, e->GetLocalEndpoint(),
+                                       "SharedMemoryTransport request close transport connection");
+
+    RR_SHARED_PTR<ServerEndpoint> e2 = boost::dynamic_pointer_cast<ServerEndpoint>(e);
+    if (e2)
+    {
+        RR_SHARED_PTR<boost::asio::deadline_timer> timer(
+            new boost::asio::deadline_timer(GetNode()->GetThreadPool()->get_io_context()));
+        timer->expires_from_now(boost::posix_time::milliseconds(1000));
+        RobotRaconteurNode::asio_async_wait(node, timer,
+                                            boost::bind(&SharedMemoryTransport::CloseTransportConnection_timed,
+                                                        shared_from_this(), boost::asio::placeholders::error, e,
+                                                        timer));
+        return;
+    }
+
+    RR_SHARED_PTR<ITransportConnection> t;
+
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e1 =
+            TransportConnections.find(e->GetLocalEndpoint());
+        if (e1 == TransportConnections.end())
+            return;
+        t = e1->second;
+        TransportConnections.erase(e1);
+    }
+
+    if (t)
+    {
+        try
+        {
+            t->Close();
+        }
+        catch (std::exception&)
+        {}
+    }
+}
+
+void SharedMemoryTransport::CloseTransportConnection_timed(const boost::system::error_code& err,
+                                                           const RR_SHARED_PTR<Endpoint>& e,
+                                                           const RR_SHARED_PTR<void>& timer)
+{
+    RR_UNUSED(timer);
+    if (err)
+        return;
+
+    RR_SHARED_PTR<ITransportConnection> t;
+
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e1 =
+            TransportConnections.find(e->GetLocalEndpoint());
+        if (e1 == TransportConnections.end())
+            return;
+        t = e1->second;
+    }
+
+    if (t)
+    {
+        try
+        {
+            t->Close();
+        }
+        catch (std::exception&)
+        {}
+    }
+}
+
+void SharedMemoryTransport::StartServer()
+{
+    if (!IsSharedMemoryTransportSupported())
+    {
+        ROBOTRACONTEUR_LOG_WARNING_COMPONENT(
+            node, Transport, -1,
+            "SharedMemoryTransport not supported on this operating system. Other transports will operate normally");
+        return;
+    }
+
+    NodeID nodeid = GetNode()->NodeID();
+    std::string nodename;
+    GetNode()->TryGetNodeName(nodename);
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1,
+                                       "SharedMemoryTransport starting server with NodeID " << nodeid.ToString());
+
+    NodeDirectories node_dirs = GetNode()->GetNodeDirectories();
+
+    try
+    {
+        boost::mutex::scoped_lock lock(acceptor_lock);
+
+        if (acceptor)
+            throw InvalidOperationException("SharedMemoryTransport server already started");
+
+        boost::filesystem::path transport_path = SharedMemoryTransport_GetTransportPath(node_dirs);
+
+        int32_t tries = 0;
+        std::string pipename;
+
+        while (true)
+        {
+            pipename = (transport_path / "socket" / (GetNode()->GetRandomString(16) + ".sock")).string();
+
+            sockaddr_un empty_sockaddr = {};
+            if (pipename.size() > (sizeof(empty_sockaddr.sun_path) - 1))
+            {
+                throw SystemResourceException("Local socket path name exceeds UNIX_PATH_MAX");
+            }
+
+            try
+            {
+                boost::asio::local::stream_protocol::endpoint ep(pipename);
+                acceptor = RR_MAKE_SHARED<detail::SharedMemoryTransport_acceptor>(
+                    boost::ref(GetNode()->GetThreadPool()->get_io_context()));
+                acceptor->acceptor.open();
+                acceptor->acceptor.bind(ep);
+                acceptor->acceptor.listen();
+#ifndef ROBOTRACONTEUR_WINDOWS
+                chmod(pipename.c_str(), S_IRWXU);
+#endif
+                break;
+            }
+            catch (std::exception&)
+            {
+                acceptor.reset();
+                tries++;
+                if (tries > 3)
+                    throw;
+            }
+        }
+
+        std::map<std::string, std::string> info;
+        info.insert(std::make_pair("nodename", nodename));
+        info.insert(std::make_pair("nodeid", nodeid.ToString()));
+        info.insert(std::make_pair("socket", pipename));
+        info.insert(std::make_pair("ServiceStateNonce", GetNode()->GetServiceStateNonce()));
+
+        RR_SHARED_PTR<detail::SharedMemoryTransportFDs> fds1 = RR_MAKE_SHARED<detail::SharedMemoryTransportFDs>();
+        try
+        {
+            fds1->h_pid_id_s =
+                NodeDirectoriesUtil::CreatePidFile(transport_path / "by-nodeid" / (nodeid.ToString("D") + ".pid"));
+            fds1->h_info_id_s = NodeDirectoriesUtil::CreateInfoFile(
+                transport_path / "by-nodeid" / (nodeid.ToString("D") + ".info"), info);
+        }
+        catch (NodeDirectoriesResourceAlreadyInUse&)
+        {
+            throw NodeIDAlreadyInUse();
+        }
+
+        if (!nodename.empty())
+        {
+            try
+            {
+                fds1->h_pid_name_s =
+                    NodeDirectoriesUtil::CreatePidFile(transport_path / "by-nodename" / (nodename + ".pid"));
+                fds1->h_info_name_s =
+                    NodeDirectoriesUtil::CreateInfoFile(transport_path / "by-nodename" / (nodename + ".info"), info);
+            }
+            catch (NodeDirectoriesResourceAlreadyInUse&)
+            {
+                throw NodeNameAlreadyInUse();
+            }
+        }
+
+        RR_SHARED_PTR<detail::SharedMemoryTransport_socket> socket =
+            RR_MAKE_SHARED<detail::SharedMemoryTransport_socket>(
+                boost::ref(GetNode()->GetThreadPool()->get_next_io_context()));
+        acceptor->acceptor.async_accept(*socket->socket,
+                                        boost::bind(&SharedMemoryTransport::handle_accept, shared_from_this(),
+                                                    acceptor, socket, boost::asio::placeholders::error));
+
+        {
+            boost::mutex::scoped_lock lock2(fds_lock);
+            fds = fds1;
+        }
+
+        socket_file_name = pipename;
+        is_server = true;
+
+        ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, -1,
+                                          "SharedMemoryTransport started server for NodeID "
+                                              << nodeid.ToString() << " unix socket " << pipename);
+    }
+    catch (std::exception& exp)
+    {
+        ROBOTRACONTEUR_LOG_ERROR_COMPONENT(node, Transport, -1,
+                                           "SharedMemoryTransport could not start server: " << exp.what());
+        throw;
+    }
+}
+
+void SharedMemoryTransport::handle_accept(const RR_SHARED_PTR<SharedMemoryTransport>& parent,
+                                          const RR_SHARED_PTR<detail::SharedMemoryTransport_acceptor>& acceptor,
+                                          const RR_SHARED_PTR<detail::SharedMemoryTransport_socket>& socket,
+                                          const boost::system::error_code& error)
+{
+    if (error)
+        return;
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(parent->node, Transport, 0, "SharedMemoryTransport accepted socket");
+    try
+    {
+        RR_SHARED_PTR<SharedMemoryTransportConnection> connection =
+            RR_MAKE_SHARED<SharedMemoryTransportConnection>(parent, true, 0);
+        boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h = boost::bind(
+            &SharedMemoryTransport::handle_accept2, parent, connection, RR_BOOST_PLACEHOLDERS(_1));
+        connection->AsyncAttachServer(socket, h);
+    }
+    catch (std::exception& exp)
+    {
+        ROBOTRACONTEUR_LOG_INFO_COMPONENT(parent->node, Transport, 0,
+                                          "SharedMemoryTransport accepted socket closed with error: " << exp.what());
+        RobotRaconteurNode::TryHandleException(parent->node, &exp);
+    }
+
+    boost::mutex::scoped_lock lock(parent->acceptor_lock);
+    if (!parent->acceptor)
+        return;
+
+    RR_SHARED_PTR<detail::SharedMemoryTransport_socket> socket2 = RR_MAKE_SHARED<detail::SharedMemoryTransport_socket>(
+        boost::ref(parent->GetNode()->GetThreadPool()->get_next_io_context()));
+    acceptor->acceptor.async_accept(*socket2->socket, boost::bind(&SharedMemoryTransport::handle_accept, parent,
+                                                                  acceptor, socket2, boost::asio::placeholders::error));
+}
+
+void SharedMemoryTransport::handle_accept2(const RR_SHARED_PTR<SharedMemoryTransportConnection>& connection,
+                                           const RR_SHARED_PTR<RobotRaconteurException>& err)
+{
+    if (err)
+    {
+        ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, 0,
+                                          "SharedMemoryTransport failed to accept connection: " << err->what());
+        return;
+    }
+
+    // The connection is registered when the client connect request assigns the endpoint
+    ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, 0,
+                                      "SharedMemoryTransport accepted connection from node "
+                                          << connection->GetRemoteNodeID().ToString());
+}
+
+void SharedMemoryTransport::SendMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    RR_SHARED_PTR<ITransportConnection> t;
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e1 =
+            TransportConnections.find(m->header->SenderEndpoint);
+        if (e1 == TransportConnections.end())
+        {
+            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m->header->SenderEndpoint,
+                                               "Transport connection to remote host not found");
+            throw ConnectionException("Transport connection to remote host not found");
+        }
+        t = e1->second;
+    }
+    t->SendMessage(m);
+}
+
+void SharedMemoryTransport::AsyncSendMessage(
+    const RR_INTRUSIVE_PTR<Message>& m,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_SHARED_PTR<ITransportConnection> t;
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e1 =
+            TransportConnections.find(m->header->SenderEndpoint);
+        if (e1 == TransportConnections.end())
+        {
+            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m->header->SenderEndpoint,
+                                               "Transport connection to remote host not found");
+            throw ConnectionException("Transport connection to remote host not found");
+        }
+        t = e1->second;
+    }
+    t->AsyncSendMessage(m, handler);
+}
+
+uint32_t SharedMemoryTransport::TransportCapability(boost::string_ref name)
+{
+    RR_UNUSED(name);
+    return 0;
+}
+
+void SharedMemoryTransport::PeriodicCleanupTask()
+{
+    boost::mutex::scoped_lock lock(TransportConnections_lock);
+    for (RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e = TransportConnections.begin();
+         e != TransportConnections.end();)
+    {
+        try
+        {
+            RR_SHARED_PTR<SharedMemoryTransportConnection> e2 = rr_cast<SharedMemoryTransportConnection>(e->second);
+            if (!e2->IsConnected())
+            {
+                e = TransportConnections.erase(e);
+            }
+            else
+            {
+                e++;
+            }
+        }
+        catch (std::exception&)
+        {}
+    }
+}
+
+void SharedMemoryTransport::CheckConnection(uint32_t endpoint)
+{
+    RR_SHARED_PTR<ITransportConnection> t;
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e =
+            TransportConnections.find(endpoint);
+        if (e == TransportConnections.end())
+        {
+            ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, endpoint,
+                                               "Transport connection to remote host not found");
+            throw ConnectionException("Transport connection to remote host not found");
+        }
+        t = e->second;
+    }
+    t->CheckConnection(endpoint);
+}
+
+void SharedMemoryTransport::register_transport(const RR_SHARED_PTR<ITransportConnection>& connection)
+{
+    boost::mutex::scoped_lock lock(TransportConnections_lock);
+    TransportConnections.insert(std::make_pair(connection->GetLocalEndpoint(), connection));
+}
+
+void SharedMemoryTransport::erase_transport(const RR_SHARED_PTR<ITransportConnection>& connection)
+{
+    try
+    {
+        boost::mutex::scoped_lock lock(TransportConnections_lock);
+        RR_UNORDERED_MAP<uint32_t, RR_SHARED_PTR<ITransportConnection> >::iterator e1 =
+            TransportConnections.find(connection->GetLocalEndpoint());
+        if (e1 == TransportConnections.end())
+            return;
+        if (e1->second == connection)
+        {
+            TransportConnections.erase(e1);
+        }
+    }
+    catch (std::exception&)
+    {}
+
+    TransportConnectionClosed(connection->GetLocalEndpoint());
+}
+
+void SharedMemoryTransport::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m) { GetNode()->MessageReceived(m); }
+
+void SharedMemoryTransport::AsyncGetDetectedNodes(
+    const std::vector<std::string>& schemes,
+    const boost::function<void(const RR_SHARED_PTR<std::vector<NodeDiscoveryInfo> >&)>& handler, int32_t timeout)
+{
+    RR_UNUSED(timeout);
+    RR_SHARED_PTR<std::vector<NodeDiscoveryInfo> > o = RR_MAKE_SHARED<std::vector<NodeDiscoveryInfo> >();
+    if (boost::range::find(schemes, "rr+shm") == schemes.end() || schemes.empty() ||
+        !IsSharedMemoryTransportSupported())
+    {
+        detail::PostHandler(node, handler, o, true);
+        return;
+    }
+
+    NodeDirectories node_dirs = GetNode()->GetNodeDirectories();
+    boost::filesystem::path search_dir = SharedMemoryTransport_GetTransportPath(node_dirs);
+    detail::LocalTransportUtil::FindNodesInDirectory(*o, search_dir, "rr+shm", GetNode()->NowNodeTime());
+
+    detail::PostHandler(node, handler, o, true);
+}
+
+void SharedMemoryTransport::LocalNodeServicesChanged()
+{
+    boost::mutex::scoped_lock lock(fds_lock);
+    if (fds && fds->h_info_id_s)
+    {
+        std::map<std::string, std::string> updated_info;
+        updated_info.insert(std::make_pair("ServiceStateNonce", GetNode()->GetServiceStateNonce()));
+        NodeDirectoriesUtil::RefreshInfoFile(fds->h_info_id_s, updated_info);
+        if (fds->h_info_name_s)
+        {
+            NodeDirectoriesUtil::RefreshInfoFile(fds->h_info_name_s, updated_info);
+        }
+    }
+}
+
+size_t SharedMemoryTransport::GetRingBufferSize()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return ring_buffer_size;
+}
+
+void SharedMemoryTransport::SetRingBufferSize(size_t size)
+{
+    if (size < SharedMemoryTransport_min_ring_size || size > SharedMemoryTransport_max_ring_size)
+    {
+        ROBOTRACONTEUR_LOG_WARNING_COMPONENT(node, Transport, -1, "Invalid RingBufferSize: " << size);
+        throw InvalidArgumentException("Invalid ring buffer size");
+    }
+    boost::mutex::scoped_lock lock(parameter_lock);
+    ring_buffer_size = (size + 7) & ~static_cast<size_t>(7);
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "RingBufferSize set to " << ring_buffer_size << " bytes");
+}
+
+size_t SharedMemoryTransport::GetSharedArrayThreshold()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return shared_array_threshold;
+}
+
+void SharedMemoryTransport::SetSharedArrayThreshold(size_t threshold)
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    shared_array_threshold = threshold;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1,
+                                       "SharedArrayThreshold set to " << threshold << " bytes");
+}
+
+SharedMemoryTransportConnection::SharedMemoryTransportConnection(const RR_SHARED_PTR<SharedMemoryTransport>& parent,
+                                                                 bool server, uint32_t local_endpoint)
+    : connected(false), segment_count(0)
+{
+    this->parent = parent;
+    this->server = server;
+    this->m_LocalEndpoint = local_endpoint;
+    this->m_RemoteEndpoint = 0;
+    this->node = parent->GetNode();
+    this->ring_size = parent->GetRingBufferSize();
+    this->shared_array_threshold = parent->GetSharedArrayThreshold();
+    this->doorbell_active = false;
+    this->recv_active = false;
+    this->recv_again = false;
+    this->connection_id = parent->GetNode()->GetRandomString(16);
+    this->segment_dir = SharedMemoryTransport_GetTransportPath(parent->GetNode()->GetNodeDirectories()) / "segments";
+}
+
+SharedMemoryTransportConnection::~SharedMemoryTransportConnection() {}
+
+void SharedMemoryTransportConnection::MapRingSegment(const boost::filesystem::path& path, bool create)
+{
+    size_t ring_total = detail::SharedMemoryTransport_ring::header_size + ring_size;
+    if (create)
+    {
+        {
+            boost::filesystem::ofstream f(path, std::ios::binary | std::ios::trunc);
+            if (!f.is_open())
+            {
+                throw SystemResourceException("Could not create shared memory segment " + path.string());
+            }
+        }
+        boost::filesystem::resize_file(path, 2 * ring_total);
+    }
+    else if (boost::filesystem::file_size(path) != 2 * ring_total)
+    {
+        throw ProtocolException("Invalid shared memory segment size");
+    }
+
+    boost::interprocess::file_mapping f(path.string().c_str(), boost::interprocess::read_write);
+    ring_region.reset(new boost::interprocess::mapped_region(f, boost::interprocess::read_write, 0, 2 * ring_total));
+
+    // The first ring carries messages from the client to the server
+    uint8_t* base = static_cast<uint8_t*>(ring_region->get_address());
+    detail::SharedMemoryTransport_ring* ring1 = new detail::SharedMemoryTransport_ring(base, ring_size);
+    detail::SharedMemoryTransport_ring* ring2 = new detail::SharedMemoryTransport_ring(base + ring_total, ring_size);
+    if (create)
+    {
+        ring1->Init();
+        ring2->Init();
+    }
+    send_ring.reset(server ? ring2 : ring1);
+    recv_ring.reset(server ? ring1 : ring2);
+}
+
+void SharedMemoryTransportConnection::AsyncAttachClient(
+    const RR_SHARED_PTR<detail::SharedMemoryTransport_socket>& socket, const NodeID& target_nodeid,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    this->socket = socket;
+    this->target_nodeid = target_nodeid;
+
+    std::string segment_name = connection_id + ".shm";
+    MapRingSegment(segment_dir / segment_name, true);
+
+    uint32_t ring_size1 = boost::numeric_cast<uint32_t>(ring_size);
+    uint32_t name_size = boost::numeric_cast<uint32_t>(segment_name.size());
+    boost::array<uint8_t, 16> nodeid_bytes = GetNode()->NodeID().ToByteArray();
+    std::memcpy(&handshake_buf[0], SharedMemoryTransport_connect_magic, 8);
+    std::memcpy(&handshake_buf[8], &SharedMemoryTransport_version, 4);
+    std::memcpy(&handshake_buf[12], &ring_size1, 4);
+    std::memcpy(&handshake_buf[16], &nodeid_bytes[0], 16);
+    std::memcpy(&handshake_buf[32], &name_size, 4);
+    std::memcpy(&handshake_buf[36], segment_name.c_str(), name_size);
+
+    boost::mutex::scoped_lock lock(socket_lock);
+    boost::asio::async_write(*socket->socket,
+                             boost::asio::buffer(&handshake_buf[0], SharedMemoryTransport_connect_size + name_size),
+                             boost::bind(&SharedMemoryTransportConnection::client_handshake1, shared_from_this(),
+                                         boost::asio::placeholders::error,
+                                         boost::asio::placeholders::bytes_transferred, handler));
+}
+
+void SharedMemoryTransportConnection::client_handshake1(
+    const boost::system::error_code& ec, size_t bytes_transferred,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(bytes_transferred);
+    if (ec)
+    {
+        HandshakeFailed(handler, "Could not send shared memory connect request: " + ec.message());
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(socket_lock);
+    boost::asio::async_read(*socket->socket, boost::asio::buffer(&handshake_buf[0], SharedMemoryTransport_ack_size),
+                            boost::bind(&SharedMemoryTransportConnection::client_handshake2, shared_from_this(),
+                                        boost::asio::placeholders::error,
+                                        boost::asio::placeholders::bytes_transferred, handler));
+}
+
+void SharedMemoryTransportConnection::client_handshake2(
+    const boost::system::error_code& ec, size_t bytes_transferred,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(bytes_transferred);
+
+    // Both sides have the segment mapped or the connection failed, so the file is no longer needed
+    boost::system::error_code ec2;
+    boost::filesystem::remove(segment_dir / (connection_id + ".shm"), ec2);
+
+    if (ec)
+    {
+        HandshakeFailed(handler, "Could not read shared memory connect response: " + ec.message());
+        return;
+    }
+
+    uint32_t status = 0;
+    std::memcpy(&status, &handshake_buf[8], 4);
+    if (std::memcmp(&handshake_buf[0], SharedMemoryTransport_ack_magic, 8) != 0 || status != 0)
+    {
+        HandshakeFailed(handler, "Shared memory connect request rejected");
+        return;
+    }
+
+    boost::array<uint8_t, 16> nodeid_bytes = {};
+    std::memcpy(&nodeid_bytes[0], &handshake_buf[12], 16);
+    NodeID remote_nodeid(nodeid_bytes);
+    if (!target_nodeid.IsAnyNode() && target_nodeid != remote_nodeid)
+    {
+        HandshakeFailed(handler, "Unexpected NodeID in shared memory connect response");
+        return;
+    }
+
+    {
+        boost::unique_lock<boost::shared_mutex> lock(RemoteNodeID_lock);
+        RemoteNodeID = remote_nodeid;
+    }
+
+    StartReceive();
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m_LocalEndpoint,
+                                       "SharedMemoryTransport client connection established");
+
+    detail::InvokeHandler(node, handler);
+}
+
+void SharedMemoryTransportConnection::AsyncAttachServer(
+    const RR_SHARED_PTR<detail::SharedMemoryTransport_socket>& socket,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    this->socket = socket;
+
+    boost::mutex::scoped_lock lock(socket_lock);
+    boost::asio::async_read(*socket->socket,
+                            boost::asio::buffer(&handshake_buf[0], SharedMemoryTransport_connect_size),
+                            boost::bind(&SharedMemoryTransportConnection::server_handshake1, shared_from_this(),
+                                        boost::asio::placeholders::error,
+                                        boost::asio::placeholders::bytes_transferred, handler));
+}
+
+void SharedMemoryTransportConnection::server_handshake1(
+    const boost::system::error_code& ec, size_t bytes_transferred,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(bytes_transferred);
+    if (ec)
+    {
+        HandshakeFailed(handler, "Could not read shared memory connect request: " + ec.message());
+        return;
+    }
+
+    uint32_t version = 0;
+    uint32_t ring_size1 = 0;
+    uint32_t name_size = 0;
+    std::memcpy(&version, &handshake_buf[8], 4);
+    std::memcpy(&ring_size1, &handshake_buf[12], 4);
+    std::memcpy(&name_size, &handshake_buf[32], 4);
+
+    if (std::memcmp(&handshake_buf[0], SharedMemoryTransport_connect_magic, 8) != 0 ||
+        version != SharedMemoryTransport_version || ring_size1 < SharedMemoryTransport_min_ring_size ||
+        ring_size1 > SharedMemoryTransport_max_ring_size || (ring_size1 % 8) != 0 || name_size == 0 ||
+        name_size > SharedMemoryTransport_max_name_size)
+    {
+        HandshakeFailed(handler, "Invalid shared memory connect request");
+        return;
+    }
+
+    boost::array<uint8_t, 16> nodeid_bytes = {};
+    std::memcpy(&nodeid_bytes[0], &handshake_buf[16], 16);
+    {
+        boost::unique_lock<boost::shared_mutex> lock(RemoteNodeID_lock);
+        RemoteNodeID = NodeID(nodeid_bytes);
+    }
+
+    ring_size = ring_size1;
+    handshake_name.resize(name_size);
+
+    boost::mutex::scoped_lock lock(socket_lock);
+    boost::asio::async_read(*socket->socket, boost::asio::buffer(&handshake_name[0], name_size),
+                            boost::bind(&SharedMemoryTransportConnection::server_handshake2, shared_from_this(),
+                                        boost::asio::placeholders::error,
+                                        boost::asio::placeholders::bytes_transferred, handler));
+}
+
+void SharedMemoryTransportConnection::server_handshake2(
+    const boost::system::error_code& ec, size_t bytes_transferred,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(bytes_transferred);
+    if (ec)
+    {
+        HandshakeFailed(handler, "Could not read shared memory connect request: " + ec.message());
+        return;
+    }
+
+    if (!SharedMemoryTransport_IsValidSegmentName(handshake_name, ".shm"))
+    {
+        HandshakeFailed(handler, "Invalid shared memory segment name");
+        return;
+    }
+
+    try
+    {
+        MapRingSegment(segment_dir / handshake_name, false);
+    }
+    catch (std::exception& exp)
+    {
+        HandshakeFailed(handler, std::string("Could not map shared memory segment: ") + exp.what());
+        return;
+    }
+
+    uint32_t status = 0;
+    boost::array<uint8_t, 16> nodeid_bytes = GetNode()->NodeID().ToByteArray();
+    std::memcpy(&handshake_buf[0], SharedMemoryTransport_ack_magic, 8);
+    std::memcpy(&handshake_buf[8], &status, 4);
+    std::memcpy(&handshake_buf[12], &nodeid_bytes[0], 16);
+
+    boost::mutex::scoped_lock lock(socket_lock);
+    boost::asio::async_write(*socket->socket, boost::asio::buffer(&handshake_buf[0], SharedMemoryTransport_ack_size),
+                             boost::bind(&SharedMemoryTransportConnection::server_handshake3, shared_from_this(),
+                                         boost::asio::placeholders::error,
+                                         boost::asio::placeholders::bytes_transferred, handler));
+}
+
+void SharedMemoryTransportConnection::server_handshake3(
+    const boost::system::error_code& ec, size_t bytes_transferred,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    RR_UNUSED(bytes_transferred);
+    if (ec)
+    {
+        HandshakeFailed(handler, "Could not send shared memory connect response: " + ec.message());
+        return;
+    }
+
+    StartReceive();
+
+    detail::InvokeHandler(node, handler);
+}
+
+void SharedMemoryTransportConnection::HandshakeFailed(
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler, const std::string& message)
+{
+    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint, "SharedMemoryTransport " << message);
+
+    {
+        boost::mutex::scoped_lock lock(socket_lock);
+        boost::system::error_code ec;
+        socket->socket->close(ec);
+    }
+
+    detail::InvokeHandlerWithException(node, handler, RR_MAKE_SHARED<ConnectionException>(message));
+}
+
+void SharedMemoryTransportConnection::StartReceive()
+{
+    connected.store(true);
+    BeginReceive();
+    // Messages may have been written before the receive loop started
+    ProcessRecvRing();
+}
+
+void SharedMemoryTransportConnection::BeginReceive()
+{
+    boost::mutex::scoped_lock lock(socket_lock);
+    if (!connected.load())
+        return;
+
+    socket->socket->async_read_some(boost::asio::buffer(recv_doorbell_buf),
+                                    boost::bind(&SharedMemoryTransportConnection::EndReceive, shared_from_this(),
+                                                boost::asio::placeholders::error,
+                                                boost::asio::placeholders::bytes_transferred));
+}
+
+void SharedMemoryTransportConnection::EndReceive(const boost::system::error_code& ec, size_t bytes_transferred)
+{
+    RR_UNUSED(bytes_transferred);
+    if (ec)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                           "SharedMemoryTransport socket closed: " << ec.message());
+        Close();
+        return;
+    }
+
+    // The doorbell bytes only wake this side, both rings are checked for any byte. The next
+    // read is started first so a handler that blocks waiting for space in the send ring can
+    // still be woken.
+    BeginReceive();
+    ProcessSendQueue();
+    ProcessRecvRing();
+}
+
+void SharedMemoryTransportConnection::ProcessRecvRing()
+{
+    {
+        boost::mutex::scoped_lock lock(recv_lock);
+        if (recv_active)
+        {
+            recv_again = true;
+            return;
+        }
+        recv_active = true;
+    }
+
+    while (true)
+    {
+        while (connected.load())
+        {
+            uint32_t type = 0;
+            size_t len = 0;
+            RR_INTRUSIVE_PTR<Message> m;
+            try
+            {
+                const uint8_t* p = recv_ring->BeginRead(type, len);
+                if (!p)
+                {
+                    if (!recv_ring->SetReaderWaiting())
+                        break;
+                    continue;
+                }
+
+                m = ReadRecord(type, p, len);
+                if (recv_ring->EndRead())
+                {
+                    RingDoorbell('S');
+                }
+            }
+            catch (std::exception& exp)
+            {
+                ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                                   "SharedMemoryTransport failed reading message: " << exp.what());
+                Close();
+                break;
+            }
+
+            DeliverRecvMessage(m);
+        }
+
+        boost::mutex::scoped_lock lock(recv_lock);
+        if (!recv_again || !connected.load())
+        {
+            recv_active = false;
+            return;
+        }
+        recv_again = false;
+    }
+}
+
+RR_INTRUSIVE_PTR<Message> SharedMemoryTransportConnection::ReadRecord(uint32_t type, const uint8_t* p, size_t len)
+{
+    RR_INTRUSIVE_PTR<Message> m = CreateMessage();
+    if (type == detail::SharedMemoryTransport_record_message)
+    {
+        ArrayBinaryReader r(p, 0, len);
+        m->Read4(r);
+    }
+    else if (type == detail::SharedMemoryTransport_record_message_segment)
+    {
+        std::string name(reinterpret_cast<const char*>(p), len);
+        if (!SharedMemoryTransport_IsValidSegmentName(name, ".msg"))
+        {
+            throw ProtocolException("Invalid shared memory segment name");
+        }
+        boost::filesystem::path path = segment_dir / name;
+        size_t size = boost::numeric_cast<size_t>(boost::filesystem::file_size(path));
+        {
+            boost::interprocess::file_mapping f(path.string().c_str(), boost::interprocess::read_only);
+            boost::interprocess::mapped_region region(f, boost::interprocess::read_only, 0, size);
+            ArrayBinaryReader r(static_cast<const uint8_t*>(region.get_address()), 0, size);
+            m->Read4(r);
+        }
+        boost::filesystem::remove(path);
+    }
+    else
+    {
+        throw ProtocolException("Invalid shared memory record type");
+    }
+
+    BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        ResolveSharedArrays(e->elements);
+    }
+
+    return m;
+}
+
+void SharedMemoryTransportConnection::ResolveSharedArrays(std::vector<RR_INTRUSIVE_PTR<MessageElement> >& elements)
+{
+    BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageElement>& e, elements)
+    {
+        if (SharedMemoryTransport_IsNestedList(e->ElementType))
+        {
+            ResolveSharedArrays(e->CastDataToNestedList()->Elements);
+            continue;
+        }
+
+        if (!(e->ElementFlags & MessageElementFlags_EXTENDED) || e->Extended.size() <= 16 ||
+            std::memcmp(&e->Extended[0], SharedMemoryTransport_array_magic, 8) != 0)
+        {
+            continue;
+        }
+
+        if (!SharedMemoryTransport_IsNumericArray(e->ElementType))
+        {
+            throw ProtocolException("Invalid shared array type");
+        }
+
+        uint64_t count = 0;
+        std::memcpy(&count, &e->Extended[8], 8);
+        std::string name(e->Extended.begin() + 16, e->Extended.end());
+        if (count < 2 || !SharedMemoryTransport_IsValidSegmentName(name, ".arr"))
+        {
+            throw ProtocolException("Invalid shared array reference");
+        }
+
+        size_t count1 = boost::numeric_cast<size_t>(count);
+        size_t size = count1 * RRArrayElementSize(e->ElementType);
+        boost::filesystem::path path = segment_dir / name;
+        if (boost::filesystem::file_size(path) < size)
+        {
+            throw ProtocolException("Shared array segment too small");
+        }
+
+        RR_SHARED_PTR<detail::SharedMemoryTransport_array_storage> storage =
+            RR_MAKE_SHARED<detail::SharedMemoryTransport_array_storage>(path, size);
+        // The mapping stays valid after the file is removed
+        boost::filesystem::remove(path);
+
+        e->SetData(AllocateRRArrayByType(e->ElementType, count1, storage));
+        e->DataCount = boost::numeric_cast<uint32_t>(count1);
+        e->Extended.clear();
+        e->ElementFlags &= ~MessageElementFlags_EXTENDED;
+    }
+}
+
+void SharedMemoryTransportConnection::DeliverRecvMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    try
+    {
+        MessageReceived(m);
+    }
+    catch (std::exception& exp)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                           "SharedMemoryTransport failed receiving message: " << exp.what());
+        RobotRaconteurNode::TryHandleException(node, &exp);
+    }
+}
+
+void SharedMemoryTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    RR_SHARED_PTR<SharedMemoryTransport> p = parent.lock();
+    if (!p)
+        return;
+
+    RR_INTRUSIVE_PTR<Message> ret = p->SpecialRequest(m, shared_from_this());
+    if (ret != 0)
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m_LocalEndpoint, "Sending special request response");
+        try
+        {
+            if ((m->entries.at(0)->EntryType == MessageEntryType_ConnectionTest ||
+                 m->entries.at(0)->EntryType == MessageEntryType_ConnectionTestRet))
+            {
+                if (m->entries.at(0)->Error != MessageErrorType_None)
+                {
+                    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint, "SpecialRequest failed");
+                    Close();
+                    return;
+                }
+            }
+
+            if ((ret->entries.at(0)->EntryType == MessageEntryType_ConnectClientRet ||
+                 ret->entries.at(0)->EntryType == MessageEntryType_ReconnectClient ||
+                 ret->entries.at(0)->EntryType == MessageEntryType_ConnectClientCombinedRet) &&
+                ret->entries.at(0)->Error == MessageErrorType_None)
+            {
+                if (ret->header->SenderNodeID == GetNode()->NodeID())
+                {
+                    {
+                        boost::unique_lock<boost::shared_mutex> lock(RemoteNodeID_lock);
+                        if (m_LocalEndpoint != 0)
+                        {
+                            throw InvalidOperationException("Already connected");
+                        }
+
+                        m_RemoteEndpoint = ret->header->ReceiverEndpoint;
+                        m_LocalEndpoint = ret->header->SenderEndpoint;
+                    }
+
+                    p->register_transport(shared_from_this());
+                    ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(
+                        node, Transport, m_LocalEndpoint,
+                        "SharedMemoryTransport connection assigned LocalEndpoint: " << m_LocalEndpoint);
+                }
+            }
+
+            boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+                boost::bind(&SharedMemoryTransportConnection::SimpleAsyncEndSendMessage, shared_from_this(),
+                            RR_BOOST_PLACEHOLDERS(_1));
+            AsyncSendMessage(ret, h);
+        }
+        catch (std::exception& exp)
+        {
+            ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                               "SpecialRequest failed: " << exp.what());
+            Close();
+        }
+
+        return;
+    }
+
+    try
+    {
+        Transport::SetCurrentThreadTransportContext("rr+shm:///", shared_from_this());
+        p->MessageReceived(m);
+    }
+    catch (std::exception& exp)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                           "SharedMemoryTransport failed receiving message: " << exp.what());
+        RobotRaconteurNode::TryHandleException(node, &exp);
+        Close();
+    }
+
+    Transport::ClearCurrentThreadTransportContext();
+}
+
+std::string SharedMemoryTransportConnection::NextSegmentName(boost::string_ref extension)
+{
+    return connection_id + "-" + boost::lexical_cast<std::string>(segment_count.fetch_add(1)) + extension.to_string();
+}
+
+RR_INTRUSIVE_PTR<Message> SharedMemoryTransportConnection::PrepareSendMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if (shared_array_threshold == 0)
+        return m;
+
+    bool found = false;
+    BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        if (SharedMemoryTransport_HasSharedArrays(e->elements, shared_array_threshold))
+        {
+            found = true;
+            break;
+        }
+    }
+
+    if (!found)
+        return m;
+
+    // The elements of the caller's message must not be modified
+    RR_INTRUSIVE_PTR<Message> m2 = ShallowCopyMessage(m);
+    BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageEntry>& e, m2->entries)
+    {
+        PrepareSendElements(e->elements);
+    }
+    return m2;
+}
+
+void SharedMemoryTransportConnection::PrepareSendElements(std::vector<RR_INTRUSIVE_PTR<MessageElement> >& elements)
+{
+    BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageElement>& e, elements)
+    {
+        RR_INTRUSIVE_PTR<MessageElementData> dat = e->GetData();
+        if (!dat)
+            continue;
+        DataTypes type = dat->GetTypeID();
+
+        if (SharedMemoryTransport_IsNestedList(type))
+        {
+            RR_INTRUSIVE_PTR<MessageElementNestedElementList> l =
+                RR_STATIC_POINTER_CAST<MessageElementNestedElementList>(dat);
+            if (!SharedMemoryTransport_HasSharedArrays(l->Elements, shared_array_threshold))
+                continue;
+
+            std::vector<RR_INTRUSIVE_PTR<MessageElement> > elements2;
+            elements2.reserve(l->Elements.size());
+            BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageElement>& e2, l->Elements)
+            {
+                elements2.push_back(ShallowCopyMessageElement(e2));
+            }
+            PrepareSendElements(elements2);
+            e->SetData(CreateMessageElementNestedElementList(l->GetTypeID(), l->TypeName, RR_MOVE(elements2)));
+            continue;
+        }
+
+        if (!SharedMemoryTransport_IsNumericArray(type))
+            continue;
+
+        RR_INTRUSIVE_PTR<RRBaseArray> a = RR_STATIC_POINTER_CAST<RRBaseArray>(dat);
+        size_t size = a->size() * a->ElementSize();
+        if (a->size() < 2 || size < shared_array_threshold)
+            continue;
+
+        std::string name = NextSegmentName(".arr");
+        boost::filesystem::path path = segment_dir / name;
+        {
+            boost::filesystem::ofstream f(path, std::ios::binary | std::ios::trunc);
+            if (!f.is_open())
+            {
+                throw SystemResourceException("Could not create shared memory segment " + path.string());
+            }
+            f.write(static_cast<const char*>(a->void_ptr()), boost::numeric_cast<std::streamsize>(size));
+            if (!f.good())
+            {
+                throw SystemResourceException("Could not write shared memory segment " + path.string());
+            }
+        }
+
+        uint64_t count = a->size();
+        std::vector<uint8_t> extended(16 + name.size());
+        std::memcpy(&extended[0], SharedMemoryTransport_array_magic, 8);
+        std::memcpy(&extended[8], &count, 8);
+        std::memcpy(&extended[16], name.c_str(), name.size());
+
+        e->SetData(AllocateRRArrayByType(type, 0));
+        e->Extended.swap(extended);
+        e->ElementFlags |= MessageElementFlags_EXTENDED;
+    }
+}
+
+void SharedMemoryTransportConnection::SendMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    ROBOTRACONTEUR_ASSERT_MULTITHREADED(node);
+
+    RR_SHARED_PTR<detail::sync_async_handler<void> > s =
+        RR_MAKE_SHARED<detail::sync_async_handler<void> >(RR_MAKE_SHARED<ConnectionException>("Send timeout"));
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> h =
+        boost::bind(&detail::sync_async_handler<void>::operator(), s, RR_BOOST_PLACEHOLDERS(_1));
+    AsyncSendMessage(m, h);
+    s->end_void();
+}
+
+void SharedMemoryTransportConnection::AsyncSendMessage(
+    const RR_INTRUSIVE_PTR<Message>& m,
+    const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler)
+{
+    if (!connected.load())
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m_LocalEndpoint, "Connection lost");
+        throw ConnectionException("Connection lost");
+    }
+
+    detail::SharedMemoryTransport_send_entry e;
+    e.message = PrepareSendMessage(m);
+    e.handler = handler;
+
+    size_t message_size = e.message->ComputeSize4();
+    if (message_size > send_ring->MaxRecordLength())
+    {
+        // Too large for the ring buffer, pass the message in its own segment
+        e.segment_name = NextSegmentName(".msg");
+        boost::filesystem::path path = segment_dir / e.segment_name;
+        {
+            boost::filesystem::ofstream f(path, std::ios::binary | std::ios::trunc);
+            if (!f.is_open())
+            {
+                throw SystemResourceException("Could not create shared memory segment " + path.string());
+            }
+        }
+        boost::filesystem::resize_file(path, message_size);
+        boost::interprocess::file_mapping f(path.string().c_str(), boost::interprocess::read_write);
+        boost::interprocess::mapped_region region(f, boost::interprocess::read_write, 0, message_size);
+        ArrayBinaryWriter w(static_cast<uint8_t*>(region.get_address()), 0, message_size);
+        e.message->Write4(w);
+        e.message.reset();
+    }
+
+    {
+        boost::mutex::scoped_lock lock(send_lock);
+        if (send_queue.empty() && TryWriteMessage(e))
+        {
+            lock.unlock();
+            detail::PostHandler(node, handler);
+            return;
+        }
+        send_queue.push_back(RR_MOVE(e));
+    }
+}
+
+bool SharedMemoryTransportConnection::TryWriteMessage(const detail::SharedMemoryTransport_send_entry& e)
+{
+    size_t len = e.message ? e.message->ComputeSize4() : e.segment_name.size();
+
+    uint8_t* p = send_ring->BeginWrite(len);
+    if (!p)
+    {
+        send_ring->SetWriterWaiting(true);
+        // The reader may have freed space before the flag was set
+        p = send_ring->BeginWrite(len);
+        if (!p)
+            return false;
+        send_ring->SetWriterWaiting(false);
+    }
+
+    uint32_t type;
+    if (e.message)
+    {
+        ArrayBinaryWriter w(p, 0, len);
+        e.message->Write4(w);
+        type = detail::SharedMemoryTransport_record_message;
+    }
+    else
+    {
+        std::memcpy(p, e.segment_name.c_str(), len);
+        type = detail::SharedMemoryTransport_record_message_segment;
+    }
+
+    if (send_ring->EndWrite(type, len))
+    {
+        RingDoorbell('D');
+    }
+    return true;
+}
+
+void SharedMemoryTransportConnection::ProcessSendQueue()
+{
+    std::vector<boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> > handlers;
+    {
+        boost::mutex::scoped_lock lock(send_lock);
+        while (!send_queue.empty() && connected.load())
+        {
+            if (!TryWriteMessage(send_queue.front()))
+                break;
+            handlers.push_back(send_queue.front().handler);
+            send_queue.pop_front();
+        }
+    }
+
+    BOOST_FOREACH (boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& h, handlers)
+    {
+        detail::PostHandler(node, h, false, false);
+    }
+}
+
+void SharedMemoryTransportConnection::RingDoorbell(char c)
+{
+    boost::mutex::scoped_lock lock(socket_lock);
+    if (!connected.load())
+        return;
+
+    if (doorbell_active)
+    {
+        if (doorbell_pending.find(c) == std::string::npos)
+            doorbell_pending += c;
+        return;
+    }
+
+    doorbell_active = true;
+    send_doorbell_buf[0] = c;
+    boost::asio::async_write(*socket->socket, boost::asio::buffer(&send_doorbell_buf[0], 1),
+                             boost::bind(&SharedMemoryTransportConnection::EndDoorbell, shared_from_this(),
+                                         boost::asio::placeholders::error,
+                                         boost::asio::placeholders::bytes_transferred));
+}
+
+void SharedMemoryTransportConnection::EndDoorbell(const boost::system::error_code& ec, size_t bytes_transferred)
+{
+    RR_UNUSED(bytes_transferred);
+    if (ec)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, m_LocalEndpoint,
+                                           "SharedMemoryTransport socket closed: " << ec.message());
+        Close();
+        return;
+    }
+
+    boost::mutex::scoped_lock lock(socket_lock);
+    if (doorbell_pending.empty() || !connected.load())
+    {
+        doorbell_active = false;
+        return;
+    }
+
+    size_t n = doorbell_pending.size();
+    std::memcpy(&send_doorbell_buf[0], doorbell_pending.c_str(), n);
+    doorbell_pending.clear();
+    boost::asio::async_write(*socket->socket, boost::asio::buffer(&send_doorbell_buf[0], n),
+                             boost::bind(&SharedMemoryTransportConnection::EndDoorbell, shared_from_this(),
+                                         boost::asio::placeholders::error,
+                                         boost::asio::placeholders::bytes_transferred));
+}
+
+void SharedMemoryTransportConnection::SimpleAsyncEndSendMessage(const RR_SHARED_PTR<RobotRaconteurException>& err)
+{
+    if (err)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, GetLocalEndpoint(),
+                                           "Failed sending internal message: " << err->what());
+        Close();
+    }
+}
+
+void SharedMemoryTransportConnection::Close()
+{
+    bool connected1 = connected.exchange(false);
+    if (!connected1)
+        return;
+
+    ROBOTRACONTEUR_LOG_INFO_COMPONENT(node, Transport, m_LocalEndpoint, "SharedMemoryTransport closing connection");
+
+    {
+        boost::mutex::scoped_lock lock(socket_lock);
+        boost::system::error_code ec;
+        socket->socket->shutdown(boost::asio::local::stream_protocol::socket::shutdown_both, ec);
+        socket->socket->close(ec);
+    }
+
+    try
+    {
+        RR_SHARED_PTR<SharedMemoryTransport> p = parent.lock();
+        if (p)
+            p->erase_transport(shared_from_this());
+    }
+    catch (std::exception&)
+    {}
+
+    std::deque<detail::SharedMemoryTransport_send_entry> send_queue1;
+    {
+        boost::mutex::scoped_lock lock(send_lock);
+        send_queue1.swap(send_queue);
+    }
+
+    BOOST_FOREACH (detail::SharedMemoryTransport_send_entry& e, send_queue1)
+    {
+        detail::PostHandlerWithException(node, e.handler, RR_MAKE_SHARED<ConnectionException>("Connection closed"),
+                                         true, false);
+    }
+
+    RemoveSegments();
+}
+
+void SharedMemoryTransportConnection::RemoveSegments()
+{
+    // Remove segments written by this side that the peer did not receive
+    std::string prefix = connection_id + "-";
+    try
+    {
+        boost::filesystem::directory_iterator end_iter;
+        for (boost::filesystem::directory_iterator dir_itr(segment_dir); dir_itr != end_iter; dir_itr++)
+        {
+            if (boost::starts_with(dir_itr->path().filename().string(), prefix))
+            {
+                boost::system::error_code ec;
+                boost::filesystem::remove(dir_itr->path(), ec);
+            }
+        }
+    }
+    catch (std::exception&)
+    {}
+}
+
+uint32_t SharedMemoryTransportConnection::GetLocalEndpoint() { return m_LocalEndpoint; }
+
+uint32_t SharedMemoryTransportConnection::GetRemoteEndpoint() { return m_RemoteEndpoint; }
+
+NodeID SharedMemoryTransportConnection::GetRemoteNodeID()
+{
+    boost::shared_lock<boost::shared_mutex> lock(RemoteNodeID_lock);
+    return RemoteNodeID;
+}
+
+RR_SHARED_PTR<RobotRaconteurNode> SharedMemoryTransportConnection::GetNode()
+{
+    RR_SHARED_PTR<RobotRaconteurNode> n = node.lock();
+    if (!n)
+        throw InvalidOperationException("Node has been released");
+    return n;
+}
+
+void SharedMemoryTransportConnection::CheckConnection(uint32_t endpoint)
+{
+    if (endpoint != m_LocalEndpoint || !connected.load())
+    {
+        ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m_LocalEndpoint, "Connection lost");
+        throw ConnectionException("Connection lost");
+    }
+}
+
+bool SharedMemoryTransportConnection::CheckCapabilityActive(uint32_t flag)
+{
+    RR_UNUSED(flag);
+    return false;
+}
+
+bool SharedMemoryTransportConnection::IsConnected() { return connected.load(); }
+
+RR_SHARED_PTR<Transport> SharedMemoryTransportConnection::GetTransport()
+{
+    RR_SHARED_PTR<Transport> p = parent.lock();
+    if (!p)
+        throw InvalidOperationException("Transport has been released");
+    return p;
+}
+
+} // namespace RobotRaconteur
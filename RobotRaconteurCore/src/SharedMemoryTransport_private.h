@@ -0,0 +1,279 @@
+// Copyright 2011-2020 Wason Technology, LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "LocalTransport_private.h"
+#include "RobotRaconteur/SharedMemoryTransport.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <deque>
+
+namespace RobotRaconteur
+{
+
+namespace detail
+{
+class SharedMemoryTransport_socket
+{
+  public:
+    SharedMemoryTransport_socket(RR_BOOST_ASIO_IO_CONTEXT& context)
+    {
+        socket = RR_SHARED_PTR<boost::asio::local::stream_protocol::socket>(
+            new boost::asio::local::stream_protocol::socket(context));
+    }
+    RR_SHARED_PTR<boost::asio::local::stream_protocol::socket> socket;
+};
+
+class SharedMemoryTransport_acceptor
+{
+  public:
+    SharedMemoryTransport_acceptor(RR_BOOST_ASIO_IO_CONTEXT& context) : acceptor(context) {}
+    boost::asio::local::stream_protocol::acceptor acceptor;
+};
+
+class SharedMemoryTransportFDs
+{
+  public:
+    RR_SHARED_PTR<NodeDirectoriesFD> h_pid_id_s;
+    RR_SHARED_PTR<NodeDirectoriesFD> h_info_id_s;
+    RR_SHARED_PTR<NodeDirectoriesFD> h_pid_name_s;
+    RR_SHARED_PTR<NodeDirectoriesFD> h_info_name_s;
+};
+
+enum SharedMemoryTransport_record_type
+{
+    // Message4 serialized into the ring buffer
+    SharedMemoryTransport_record_message = 1,
+    // Fills the space before the end of the ring buffer, the next record is at the start
+    SharedMemoryTransport_record_wrap = 2,
+    // File name of a segment that contains a Message4 too large for the ring buffer
+    SharedMemoryTransport_record_message_segment = 3
+};
+
+// Single producer, single consumer ring buffer in a memory mapped segment. The positions are
+// byte counters that only increase. Records are 8 byte aligned and start with the record type
+// and the payload length. A record that does not fit before the end of the buffer is preceded
+// by a wrap record. The reader_waiting and writer_waiting flags are set by a side before it
+// waits for a doorbell on the socket, and cleared by the side that sends the doorbell.
+class SharedMemoryTransport_ring
+{
+  public:
+    static const size_t header_size = 192;
+    static const size_t record_header_size = 8;
+
+    SharedMemoryTransport_ring(uint8_t* base, size_t size);
+
+    // Called once by the side that created the segment
+    void Init();
+
+    size_t MaxRecordLength() const;
+
+    // Returns a pointer to the payload of a new record, or NULL if the ring is full
+    uint8_t* BeginWrite(size_t len);
+
+    // Publishes the record. Returns true if the reader must be woken
+    bool EndWrite(uint32_t type, size_t len);
+
+    void SetWriterWaiting(bool waiting);
+
+    // Returns a pointer to the payload of the next record, or NULL if the ring is empty
+    const uint8_t* BeginRead(uint32_t& type, size_t& len);
+
+    // Releases the record. Returns true if the writer must be woken
+    bool EndRead();
+
+    // Returns true if data arrived while setting the flag, in which case the flag is cleared
+    bool SetReaderWaiting();
+
+  protected:
+    boost::atomic<uint64_t>* write_pos;
+    boost::atomic<uint64_t>* read_pos;
+    boost::atomic<uint32_t>* reader_waiting;
+    boost::atomic<uint32_t>* writer_waiting;
+    uint8_t* data;
+    size_t size;
+
+    uint64_t pending_write_pos;
+    uint64_t pending_read_pos;
+};
+
+// Storage for a received array that is backed by a mapped shared segment. The segment is
+// mapped copy on write, so changes made by the receiver are not visible to the sender.
+class SharedMemoryTransport_array_storage : public RRArrayAllocator
+{
+  public:
+    SharedMemoryTransport_array_storage(const boost::filesystem::path& path, size_t size);
+
+    RR_OVIRTUAL void* Allocate(size_t size) RR_OVERRIDE;
+
+    RR_OVIRTUAL void Release(void* p, size_t size) RR_OVERRIDE;
+
+  protected:
+    boost::interprocess::mapped_region region;
+};
+
+struct SharedMemoryTransport_send_entry
+{
+    RR_INTRUSIVE_PTR<Message> message;
+    std::string segment_name;
+    boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)> handler;
+};
+
+} // namespace detail
+
+class SharedMemoryTransportConnection : public ITransportConnection,
+                                        public RR_ENABLE_SHARED_FROM_THIS<SharedMemoryTransportConnection>
+{
+  public:
+    friend class SharedMemoryTransport;
+
+    SharedMemoryTransportConnection(const RR_SHARED_PTR<SharedMemoryTransport>& parent, bool server,
+                                    uint32_t local_endpoint);
+
+    RR_OVIRTUAL ~SharedMemoryTransportConnection() RR_OVERRIDE;
+
+    void AsyncAttachClient(const RR_SHARED_PTR<detail::SharedMemoryTransport_socket>& socket,
+                           const NodeID& target_nodeid,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    void AsyncAttachServer(const RR_SHARED_PTR<detail::SharedMemoryTransport_socket>& socket,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    virtual void MessageReceived(const RR_INTRUSIVE_PTR<Message>& m);
+
+    RR_OVIRTUAL void SendMessage(const RR_INTRUSIVE_PTR<Message>& m) RR_OVERRIDE;
+
+    RR_OVIRTUAL void AsyncSendMessage(
+        const RR_INTRUSIVE_PTR<Message>& m,
+        const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler) RR_OVERRIDE;
+
+    RR_OVIRTUAL void Close() RR_OVERRIDE;
+
+    RR_OVIRTUAL uint32_t GetLocalEndpoint() RR_OVERRIDE;
+
+    RR_OVIRTUAL uint32_t GetRemoteEndpoint() RR_OVERRIDE;
+
+    RR_OVIRTUAL NodeID GetRemoteNodeID() RR_OVERRIDE;
+
+    RR_OVIRTUAL RR_SHARED_PTR<RobotRaconteurNode> GetNode() RR_OVERRIDE;
+
+    RR_OVIRTUAL void CheckConnection(uint32_t endpoint) RR_OVERRIDE;
+
+    RR_OVIRTUAL bool CheckCapabilityActive(uint32_t flag) RR_OVERRIDE;
+
+    RR_OVIRTUAL RR_SHARED_PTR<Transport> GetTransport() RR_OVERRIDE;
+
+    bool IsConnected();
+
+  protected:
+    void MapRingSegment(const boost::filesystem::path& path, bool create);
+
+    void client_handshake1(const boost::system::error_code& ec, size_t bytes_transferred,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    void client_handshake2(const boost::system::error_code& ec, size_t bytes_transferred,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    void server_handshake1(const boost::system::error_code& ec, size_t bytes_transferred,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    void server_handshake2(const boost::system::error_code& ec, size_t bytes_transferred,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    void server_handshake3(const boost::system::error_code& ec, size_t bytes_transferred,
+                           const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler);
+
+    void HandshakeFailed(const boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>& handler,
+                         const std::string& message);
+
+    void StartReceive();
+
+    void BeginReceive();
+
+    void EndReceive(const boost::system::error_code& ec, size_t bytes_transferred);
+
+    void ProcessRecvRing();
+
+    void ProcessSendQueue();
+
+    bool TryWriteMessage(const detail::SharedMemoryTransport_send_entry& e);
+
+    void RingDoorbell(char c);
+
+    void EndDoorbell(const boost::system::error_code& ec, size_t bytes_transferred);
+
+    RR_INTRUSIVE_PTR<Message> PrepareSendMessage(const RR_INTRUSIVE_PTR<Message>& m);
+
+    void PrepareSendElements(std::vector<RR_INTRUSIVE_PTR<MessageElement> >& elements);
+
+    RR_INTRUSIVE_PTR<Message> ReadRecord(uint32_t type, const uint8_t* p, size_t len);
+
+    void ResolveSharedArrays(std::vector<RR_INTRUSIVE_PTR<MessageElement> >& elements);
+
+    std::string NextSegmentName(boost::string_ref extension);
+
+    void DeliverRecvMessage(const RR_INTRUSIVE_PTR<Message>& m);
+
+    void SimpleAsyncEndSendMessage(const RR_SHARED_PTR<RobotRaconteurException>& err);
+
+    void RemoveSegments();
+
+    bool server;
+
+    RR_WEAK_PTR<SharedMemoryTransport> parent;
+    RR_WEAK_PTR<RobotRaconteurNode> node;
+
+    uint32_t m_RemoteEndpoint;
+    uint32_t m_LocalEndpoint;
+    NodeID RemoteNodeID;
+    boost::shared_mutex RemoteNodeID_lock;
+    NodeID target_nodeid;
+
+    boost::atomic<bool> connected;
+
+    RR_SHARED_PTR<detail::SharedMemoryTransport_socket> socket;
+    boost::mutex socket_lock;
+
+    boost::filesystem::path segment_dir;
+    std::string connection_id;
+    boost::atomic<uint64_t> segment_count;
+    size_t ring_size;
+    size_t shared_array_threshold;
+
+    boost::scoped_ptr<boost::interprocess::mapped_region> ring_region;
+    boost::scoped_ptr<detail::SharedMemoryTransport_ring> send_ring;
+    boost::scoped_ptr<detail::SharedMemoryTransport_ring> recv_ring;
+
+    boost::array<uint8_t, 64> handshake_buf;
+    std::string handshake_name;
+
+    boost::array<uint8_t, 16> recv_doorbell_buf;
+    boost::array<char, 2> send_doorbell_buf;
+    bool doorbell_active;
+    std::string doorbell_pending;
+
+    // Messages that did not fit in the send ring, written in order when the reader frees space
+    boost::mutex send_lock;
+    std::deque<detail::SharedMemoryTransport_send_entry> send_queue;
+
+    // Only one thread drains the receive ring at a time so messages are delivered in order
+    boost::mutex recv_lock;
+    bool recv_active;
+    bool recv_again;
+};
+
+} // namespace RobotRaconteur
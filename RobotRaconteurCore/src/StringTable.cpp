@@ -188,6 +188,12 @@ void StringTable::MessageElementReplaceStringsWithCodes(const RR_INTRUSIVE_PTR<M
                                                         boost::unordered_map<MessageStringPtr, uint32_t>& local_table,
                                                         uint32_t& next_local_code, uint32_t& table_size)
 {
+    // Encoded elements are shared between messages and are written as is
+    if (e->Encoded4)
+    {
+        return;
+    }
+
     DoReplaceString(e->ElementName, e->ElementNameCode, e->ElementFlags, MessageElementFlags_ELEMENT_NAME_STR,
                     MessageElementFlags_ELEMENT_NAME_CODE, local_table, next_local_code, table_size);
 
@@ -2564,6 +2564,21 @@ void PipeSubscriptionBase::SetIgnoreReceived(bool ignore)
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Subscription, -1, "", membername, "IgnoreReceived set to " << ignore);
 }
 
+uint32_t PipeSubscriptionBase::GetFlowControlWindow()
+{
+    boost::mutex::scoped_lock lock(this_lock);
+    return flow_control_window.data();
+}
+
+void PipeSubscriptionBase::SetFlowControlWindow(uint32_t window)
+{
+    boost::mutex::scoped_lock lock(this_lock);
+    flow_control_window.data() = window;
+
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Subscription, -1, "", membername,
+                                            "FlowControlWindow set to " << window);
+}
+
 void PipeSubscriptionBase::AsyncSendPacketAllBase(const RR_INTRUSIVE_PTR<RRValue>& packet)
 {
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Subscription, -1, "", membername,
@@ -2789,7 +2804,8 @@ void PipeSubscription_connection::ClientConnected1(const RR_SHARED_PTR<ServiceSt
                                            boost::bind(&PipeSubscription_connection::ClientConnected2,
                                                        shared_from_this(), RR_BOOST_PLACEHOLDERS(_1),
                                                        RR_BOOST_PLACEHOLDERS(_2)),
-                                           boost::numeric_cast<int32_t>(n->GetRequestTimeout()));
+                                           boost::numeric_cast<int32_t>(n->GetRequestTimeout()),
+                                           p->GetFlowControlWindow());
     }
     catch (std::exception& exp)
     {
@@ -2911,8 +2927,15 @@ bool PipeSubscription_connection::DoSendPacket()
 
     int32_t maximum_backlog = p->max_send_backlog;
 
-    return !(maximum_backlog > -1 && (boost::numeric_cast<int32_t>(backlog.size()) +
-                                      boost::numeric_cast<int32_t>(active_sends.size())) > maximum_backlog);
+    if (maximum_backlog > -1 && (boost::numeric_cast<int32_t>(backlog.size()) +
+                                 boost::numeric_cast<int32_t>(active_sends.size())) > maximum_backlog)
+    {
+        return false;
+    }
+
+    // Do not queue packets behind a full flow control window
+    RR_SHARED_PTR<PipeEndpointBase> ep = connection.lock();
+    return !ep || ep->TryWaitSendWindow(0);
 }
 
 void PipeSubscription_connection::AsyncSendPacket(const RR_INTRUSIVE_PTR<RRValue>& packet)
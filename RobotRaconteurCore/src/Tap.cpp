@@ -25,7 +25,12 @@
 #include <boost/bind/placeholders.hpp>
 #include <boost/asio.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
 #include <boost/shared_array.hpp>
+#include <boost/lockfree/queue.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <iomanip>
 
 namespace RobotRaconteur
 {
@@ -489,6 +494,358 @@ class LocalMessageTapImpl : public RR_ENABLE_SHARED_FROM_THIS<LocalMessageTapImp
         }
     }
 };
+
+// Segment files start with a fixed size header followed by Message4 encoded
+// messages. A sequence of zero marks a segment that has not been written.
+static const char file_ring_tap_magic[8] = {'R', 'R', 'T', 'A', 'P', 'S', 'E', 'G'};
+static const uint32_t file_ring_tap_version = 1;
+static const size_t file_ring_tap_header_size = 64;
+static const size_t file_ring_tap_sequence_offset = 16;
+static const size_t file_ring_tap_used_offset = 24;
+
+static boost::filesystem::path FileRingMessageTapSegmentPath(const boost::filesystem::path& directory, size_t index)
+{
+    std::stringstream ss;
+    ss << "segment-" << std::setw(4) << std::setfill('0') << index << ".rrtap";
+    return directory / ss.str();
+}
+
+class FileRingMessageTapImpl : public RR_ENABLE_SHARED_FROM_THIS<FileRingMessageTapImpl>
+{
+  public:
+    boost::filesystem::path directory;
+    size_t segment_size;
+    size_t segment_count;
+
+    // Producers only touch the queue and the atomics
+    boost::lockfree::queue<Message*, boost::lockfree::fixed_sized<true> > queue;
+    boost::atomic<bool> is_open;
+    boost::atomic<uint64_t> dropped_count;
+
+    boost::mutex writer_lock;
+    boost::condition_variable writer_cv;
+    boost::thread writer_thread;
+
+    // Owned by the writer thread while open
+    RR_SHARED_PTR<boost::interprocess::mapped_region> region;
+    size_t current_segment;
+    uint64_t current_sequence;
+    size_t current_pos;
+
+    FileRingMessageTapImpl(const std::string& directory, size_t segment_size, size_t segment_count,
+                           size_t queue_capacity)
+        : directory(directory), segment_size(segment_size), segment_count(segment_count), queue(queue_capacity),
+          is_open(false), dropped_count(0), current_segment(0), current_sequence(0), current_pos(0)
+    {}
+
+    ~FileRingMessageTapImpl() { drain_queue(); }
+
+    void Open()
+    {
+        if (is_open.load())
+        {
+            throw InvalidOperationException("Tap already open");
+        }
+
+        try
+        {
+            boost::filesystem::create_directories(directory);
+            for (size_t i = 0; i < segment_count; i++)
+            {
+                boost::filesystem::path p = FileRingMessageTapSegmentPath(directory, i);
+                {
+                    boost::filesystem::ofstream f(p, std::ios::binary | std::ios::trunc);
+                    if (!f.is_open())
+                    {
+                        throw SystemResourceException("Could not create tap segment " + p.string());
+                    }
+                }
+                boost::filesystem::resize_file(p, segment_size);
+            }
+
+            current_segment = 0;
+            current_sequence = 0;
+            map_segment(current_segment);
+        }
+        catch (RobotRaconteurException&)
+        {
+            throw;
+        }
+        catch (std::exception& e)
+        {
+            std::string e_what(e.what());
+            throw SystemResourceException("Could not create segment files for tap: " + e_what);
+        }
+
+        is_open.store(true);
+        writer_thread = boost::thread(boost::bind(&FileRingMessageTapImpl::writer_func, shared_from_this()));
+    }
+
+    void Close()
+    {
+        if (!is_open.exchange(false))
+        {
+            return;
+        }
+
+        {
+            boost::mutex::scoped_lock lock(writer_lock);
+            writer_cv.notify_all();
+        }
+        writer_thread.join();
+        drain_queue();
+    }
+
+    void RecordMessage(const RR_INTRUSIVE_PTR<Message>& message)
+    {
+        if (!is_open.load())
+        {
+            return;
+        }
+
+        RR_INTRUSIVE_PTR<Message> message2 = ShallowCopyMessage(message);
+        add_timestamp(message2);
+        push(message2);
+    }
+
+    void RecordLogRecord(const RRLogRecord& log_record)
+    {
+        if (!is_open.load())
+        {
+            return;
+        }
+
+        RR_INTRUSIVE_PTR<Message> message2 = RRLogRecordToMessage(log_record);
+        add_timestamp(message2);
+        push(message2);
+    }
+
+    static void add_timestamp(const RR_INTRUSIVE_PTR<Message>& m)
+    {
+        boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+        m->header->MetaData =
+            m->header->MetaData.str() + "timestamp: " + boost::posix_time::to_iso_extended_string(now) + "\n";
+    }
+
+    void push(RR_INTRUSIVE_PTR<Message>& m)
+    {
+        // The queue holds the reference detached from the intrusive pointer
+        Message* p = m.detach();
+        if (!queue.bounded_push(p))
+        {
+            RR_INTRUSIVE_PTR<Message> release(p, false);
+            dropped_count++;
+        }
+    }
+
+    void drain_queue()
+    {
+        Message* p = NULL;
+        while (queue.pop(p))
+        {
+            RR_INTRUSIVE_PTR<Message> release(p, false);
+        }
+    }
+
+    void map_segment(size_t index)
+    {
+        std::string p = FileRingMessageTapSegmentPath(directory, index).string();
+        boost::interprocess::file_mapping m(p.c_str(), boost::interprocess::read_write);
+        region = RR_SHARED_PTR<boost::interprocess::mapped_region>(
+            new boost::interprocess::mapped_region(m, boost::interprocess::read_write, 0, segment_size));
+
+        uint8_t* base = static_cast<uint8_t*>(region->get_address());
+        std::memset(base, 0, file_ring_tap_header_size);
+        std::memcpy(base, file_ring_tap_magic, sizeof(file_ring_tap_magic));
+        std::memcpy(base + sizeof(file_ring_tap_magic), &file_ring_tap_version, sizeof(file_ring_tap_version));
+        current_sequence++;
+        std::memcpy(base + file_ring_tap_sequence_offset, &current_sequence, sizeof(current_sequence));
+        current_pos = file_ring_tap_header_size;
+    }
+
+    void write_message(const RR_INTRUSIVE_PTR<Message>& m)
+    {
+        size_t message_size = m->ComputeSize4();
+        if (message_size > segment_size - file_ring_tap_header_size)
+        {
+            dropped_count++;
+            return;
+        }
+
+        if (current_pos + message_size > segment_size)
+        {
+            region->flush();
+            current_segment = (current_segment + 1) % segment_count;
+            map_segment(current_segment);
+        }
+
+        uint8_t* base = static_cast<uint8_t*>(region->get_address());
+        ArrayBinaryWriter w(base + current_pos, 0, message_size);
+        m->Write4(w);
+        current_pos += message_size;
+
+        uint64_t used = current_pos - file_ring_tap_header_size;
+        std::memcpy(base + file_ring_tap_used_offset, &used, sizeof(used));
+    }
+
+    void write_queued()
+    {
+        Message* p = NULL;
+        while (queue.pop(p))
+        {
+            RR_INTRUSIVE_PTR<Message> m(p, false);
+            try
+            {
+                write_message(m);
+            }
+            catch (std::exception&)
+            {
+                dropped_count++;
+            }
+        }
+    }
+
+    static void writer_func(const RR_SHARED_PTR<FileRingMessageTapImpl>& this_)
+    {
+        while (this_->is_open.load())
+        {
+            if (this_->queue.empty())
+            {
+                // Producers do not signal, poll for new messages
+                boost::mutex::scoped_lock lock(this_->writer_lock);
+                if (!this_->is_open.load())
+                {
+                    break;
+                }
+                this_->writer_cv.timed_wait(lock, boost::posix_time::milliseconds(10));
+                continue;
+            }
+            this_->write_queued();
+        }
+
+        this_->write_queued();
+
+        try
+        {
+            this_->region->flush();
+        }
+        catch (std::exception&)
+        {}
+        this_->region.reset();
+    }
+};
+
+class FileRingMessageTapReaderImpl
+{
+  public:
+    std::vector<boost::filesystem::path> segments;
+    size_t segment_index;
+    std::vector<uint8_t> segment_data;
+    size_t segment_pos;
+    bool segment_loaded;
+
+    FileRingMessageTapReaderImpl(const std::string& directory)
+        : segment_index(0), segment_pos(0), segment_loaded(false)
+    {
+        boost::filesystem::path dir(directory);
+        if (!boost::filesystem::is_directory(dir))
+        {
+            throw ResourceNotFoundException("Tap directory not found: " + directory);
+        }
+
+        std::vector<std::pair<uint64_t, boost::filesystem::path> > found;
+        for (boost::filesystem::directory_iterator e(dir); e != boost::filesystem::directory_iterator(); ++e)
+        {
+            if (e->path().extension() != ".rrtap")
+            {
+                continue;
+            }
+
+            boost::array<uint8_t, file_ring_tap_header_size> header = {};
+            boost::filesystem::ifstream f(e->path(), std::ios::binary);
+            if (!f.read(reinterpret_cast<char*>(header.data()), header.size()))
+            {
+                continue;
+            }
+            if (std::memcmp(header.data(), file_ring_tap_magic, sizeof(file_ring_tap_magic)) != 0)
+            {
+                continue;
+            }
+            uint64_t sequence = 0;
+            std::memcpy(&sequence, header.data() + file_ring_tap_sequence_offset, sizeof(sequence));
+            if (sequence == 0)
+            {
+                continue;
+            }
+            found.push_back(std::make_pair(sequence, e->path()));
+        }
+
+        std::sort(found.begin(), found.end());
+        for (size_t i = 0; i < found.size(); i++)
+        {
+            segments.push_back(found[i].second);
+        }
+    }
+
+    void Reset()
+    {
+        segment_index = 0;
+        segment_pos = 0;
+        segment_loaded = false;
+        segment_data.clear();
+    }
+
+    void load_segment()
+    {
+        boost::filesystem::ifstream f(segments.at(segment_index), std::ios::binary);
+        boost::array<uint8_t, file_ring_tap_header_size> header = {};
+        segment_data.clear();
+        segment_pos = 0;
+        segment_loaded = true;
+        if (!f.read(reinterpret_cast<char*>(header.data()), header.size()))
+        {
+            return;
+        }
+        uint64_t used = 0;
+        std::memcpy(&used, header.data() + file_ring_tap_used_offset, sizeof(used));
+        segment_data.resize(boost::numeric_cast<size_t>(used));
+        if (used > 0 && !f.read(reinterpret_cast<char*>(&segment_data[0]), segment_data.size()))
+        {
+            segment_data.clear();
+        }
+    }
+
+    RR_INTRUSIVE_PTR<Message> ReadNextMessage()
+    {
+        while (segment_index < segments.size())
+        {
+            if (!segment_loaded)
+            {
+                load_segment();
+            }
+
+            if (segment_pos + 16 <= segment_data.size())
+            {
+                uint32_t message_size = 0;
+                std::memcpy(&message_size, &segment_data[segment_pos + 4], sizeof(message_size));
+                if (message_size >= 16 && segment_pos + message_size <= segment_data.size())
+                {
+                    ArrayBinaryReader r(&segment_data[segment_pos], 0, message_size);
+                    RR_INTRUSIVE_PTR<Message> m = CreateMessage();
+                    m->Read4(r);
+                    segment_pos += message_size;
+                    return m;
+                }
+            }
+
+            segment_index++;
+            segment_loaded = false;
+        }
+
+        return RR_INTRUSIVE_PTR<Message>();
+    }
+};
+
 } // namespace detail
 
 LocalMessageTap::LocalMessageTap(const std::string& tap_name) { this->tap_name = tap_name; }
@@ -527,4 +884,53 @@ void LocalMessageTap::RecordMessage(const RR_INTRUSIVE_PTR<Message>& message)
         tap->RecordMessage(message);
     }
 }
+
+FileRingMessageTap::FileRingMessageTap(const std::string& directory, size_t segment_size, size_t segment_count,
+                                       size_t queue_capacity)
+{
+    if (segment_size < 4096)
+    {
+        throw InvalidArgumentException("Tap segment size must be at least 4096 bytes");
+    }
+    if (segment_count < 2)
+    {
+        throw InvalidArgumentException("Tap segment count must be at least 2");
+    }
+    if (queue_capacity < 1 || queue_capacity > 65534)
+    {
+        throw InvalidArgumentException("Tap queue capacity must be between 1 and 65534");
+    }
+
+    tap_impl = RR_MAKE_SHARED<detail::FileRingMessageTapImpl>(directory, segment_size, segment_count, queue_capacity);
+}
+
+FileRingMessageTap::~FileRingMessageTap()
+{
+    try
+    {
+        tap_impl->Close();
+    }
+    catch (std::exception&)
+    {}
+}
+
+void FileRingMessageTap::Open() { tap_impl->Open(); }
+
+void FileRingMessageTap::Close() { tap_impl->Close(); }
+
+void FileRingMessageTap::RecordLogRecord(const RRLogRecord& log_record) { tap_impl->RecordLogRecord(log_record); }
+
+void FileRingMessageTap::RecordMessage(const RR_INTRUSIVE_PTR<Message>& message) { tap_impl->RecordMessage(message); }
+
+uint64_t FileRingMessageTap::GetDroppedCount() { return tap_impl->dropped_count.load(); }
+
+FileRingMessageTapReader::FileRingMessageTapReader(const std::string& directory)
+{
+    reader_impl = RR_MAKE_SHARED<detail::FileRingMessageTapReaderImpl>(directory);
+}
+
+RR_INTRUSIVE_PTR<Message> FileRingMessageTapReader::ReadNextMessage() { return reader_impl->ReadNextMessage(); }
+
+void FileRingMessageTapReader::Reset() { reader_impl->Reset(); }
+
 } // namespace RobotRaconteur
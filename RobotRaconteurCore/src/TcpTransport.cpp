@@ -390,7 +390,7 @@ void TcpConnector::connect3(const RR_SHARED_PTR<std::list<boost::asio::ip::tcp::
         candidate_endpoints->pop_front();
 
         RR_SHARED_PTR<boost::asio::ip::tcp::socket> sock(
-            new boost::asio::ip::tcp::socket(parent->GetNode()->GetThreadPool()->get_io_context()));
+            new boost::asio::ip::tcp::socket(parent->GetNode()->GetThreadPool()->get_next_io_context()));
 
         {
             if (!connecting)
@@ -1815,6 +1815,9 @@ TcpTransport::TcpTransport(const RR_SHARED_PTR<RobotRaconteurNode>& node) : Tran
     disable_string_table = true;
 #endif
     disable_async_message_io = false;
+    max_send_batch_size = 64 * 1024;
+    max_send_batch_count = 1;
+    max_fragmented_message_size = 1024 * 1024 * 1024;
     closed = false;
 
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "TcpTransport created");
@@ -2445,7 +2448,7 @@ void TcpTransport::StartServer(const std::vector<boost::asio::ip::tcp::endpoint>
             a->listen();
 
             RR_SHARED_PTR<boost::asio::ip::tcp::socket> socket(
-                new boost::asio::ip::tcp::socket(GetNode()->GetThreadPool()->get_io_context()));
+                new boost::asio::ip::tcp::socket(GetNode()->GetThreadPool()->get_next_io_context()));
 
             RR_SHARED_PTR<detail::TcpSocketAcceptor> a2 = RR_MAKE_SHARED<detail::TcpSocketAcceptor>(a);
             a2->accept_filter = accept_filter;
@@ -2782,7 +2785,7 @@ void TcpTransport::handle_accept(const RR_SHARED_PTR<TcpTransport>& parent,
     }
 
     RR_SHARED_PTR<boost::asio::ip::tcp::socket> socket2(
-        new boost::asio::ip::tcp::socket(parent->GetNode()->GetThreadPool()->get_io_context()));
+        new boost::asio::ip::tcp::socket(parent->GetNode()->GetThreadPool()->get_next_io_context()));
 
     acceptor->acceptor->async_accept(*socket2, boost::bind(&TcpTransport::handle_accept, parent, acceptor, socket2,
                                                            boost::asio::placeholders::error));
@@ -3196,7 +3199,7 @@ void TcpTransport::erase_transport(const RR_SHARED_PTR<ITransportConnection>& co
                 if (a->paused)
                 {
                     RR_SHARED_PTR<boost::asio::ip::tcp::socket> socket2(
-                        new boost::asio::ip::tcp::socket(GetNode()->GetThreadPool()->get_io_context()));
+                        new boost::asio::ip::tcp::socket(GetNode()->GetThreadPool()->get_next_io_context()));
                     a->paused = false;
                     a->acceptor->async_accept(*socket2, boost::bind(&TcpTransport::handle_accept, shared_from_this(), a,
                                                                     socket2, boost::asio::placeholders::error));
@@ -3573,6 +3576,73 @@ void TcpTransport::SetDisableAsyncMessageIO(bool d)
     ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "DisableAsyncMessageIO set to: " << d);
 }
 
+int32_t TcpTransport::GetMaxSendBatchSize()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return max_send_batch_size;
+}
+
+void TcpTransport::SetMaxSendBatchSize(int32_t size)
+{
+    if (size < 0)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, -1, "Invalid MaxSendBatchSize: " << size);
+        throw InvalidArgumentException("Invalid maximum send batch size");
+    }
+    boost::mutex::scoped_lock lock(parameter_lock);
+    max_send_batch_size = size;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "MaxSendBatchSize set to " << size << " bytes");
+}
+
+int32_t TcpTransport::GetMaxSendBatchCount()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return max_send_batch_count;
+}
+
+void TcpTransport::SetMaxSendBatchCount(int32_t count)
+{
+    if (count < 1)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, -1, "Invalid MaxSendBatchCount: " << count);
+        throw InvalidArgumentException("Invalid maximum send batch count");
+    }
+    boost::mutex::scoped_lock lock(parameter_lock);
+    max_send_batch_count = count;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "MaxSendBatchCount set to " << count);
+}
+
+int32_t TcpTransport::GetMaxFragmentedMessageSize()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return max_fragmented_message_size;
+}
+
+void TcpTransport::SetMaxFragmentedMessageSize(int32_t size)
+{
+    if (size < 0)
+    {
+        ROBOTRACONTEUR_LOG_DEBUG_COMPONENT(node, Transport, -1, "Invalid MaxFragmentedMessageSize: " << size);
+        throw InvalidArgumentException("Invalid maximum fragmented message size");
+    }
+    boost::mutex::scoped_lock lock(parameter_lock);
+    max_fragmented_message_size = size;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "MaxFragmentedMessageSize set to " << size << " bytes");
+}
+
+RR_SHARED_PTR<RRArrayAllocator> TcpTransport::GetReceiveArrayAllocator()
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    return receive_array_allocator;
+}
+
+void TcpTransport::SetReceiveArrayAllocator(const RR_SHARED_PTR<RRArrayAllocator>& allocator)
+{
+    boost::mutex::scoped_lock lock(parameter_lock);
+    receive_array_allocator = allocator;
+    ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, -1, "ReceiveArrayAllocator set");
+}
+
 void TcpTransport::LocalNodeServicesChanged()
 {
     boost::mutex::scoped_lock lock(node_discovery_lock);
@@ -3595,6 +3665,14 @@ TcpTransportConnection::TcpTransportConnection(const RR_SHARED_PTR<TcpTransport>
     this->disable_message4 = parent->GetDisableMessage4();
     this->disable_string_table = parent->GetDisableStringTable();
     this->disable_async_io = parent->GetDisableAsyncMessageIO();
+    this->max_send_batch_size = boost::numeric_cast<size_t>(parent->GetMaxSendBatchSize());
+    this->max_send_batch_count = boost::numeric_cast<size_t>(parent->GetMaxSendBatchCount());
+    this->max_fragmented_message_size = boost::numeric_cast<size_t>(parent->GetMaxFragmentedMessageSize());
+    RR_SHARED_PTR<RRArrayAllocator> receive_array_allocator = parent->GetReceiveArrayAllocator();
+    if (receive_array_allocator)
+    {
+        async_reader->SetArrayAllocator(receive_array_allocator);
+    }
     this->url = RR_MOVE(url.to_string());
 
     this->is_tls = false;
@@ -4960,11 +5038,8 @@ void TcpTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
             connecturl = scheme + "://[" + addr2.to_string() + "]:" + boost::lexical_cast<std::string>(port) + "/";
         }
 
-        // NOLINTBEGIN(cppcoreguidelines-owning-memory)
-        Transport::m_CurrentThreadTransportConnectionURL.reset(new std::string(RR_MOVE(connecturl)));
-        Transport::m_CurrentThreadTransport.reset(new RR_SHARED_PTR<ITransportConnection>(
-            RR_STATIC_POINTER_CAST<TcpTransportConnection>(shared_from_this())));
-        // NOLINTEND(cppcoreguidelines-owning-memory)
+        Transport::SetCurrentThreadTransportContext(connecturl,
+                                                    RR_STATIC_POINTER_CAST<TcpTransportConnection>(shared_from_this()));
         ROBOTRACONTEUR_LOG_TRACE_COMPONENT(node, Transport, m_LocalEndpoint,
                                            "TcpTransport received message from "
                                                << TcpTransport_socket_local_endpoint(socket) << " passing to node");
@@ -4979,8 +5054,7 @@ void TcpTransportConnection::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
         Close();
     }
 
-    Transport::m_CurrentThreadTransportConnectionURL.reset(0);
-    Transport::m_CurrentThreadTransport.reset(0);
+    Transport::ClearCurrentThreadTransportContext();
 }
 
 void TcpTransportConnection::StreamOpMessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
@@ -24,6 +24,12 @@
 #endif
 
 #include <boost/foreach.hpp>
+#include <boost/thread/tss.hpp>
+
+#if defined(ROBOTRACONTEUR_LINUX) || defined(ROBOTRACONTEUR_ANDROID)
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 namespace RobotRaconteur
 {
@@ -168,6 +174,8 @@ void ThreadPool::Shutdown()
 
 RR_BOOST_ASIO_IO_CONTEXT& ThreadPool::get_io_context() { return _io_context; }
 
+RR_BOOST_ASIO_IO_CONTEXT& ThreadPool::get_next_io_context() { return get_io_context(); }
+
 ThreadPoolFactory::~ThreadPoolFactory() {}
 
 IOContextThreadPool::IOContextThreadPool(const RR_SHARED_PTR<RobotRaconteurNode>& node,
@@ -199,6 +207,357 @@ void IOContextThreadPool::Shutdown() {}
 
 RR_BOOST_ASIO_IO_CONTEXT& IOContextThreadPool::get_io_context() { return _external_io_context; }
 
+// Sharded thread pool
+
+namespace detail
+{
+class ShardedThreadPool_shard : private boost::noncopyable
+{
+  public:
+    size_t index;
+    ShardedThreadPool* owner;
+    RR_BOOST_ASIO_IO_CONTEXT io_context;
+#if BOOST_ASIO_VERSION < 101200
+    RR_SHARED_PTR<RR_BOOST_ASIO_IO_CONTEXT::work> work;
+#else
+    RR_SHARED_PTR<boost::asio::executor_work_guard<RR_BOOST_ASIO_IO_CONTEXT::executor_type> > work;
+#endif
+    boost::mutex tasks_lock;
+    std::deque<boost::function<void()> > tasks;
+    std::vector<RR_SHARED_PTR<boost::thread> > threads;
+    boost::atomic<size_t> thread_count;
+    // Threads of this shard currently running a posted task
+    boost::atomic<size_t> busy_count;
+
+    ShardedThreadPool_shard(size_t index, ShardedThreadPool* owner)
+        : index(index), owner(owner), thread_count(0), busy_count(0)
+    {
+#if BOOST_ASIO_VERSION < 101200
+        work = RR_MAKE_SHARED<RR_BOOST_ASIO_IO_CONTEXT::work>(boost::ref(io_context));
+#else
+        work = RR_SHARED_PTR<boost::asio::executor_work_guard<RR_BOOST_ASIO_IO_CONTEXT::executor_type> >(
+            new boost::asio::executor_work_guard<RR_BOOST_ASIO_IO_CONTEXT::executor_type>(io_context.get_executor()));
+#endif
+    }
+};
+
+// Shard of the current thread. Not owned, the shard outlives its threads.
+static void ShardedThreadPool_current_shard_cleanup(ShardedThreadPool_shard* shard) { RR_UNUSED(shard); }
+static boost::thread_specific_ptr<ShardedThreadPool_shard> ShardedThreadPool_current_shard(
+    &ShardedThreadPool_current_shard_cleanup);
+
+// Posted tasks may block, for instance a callback waiting on a synchronous send. Keep one thread
+// of a shard free for the socket handlers bound to its io_context.
+static bool ShardedThreadPool_shard_saturated(const ShardedThreadPool_shard& shard)
+{
+    size_t thread_count = shard.thread_count.load();
+    size_t reserve = thread_count > 1 ? 1 : 0;
+    return shard.busy_count.load() + reserve >= thread_count;
+}
+
+static RR_SHARED_PTR<ShardedThreadPool_shard> ShardedThreadPool_least_busy_shard(
+    const std::vector<RR_SHARED_PTR<ShardedThreadPool_shard> >& shards, const ShardedThreadPool_shard* exclude)
+{
+    RR_SHARED_PTR<ShardedThreadPool_shard> ret;
+    size_t ret_free = 0;
+    BOOST_FOREACH (const RR_SHARED_PTR<ShardedThreadPool_shard>& e, shards)
+    {
+        if (e.get() == exclude)
+            continue;
+        size_t thread_count = e->thread_count.load();
+        size_t busy_count = e->busy_count.load();
+        size_t e_free = thread_count > busy_count ? thread_count - busy_count : 0;
+        if (!ret || e_free > ret_free)
+        {
+            ret = e;
+            ret_free = e_free;
+        }
+    }
+    return ret;
+}
+
+class ShardedThreadPool_busy_guard : private boost::noncopyable
+{
+    ShardedThreadPool_shard* shard;
+
+  public:
+    ShardedThreadPool_busy_guard(ShardedThreadPool_shard* shard) : shard(shard) { ++shard->busy_count; }
+    ~ShardedThreadPool_busy_guard() { --shard->busy_count; }
+};
+
+static void ShardedThreadPool_set_cpu_affinity(size_t cpu)
+{
+#if defined(ROBOTRACONTEUR_LINUX) || defined(ROBOTRACONTEUR_ANDROID)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#elif defined(ROBOTRACONTEUR_WINDOWS)
+    SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu);
+#else
+    RR_UNUSED(cpu);
+#endif
+}
+} // namespace detail
+
+ShardedThreadPool::ShardedThreadPool(const RR_SHARED_PTR<RobotRaconteurNode>& node, size_t shard_count,
+                                     bool cpu_affinity)
+    : ThreadPool(node), next_shard(0), cpu_affinity(cpu_affinity), started_thread_count(0)
+{
+    if (shard_count == 0)
+    {
+        throw InvalidArgumentException("Thread pool shard count must be greater than zero");
+    }
+
+    for (size_t i = 0; i < shard_count; i++)
+    {
+        shards.push_back(RR_MAKE_SHARED<detail::ShardedThreadPool_shard>(i, this));
+    }
+}
+
+ShardedThreadPool::~ShardedThreadPool() {}
+
+size_t ShardedThreadPool::GetShardCount() { return shards.size(); }
+
+bool ShardedThreadPool::GetCPUAffinity() { return cpu_affinity; }
+
+size_t ShardedThreadPool::GetThreadPoolCount() { return thread_count; }
+
+void ShardedThreadPool::SetThreadPoolCount(size_t count)
+{
+    boost::mutex::scoped_lock lock(queue_mutex);
+
+    size_t count2 = std::max(count, shards.size());
+    for (size_t i = started_thread_count; i < count2; i++)
+    {
+        RR_SHARED_PTR<detail::ShardedThreadPool_shard> shard = shards[i % shards.size()];
+        RR_SHARED_PTR<boost::thread> t = RR_MAKE_SHARED<boost::thread>(
+            boost::bind(&ShardedThreadPool::shard_thread_function,
+                        RR_STATIC_POINTER_CAST<ShardedThreadPool>(shared_from_this()), shard));
+        shard->threads.push_back(t);
+        ++shard->thread_count;
+        threads.push_back(t);
+    }
+    started_thread_count = std::max(started_thread_count, count2);
+    thread_count = count2;
+}
+
+RR_SHARED_PTR<detail::ShardedThreadPool_shard> ShardedThreadPool::get_current_shard()
+{
+    detail::ShardedThreadPool_shard* shard = detail::ShardedThreadPool_current_shard.get();
+    if (shard && shard->owner == this)
+    {
+        return shards[shard->index];
+    }
+    return RR_SHARED_PTR<detail::ShardedThreadPool_shard>();
+}
+
+RR_SHARED_PTR<detail::ShardedThreadPool_shard> ShardedThreadPool::get_next_shard()
+{
+    return shards[next_shard.fetch_add(1, boost::memory_order_relaxed) % shards.size()];
+}
+
+void ShardedThreadPool::post_to_shard(const RR_SHARED_PTR<detail::ShardedThreadPool_shard>& shard,
+                                      boost::function<void()> function)
+{
+    size_t backlog = 0;
+    {
+        boost::mutex::scoped_lock lock(shard->tasks_lock);
+        shard->tasks.push_back(RR_MOVE(function));
+        backlog = shard->tasks.size();
+    }
+
+    RR_WEAK_PTR<RobotRaconteurNode> node1 = node;
+    RR_BOOST_ASIO_POST(shard->io_context, boost::bind(&ShardedThreadPool::run_shard_task, shard, node1));
+
+    // The shard already has queued tasks or no free thread, let the least busy shard steal this one
+    if (shards.size() > 1 && (backlog > 1 || detail::ShardedThreadPool_shard_saturated(*shard)))
+    {
+        RR_SHARED_PTR<detail::ShardedThreadPool_shard> thief =
+            detail::ShardedThreadPool_least_busy_shard(shards, shard.get());
+        RR_BOOST_ASIO_POST(thief->io_context, boost::bind(&ShardedThreadPool::run_shard_task, shard, node1));
+    }
+}
+
+void ShardedThreadPool::run_shard_task(const RR_SHARED_PTR<detail::ShardedThreadPool_shard>& shard,
+                                       const RR_WEAK_PTR<RobotRaconteurNode>& node)
+{
+    detail::ShardedThreadPool_shard* current = detail::ShardedThreadPool_current_shard.get();
+    if (!current || current->owner != shard->owner)
+    {
+        current = shard.get();
+    }
+
+    boost::function<void()> f;
+    {
+        boost::mutex::scoped_lock lock(shard->tasks_lock);
+        if (shard->tasks.empty())
+        {
+            // Already run by the owning shard or stolen by another shard
+            return;
+        }
+
+        // Running the task here would take the last free thread of this shard. Hand it to a shard
+        // with free threads instead, or run it anyway if every shard is saturated.
+        if (shard->owner->shards.size() > 1 && detail::ShardedThreadPool_shard_saturated(*current))
+        {
+            RR_SHARED_PTR<detail::ShardedThreadPool_shard> thief =
+                detail::ShardedThreadPool_least_busy_shard(shard->owner->shards, current);
+            if (!detail::ShardedThreadPool_shard_saturated(*thief))
+            {
+                lock.unlock();
+                RR_BOOST_ASIO_POST(thief->io_context, boost::bind(&ShardedThreadPool::run_shard_task, shard, node));
+                return;
+            }
+        }
+
+        RR_SWAP(f, shard->tasks.front());
+        shard->tasks.pop_front();
+    }
+
+    detail::ShardedThreadPool_busy_guard busy(current);
+    ThreadPool_post_wrapper(RR_MOVE(f), node);
+}
+
+void ShardedThreadPool::Post(boost::function<void()> function)
+{
+    if (!keepgoing)
+        throw InvalidOperationException("Thread pool shutdown");
+
+    RR_SHARED_PTR<detail::ShardedThreadPool_shard> shard = get_current_shard();
+    if (!shard)
+    {
+        shard = get_next_shard();
+    }
+    post_to_shard(shard, RR_MOVE(function));
+}
+
+bool ShardedThreadPool::TryPost(boost::function<void()> function)
+{
+    if (!keepgoing)
+        return false;
+
+    RR_SHARED_PTR<detail::ShardedThreadPool_shard> shard = get_current_shard();
+    if (!shard)
+    {
+        shard = get_next_shard();
+    }
+    post_to_shard(shard, RR_MOVE(function));
+    return true;
+}
+
+void ShardedThreadPool::shard_thread_function(const RR_SHARED_PTR<detail::ShardedThreadPool_shard>& shard)
+{
+    detail::ShardedThreadPool_current_shard.reset(shard.get());
+
+    if (cpu_affinity)
+    {
+        unsigned int cpu_count = boost::thread::hardware_concurrency();
+        if (cpu_count > 0)
+        {
+            detail::ShardedThreadPool_set_cpu_affinity(shard->index % cpu_count);
+        }
+    }
+
+    bool k = false;
+
+    {
+        boost::mutex::scoped_lock lock(keepgoing_lock);
+        k = keepgoing;
+    }
+
+    while (k || !shard->io_context.stopped())
+    {
+        try
+        {
+            shard->io_context.run_one();
+        }
+        catch (std::exception& exp)
+        {
+            RobotRaconteurNode::TryHandleException(node, &exp);
+        }
+
+        {
+            boost::mutex::scoped_lock lock(keepgoing_lock);
+            k = keepgoing;
+        }
+    }
+
+    detail::ShardedThreadPool_current_shard.reset();
+}
+
+void ShardedThreadPool::Shutdown()
+{
+    std::vector<RR_SHARED_PTR<boost::thread> > threads;
+    {
+        boost::mutex::scoped_lock lock(queue_mutex);
+        {
+            boost::mutex::scoped_lock lock(keepgoing_lock);
+            keepgoing = false;
+        }
+        threads = this->threads;
+        BOOST_FOREACH (RR_SHARED_PTR<detail::ShardedThreadPool_shard>& e, shards)
+        {
+            e->work.reset();
+        }
+    }
+
+    BOOST_FOREACH (RR_SHARED_PTR<detail::ShardedThreadPool_shard>& e, shards)
+    {
+        e->io_context.stop();
+    }
+
+    {
+        BOOST_FOREACH (RR_SHARED_PTR<boost::thread>& e, threads)
+        {
+#ifdef ROBOTRACONTEUR_IOS
+            e->try_join_for(boost::chrono::seconds(1));
+#else
+            e->join();
+#endif
+        }
+
+        boost::mutex::scoped_lock lock(queue_mutex);
+        this->threads.clear();
+        BOOST_FOREACH (RR_SHARED_PTR<detail::ShardedThreadPool_shard>& e, shards)
+        {
+            e->threads.clear();
+            boost::mutex::scoped_lock lock2(e->tasks_lock);
+            e->tasks.clear();
+        }
+    }
+
+    _io_context.stop();
+}
+
+RR_BOOST_ASIO_IO_CONTEXT& ShardedThreadPool::get_io_context()
+{
+    RR_SHARED_PTR<detail::ShardedThreadPool_shard> shard = get_current_shard();
+    if (!shard)
+    {
+        shard = get_next_shard();
+    }
+    return shard->io_context;
+}
+
+RR_BOOST_ASIO_IO_CONTEXT& ShardedThreadPool::get_next_io_context() { return get_next_shard()->io_context; }
+
+ShardedThreadPoolFactory::ShardedThreadPoolFactory(size_t shard_count, bool cpu_affinity)
+    : shard_count(shard_count), cpu_affinity(cpu_affinity)
+{
+    if (shard_count == 0)
+    {
+        throw InvalidArgumentException("Thread pool shard count must be greater than zero");
+    }
+}
+
+RR_SHARED_PTR<ThreadPool> ShardedThreadPoolFactory::NewThreadPool(const RR_SHARED_PTR<RobotRaconteurNode>& node)
+{
+    return RR_MAKE_SHARED<ShardedThreadPool>(node, shard_count, cpu_affinity);
+}
+
+ShardedThreadPoolFactory::~ShardedThreadPoolFactory() {}
+
 namespace detail
 {
 bool ThreadPool_IsNodeMultithreaded(RR_WEAK_PTR<RobotRaconteurNode> node)
@@ -46,7 +46,7 @@ boost::thread_specific_ptr<std::string> Transport::m_CurrentThreadTransportConne
 
 std::string Transport::GetCurrentTransportConnectionURL()
 {
-    if (!m_CurrentThreadTransportConnectionURL.get())
+    if (!m_CurrentThreadTransportConnectionURL.get() || m_CurrentThreadTransportConnectionURL->empty())
         throw InvalidOperationException("Not set");
     return std::string(*m_CurrentThreadTransportConnectionURL);
 }
@@ -56,11 +56,52 @@ boost::thread_specific_ptr<RR_SHARED_PTR<ITransportConnection> > Transport::m_Cu
 RR_SHARED_PTR<ITransportConnection> Transport::GetCurrentThreadTransport()
 {
 
-    if (!m_CurrentThreadTransport.get())
+    if (!m_CurrentThreadTransport.get() || !*m_CurrentThreadTransport)
         throw InvalidOperationException("Not set");
     return *m_CurrentThreadTransport;
 }
 
+void Transport::SetCurrentThreadTransportContext(boost::string_ref url,
+                                                 const RR_SHARED_PTR<ITransportConnection>& connection)
+{
+    std::string* url1 = m_CurrentThreadTransportConnectionURL.get();
+    if (!url1)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        m_CurrentThreadTransportConnectionURL.reset(new std::string(url.begin(), url.end()));
+    }
+    else
+    {
+        url1->assign(url.begin(), url.end());
+    }
+
+    RR_SHARED_PTR<ITransportConnection>* connection1 = m_CurrentThreadTransport.get();
+    if (!connection1)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+        m_CurrentThreadTransport.reset(new RR_SHARED_PTR<ITransportConnection>(connection));
+    }
+    else
+    {
+        *connection1 = connection;
+    }
+}
+
+void Transport::ClearCurrentThreadTransportContext()
+{
+    std::string* url1 = m_CurrentThreadTransportConnectionURL.get();
+    if (url1)
+    {
+        url1->clear();
+    }
+
+    RR_SHARED_PTR<ITransportConnection>* connection1 = m_CurrentThreadTransport.get();
+    if (connection1)
+    {
+        connection1->reset();
+    }
+}
+
 void Transport::PeriodicCleanupTask() {}
 
 uint32_t Transport::TransportCapability(boost::string_ref name)
@@ -301,6 +301,12 @@ RR_INTRUSIVE_PTR<RRValue> WireConnectionBase::GetOutValueBase()
 }
 
 void WireConnectionBase::SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value)
+{
+    SetOutValueBase(value, RR_INTRUSIVE_PTR<MessageElement>());
+}
+
+void WireConnectionBase::SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value,
+                                         const RR_INTRUSIVE_PTR<MessageElement>& packet)
 {
     if (direction == MemberDefinition_Direction_readonly)
     {
@@ -327,7 +333,14 @@ void WireConnectionBase::SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value)
                                                 "Wire sending out value packet timespec " << time.seconds << ","
                                                                                           << time.nanoseconds);
 
-        GetParent()->SendWirePacket(value, time, endpoint);
+        if (!packet)
+        {
+            GetParent()->SendWirePacket(value, time, endpoint);
+        }
+        else
+        {
+            GetParent()->SendWirePacketElement(packet, time, endpoint);
+        }
 
         boost::mutex::scoped_lock lock2(outval_lock);
         outval = value;
@@ -559,6 +572,25 @@ void WireBase::DispatchPacket(const RR_INTRUSIVE_PTR<MessageEntry>& me, const RR
 }
 
 RR_INTRUSIVE_PTR<MessageEntry> WireBase::PackPacket(const RR_INTRUSIVE_PTR<RRValue>& data, TimeSpec time)
+{
+    return PackPacketEntry(PackPacketElement(data), time);
+}
+
+RR_INTRUSIVE_PTR<MessageElement> WireBase::PackPacketElement(const RR_INTRUSIVE_PTR<RRValue>& data)
+{
+    if (!rawelements)
+    {
+        RR_INTRUSIVE_PTR<MessageElementData> pdata = PackData(data);
+        return CreateMessageElement("packet", pdata);
+    }
+
+    RR_INTRUSIVE_PTR<MessageElement> pme = RR_DYNAMIC_POINTER_CAST<MessageElement>(data);
+    pme->ElementName = "packet";
+    return pme;
+}
+
+RR_INTRUSIVE_PTR<MessageEntry> WireBase::PackPacketEntry(const RR_INTRUSIVE_PTR<MessageElement>& packet,
+                                                         TimeSpec time)
 {
     std::vector<RR_INTRUSIVE_PTR<MessageElement> > timespec1;
     timespec1.push_back(CreateMessageElement("seconds", ScalarToRRArray(time.seconds)));
@@ -568,17 +600,7 @@ RR_INTRUSIVE_PTR<MessageEntry> WireBase::PackPacket(const RR_INTRUSIVE_PTR<RRVal
 
     std::vector<RR_INTRUSIVE_PTR<MessageElement> > elems;
     elems.push_back(CreateMessageElement("packettime", s));
-    if (!rawelements)
-    {
-        RR_INTRUSIVE_PTR<MessageElementData> pdata = PackData(data);
-        elems.push_back(CreateMessageElement("packet", pdata));
-    }
-    else
-    {
-        RR_INTRUSIVE_PTR<MessageElement> pme = RR_DYNAMIC_POINTER_CAST<MessageElement>(data);
-        pme->ElementName = "packet";
-        elems.push_back(pme);
-    }
+    elems.push_back(packet);
 
     RR_INTRUSIVE_PTR<MessageEntry> m = CreateMessageEntry(MessageEntryType_WirePacket, GetMemberName());
     m->elements = RR_MOVE(elems);
@@ -690,6 +712,15 @@ void WireClientBase::SendWirePacket(const RR_INTRUSIVE_PTR<RRValue>& packet, Tim
     GetStub()->SendWireMessage(m);
 }
 
+void WireClientBase::SendWirePacketElement(const RR_INTRUSIVE_PTR<MessageElement>& packet, TimeSpec time,
+                                           uint32_t endpoint)
+{
+    RR_UNUSED(endpoint);
+    RR_INTRUSIVE_PTR<MessageEntry> m = PackPacketEntry(packet, time);
+
+    GetStub()->SendWireMessage(m);
+}
+
 void WireClientBase::AsyncClose(const RR_SHARED_PTR<WireConnectionBase>& endpoint, bool remote, uint32_t ee,
                                 RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>)
                                     handler,
@@ -1064,6 +1095,19 @@ void WireServerBase::SendWirePacket(const RR_INTRUSIVE_PTR<RRValue>& packet, Tim
     GetSkel()->SendWireMessage(m, e);
 }
 
+void WireServerBase::SendWirePacketElement(const RR_INTRUSIVE_PTR<MessageElement>& packet, TimeSpec time,
+                                           uint32_t e)
+{
+    {
+        boost::mutex::scoped_lock lock(connections_lock);
+        if (connections.find(e) == connections.end())
+            throw InvalidOperationException("Wire has been disconnected");
+    }
+    RR_INTRUSIVE_PTR<MessageEntry> m = PackPacketEntry(packet, time);
+
+    GetSkel()->SendWireMessage(m, e);
+}
+
 void WireServerBase::AsyncClose(const RR_SHARED_PTR<WireConnectionBase>& endpoint, bool remote, uint32_t ee,
                                 RR_MOVE_ARG(boost::function<void(const RR_SHARED_PTR<RobotRaconteurException>&)>)
                                     handler,
@@ -1372,6 +1416,11 @@ void WireBroadcasterBase::SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value
 
     RR_SHARED_PTR<WireBroadcasterBase> this_ = shared_from_this();
 
+    // The value is packed once on the first send and shared by all connections.
+    // Each connection receives a shallow copy so the per-message string table
+    // and size bookkeeping does not touch the shared element tree.
+    RR_INTRUSIVE_PTR<MessageElement> packet;
+
     for (std::list<RR_SHARED_PTR<detail::WireBroadcaster_connected_connection> >::iterator ee = connected_wires.begin();
          ee != connected_wires.end();)
     {
@@ -1401,14 +1450,31 @@ void WireBroadcasterBase::SetOutValueBase(const RR_INTRUSIVE_PTR<RRValue>& value
 
                 ROBOTRACONTEUR_LOG_TRACE_COMPONENT_PATH(node, Member, ep_endpoint, service_path, member_name,
                                                         "WireBroadcaster sending out value");
+                if (!packet)
+                {
+                    RR_SHARED_PTR<WireServerBase> w = wire.lock();
+                    if (!w)
+                    {
+                        throw InvalidOperationException("Wire has been released");
+                    }
+                    if (!copy_element)
+                    {
+                        packet = w->PackPacketElement(value);
+                    }
+                    else
+                    {
+                        packet = w->PackPacketElement(ShallowCopyMessageElement(rr_cast<MessageElement>(value)));
+                    }
+                }
+
                 if (!copy_element)
                 {
-                    c->SetOutValueBase(value);
+                    c->SetOutValueBase(value, ShallowCopyMessageElement(packet));
                 }
                 else
                 {
                     RR_INTRUSIVE_PTR<MessageElement> value2 = ShallowCopyMessageElement(rr_cast<MessageElement>(value));
-                    c->SetOutValueBase(value2);
+                    c->SetOutValueBase(value2, ShallowCopyMessageElement(packet));
                 }
                 ee++;
             }
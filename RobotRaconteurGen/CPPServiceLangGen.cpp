@@ -2633,6 +2633,59 @@ static std::string CPPServiceLangGen_direction_str(MemberDefinition_Direction di
     }
 }
 
+// Skeleton dispatch functions switch on detail::MemberNameHash() of the member name instead of
+// comparing the name against each member. Each case still confirms the name. Short chains and
+// objects with colliding hashes keep the plain comparison chain.
+template <typename T>
+static bool CPPServiceLangGen_UseMemberNameHashDispatch(const RR_SHARED_PTR<ServiceEntryDefinition>& e)
+{
+    std::set<uint32_t> hashes;
+    size_t count = 0;
+    BOOST_FOREACH (const RR_SHARED_PTR<MemberDefinition>& m, e->Members)
+    {
+        if (!dynamic_cast<T*>(m.get()))
+            continue;
+        count++;
+        if (!hashes.insert(RobotRaconteur::detail::MemberNameHash(boost::string_ref(m->Name))).second)
+            return false;
+    }
+    return count >= 4;
+}
+
+static void CPPServiceLangGen_MemberNameHashDispatchBegin(std::ostream& w2, bool use_hash,
+                                                          const std::string& name_expr)
+{
+    if (use_hash)
+    {
+        w2 << "switch (RobotRaconteur::detail::MemberNameHash(" << name_expr << "))" << std::endl
+           << "{" << std::endl;
+    }
+}
+
+static void CPPServiceLangGen_MemberNameHashDispatchCase(std::ostream& w2, bool use_hash, const std::string& name)
+{
+    if (use_hash)
+    {
+        w2 << "case " << RobotRaconteur::detail::MemberNameHash(boost::string_ref(name)) << "U:" << std::endl;
+    }
+}
+
+static void CPPServiceLangGen_MemberNameHashDispatchCaseEnd(std::ostream& w2, bool use_hash)
+{
+    if (use_hash)
+    {
+        w2 << "break;" << std::endl;
+    }
+}
+
+static void CPPServiceLangGen_MemberNameHashDispatchEnd(std::ostream& w2, bool use_hash)
+{
+    if (use_hash)
+    {
+        w2 << "default:" << std::endl << "break;" << std::endl << "}" << std::endl;
+    }
+}
+
 void CPPServiceLangGen::GenerateStubDefinition(ServiceDefinition* d,
                                                const std::vector<RR_SHARED_PTR<ServiceDefinition> >& other_defs,
                                                std::ostream* w)
@@ -3469,6 +3522,8 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
     for (std::vector<RR_SHARED_PTR<ServiceEntryDefinition> >::const_iterator e = d->Objects.begin();
          e != d->Objects.end(); ++e)
     {
+        bool hash_dispatch = false;
+
         w2 << "void " << fix_name((*e)->Name)
            << "_skel::Init(boost::string_ref path, const RR_SHARED_PTR<RobotRaconteur::RRObject>& object, "
               "const RR_SHARED_PTR<RobotRaconteur::ServerContext>& context)"
@@ -3529,7 +3584,10 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << std::endl;
         w2 << "RR_SHARED_PTR<" << boost::replace_all_copy(fix_name(d->Name), ".", "::") << "::"
            << "async_" << fix_name((*e)->Name) << " > async_obj=get_asyncobj();" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<PropertyDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(PropertyDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName == \"" << m->Name << "\")" << std::endl << "{" << std::endl;
         if (m->Direction() != MemberDefinition_Direction_writeonly)
         {
@@ -3559,7 +3617,9 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
             w2 << "throw RobotRaconteur::WriteOnlyMemberException(\"Write only property\");" << std::endl;
         }
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END()
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -3571,7 +3631,10 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << std::endl;
         w2 << "RR_SHARED_PTR<" << boost::replace_all_copy(fix_name(d->Name), ".", "::") << "::"
            << "async_" << fix_name((*e)->Name) << " > async_obj=get_asyncobj();" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<PropertyDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(PropertyDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName == \"" << m->Name << "\")" << std::endl << "{" << std::endl;
         if (m->Direction() != MemberDefinition_Direction_readonly)
         {
@@ -3599,7 +3662,9 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
             w2 << "throw RobotRaconteur::ReadOnlyMemberException(\"Read only property\");" << std::endl;
         }
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END()
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -3652,7 +3717,10 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << std::endl;
         w2 << "RR_SHARED_PTR<" << boost::replace_all_copy(fix_name(d->Name), ".", "::") << "::"
            << "async_" << fix_name((*e)->Name) << " > async_obj=get_asyncobj();" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<FunctionDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "rr_m->MemberName");
         MEMBER_ITER(FunctionDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (rr_m->MemberName == \"" << m->Name << "\")" << std::endl << "{" << std::endl;
         if (!m->IsGenerator())
         {
@@ -3741,7 +3809,9 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
             w2 << "}" << std::endl;
         }
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END()
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -3963,12 +4033,17 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << "_skel::DispatchPipeMessage(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)"
            << std::endl
            << "{" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<PipeDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(PipeDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName==\"" << m->Name << "\")" << std::endl << "{" << std::endl;
         w2 << "rr_" << m->Name << "_pipe->PipePacketReceived(m,e);" << std::endl;
         w2 << "return;" << std::endl;
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END();
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -3976,11 +4051,16 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << "_skel::CallPipeFunction(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)"
            << std::endl
            << "{" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<PipeDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(PipeDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName==\"" << m->Name << "\")" << std::endl << "{" << std::endl;
         w2 << "return rr_" << m->Name << "_pipe->PipeCommand(m,e);" << std::endl;
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END();
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -4032,12 +4112,17 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << "_skel::DispatchWireMessage(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)"
            << std::endl
            << "{" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<WireDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(WireDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName==\"" << m->Name << "\")" << std::endl << "{" << std::endl;
         w2 << "rr_" << m->Name << "_wire->WirePacketReceived(m,e);" << std::endl;
         w2 << "return;" << std::endl;
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END();
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -4045,11 +4130,16 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << "_skel::CallWireFunction(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)"
            << std::endl
            << "{" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<WireDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(WireDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName==\"" << m->Name << "\")" << std::endl << "{" << std::endl;
         w2 << "return rr_" << m->Name << "_wire->WireCommand(m,e);" << std::endl;
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END();
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -4099,7 +4189,10 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
         w2 << "RR_SHARED_PTR<void> " << fix_name((*e)->Name)
            << "_skel::GetCallbackFunction(uint32_t endpoint, boost::string_ref membername)" << std::endl
            << "{" << std::endl;
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<CallbackDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "membername");
         MEMBER_ITER(CallbackDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (membername==\"" << m->Name << "\")" << std::endl << "{" << std::endl;
         std::vector<std::string> p;
         p.push_back("&" + fix_name((*e)->Name) + "_skel::rr_" + m->Name + "_callback");
@@ -4112,7 +4205,9 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
         w2 << "return RR_MAKE_SHARED<" << GetCallbackDeclaration(m.get(), true, true) << " >(boost::bind("
            << boost::join(p, ", ") << "));" << std::endl;
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END()
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl << std::endl;
 
@@ -4122,7 +4217,10 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
            << std::endl
            << "{" << std::endl;
 
+        hash_dispatch = CPPServiceLangGen_UseMemberNameHashDispatch<MemoryDefinition>(*e);
+        CPPServiceLangGen_MemberNameHashDispatchBegin(w2, hash_dispatch, "m->MemberName");
         MEMBER_ITER(MemoryDefinition)
+        CPPServiceLangGen_MemberNameHashDispatchCase(w2, hash_dispatch, m->Name);
         w2 << "if (m->MemberName==\"" << m->Name << "\")" << std::endl << "{" << std::endl;
         w2 << "if (rr_" << m->Name << "_mem==0) ";
 
@@ -4176,7 +4274,9 @@ void CPPServiceLangGen::GenerateSkelDefinition(ServiceDefinition* d,
         w2 << "return rr_" << m->Name << "_mem->CallMemoryFunction(m,e,get_obj()->get_" << fix_name(m->Name) << "());"
            << std::endl;
         w2 << "}" << std::endl;
+        CPPServiceLangGen_MemberNameHashDispatchCaseEnd(w2, hash_dispatch);
         MEMBER_ITER_END()
+        CPPServiceLangGen_MemberNameHashDispatchEnd(w2, hash_dispatch);
         w2 << "throw RobotRaconteur::MemberNotFoundException(\"Member not found\");" << std::endl;
         w2 << "}" << std::endl;
 
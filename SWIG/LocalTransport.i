@@ -47,6 +47,14 @@ public:
 	virtual bool GetDisableAsyncMessageIO();
 	virtual void SetDisableAsyncMessageIO(bool d);
 
+	RR_PROPERTY(MaxSendBatchSize)
+	virtual int32_t GetMaxSendBatchSize();
+	virtual void SetMaxSendBatchSize(int32_t size);
+
+	RR_PROPERTY(MaxSendBatchCount)
+	virtual int32_t GetMaxSendBatchCount();
+	virtual void SetMaxSendBatchCount(int32_t count);
+
 	virtual void EnableNodeDiscoveryListening();
 	virtual void DisableNodeDiscoveryListening();
 
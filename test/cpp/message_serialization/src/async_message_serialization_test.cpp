@@ -139,6 +139,79 @@ TEST(AsyncMessageReaderTest, Test1)
     }
 }
 
+class AsyncMessageReaderTestAllocator : public RRArrayAllocator
+{
+  public:
+    size_t allocate_count;
+    std::vector<uint8_t> storage;
+
+    AsyncMessageReaderTestAllocator() : allocate_count(0) {}
+
+    RR_OVIRTUAL void* Allocate(size_t size) RR_OVERRIDE
+    {
+        allocate_count++;
+        storage.resize(size);
+        return &storage[0];
+    }
+
+    RR_OVIRTUAL void Release(void* p, size_t size) RR_OVERRIDE
+    {
+        RR_UNUSED(p);
+        RR_UNUSED(size);
+    }
+};
+
+TEST(AsyncMessageReaderTest, ArrayAllocatorTest)
+{
+    RR_INTRUSIVE_PTR<RRArray<double> > a = AllocateRRArray<double>(100000);
+    for (size_t i = 0; i < a->size(); i++)
+    {
+        (*a)[i] = static_cast<double>(i);
+    }
+
+    RR_INTRUSIVE_PTR<MessageEntry> me = CreateMessageEntry(MessageEntryType_WirePacket, "frame");
+    me->AddElement("packet", a);
+    RR_INTRUSIVE_PTR<Message> m = CreateMessage();
+    m->header = CreateMessageHeader();
+    m->entries.push_back(me);
+
+    size_t message_size = m->ComputeSize4();
+    boost::shared_array<uint8_t> buf(new uint8_t[message_size]);
+    ArrayBinaryWriter w(buf.get(), 0, message_size);
+    m->Write4(w);
+
+    RR_SHARED_PTR<AsyncMessageReaderTestAllocator> allocator = RR_MAKE_SHARED<AsyncMessageReaderTestAllocator>();
+    RR_SHARED_PTR<AsyncMessageReader> r = AsyncMessageReader::CreateInstance();
+    r->SetArrayAllocator(allocator);
+    r->Reset();
+
+    // Pass only the message header and the start of the array, the rest
+    // of the array must be requested as continue buffers pointing into
+    // the allocator storage
+    size_t first_len = message_size - a->size() * sizeof(double) + 64;
+    const_buffers buf2;
+    buf2.push_back(boost::asio::buffer(buf.get(), first_len));
+    size_t buf_used = 0;
+    mutable_buffers continue_bufs;
+    ASSERT_EQ(r->Read4(buf2, buf_used, 0, continue_bufs), AsyncMessageReader::ReadReturn_continue_buffers);
+    ASSERT_EQ(buf_used, first_len);
+    ASSERT_EQ(allocator->allocate_count, 1);
+    ASSERT_EQ(boost::asio::buffer_size(continue_bufs), message_size - first_len);
+    EXPECT_EQ(static_cast<uint8_t*>(continue_bufs.front().data()), &allocator->storage[64]);
+
+    size_t n =
+        boost::asio::buffer_copy(continue_bufs, boost::asio::buffer(buf.get() + first_len, message_size - first_len));
+    const_buffers empty;
+    mutable_buffers continue_bufs2;
+    EXPECT_EQ(r->Read4(empty, buf_used, n, continue_bufs2), AsyncMessageReader::ReadReturn_done);
+
+    ASSERT_TRUE(r->MessageReady());
+    RR_INTRUSIVE_PTR<Message> m2 = r->GetNextMessage();
+    RR_INTRUSIVE_PTR<RRArray<double> > a2 = m2->entries.at(0)->elements.at(0)->CastData<RRArray<double> >();
+    EXPECT_EQ(a2->void_ptr(), static_cast<void*>(&allocator->storage[0]));
+    CompareMessage(m, m2);
+}
+
 TEST(AsyncMessageReaderTest, RandomTest)
 {
     size_t iterations = 100;
@@ -322,6 +395,26 @@ TEST(AsyncMessageWriterTest, RandomTest4)
     }
 }
 
+TEST(AsyncMessageWriterTest, EncodedElementsTest4)
+{
+    size_t iterations = 100;
+    LFSRSeqGen rng((uint32_t)std::time(0), "async_message_writer_test_encoded_elements_test4");
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        RR_INTRUSIVE_PTR<Message> m = ShallowCopyMessage(NewRandomTestMessage4(rng));
+        BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+        {
+            BOOST_FOREACH (RR_INTRUSIVE_PTR<MessageElement>& el, e->elements)
+            {
+                el->Encode4();
+            }
+        }
+
+        DoTestW(m, 4, rng);
+    }
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 #include <RobotRaconteur.h>
 #include <RobotRaconteur/NodeDirectories.h>
+#include <RobotRaconteur/Tap.h>
+#include <boost/filesystem.hpp>
 
 using namespace RobotRaconteur;
 
@@ -157,6 +159,110 @@ TEST(RobotRaconteurMisc, CreateIdentifierAttributeFilterTest)
     EXPECT_FALSE(attr5.IsMatch("identifier_1.with.do_ts|cbfea7a4-0361-41ad-95bb-d4dcd967047a"));
 }
 
+class RRArrayTestAllocator : public RRArrayAllocator
+{
+  public:
+    std::vector<void*> released;
+
+    RR_OVIRTUAL void* Allocate(size_t size) RR_OVERRIDE { return ::operator new(size); }
+
+    RR_OVIRTUAL void Release(void* p, size_t size) RR_OVERRIDE
+    {
+        RR_UNUSED(size);
+        released.push_back(p);
+        ::operator delete(p);
+    }
+};
+
+TEST(RobotRaconteurMisc, RRArrayAllocatorTest)
+{
+    RR_SHARED_PTR<RRArrayTestAllocator> allocator = RR_MAKE_SHARED<RRArrayTestAllocator>();
+    void* p = NULL;
+    {
+        RR_INTRUSIVE_PTR<RRArray<double> > a = AllocateRRArray<double>(10, allocator);
+        ASSERT_EQ(a->size(), 10);
+        p = a->void_ptr();
+    }
+    ASSERT_EQ(allocator->released.size(), 1);
+    EXPECT_EQ(allocator->released[0], p);
+
+    RR_SHARED_PTR<RRArrayBufferPool> pool = RR_MAKE_SHARED<RRArrayBufferPool>();
+    void* p1 = NULL;
+    {
+        RR_INTRUSIVE_PTR<RRBaseArray> a = AllocateRRArrayByType(DataTypes_uint8_t, 1000, pool);
+        p1 = a->void_ptr();
+    }
+    EXPECT_EQ(pool->GetCachedBufferCount(), 1);
+    {
+        RR_INTRUSIVE_PTR<RRArray<float> > a = AllocateRRArray<float>(200, pool);
+        EXPECT_EQ(a->void_ptr(), p1);
+        EXPECT_EQ(pool->GetCachedBufferCount(), 0);
+    }
+    pool->Clear();
+    EXPECT_EQ(pool->GetCachedBufferCount(), 0);
+}
+
+TEST(RobotRaconteurMisc, RRArrayScalarInlineTest)
+{
+    RR_INTRUSIVE_PTR<RRArray<double> > a = ScalarToRRArray(1.5);
+    ASSERT_EQ(a->size(), 1);
+    EXPECT_EQ(RRArrayToScalar(a), 1.5);
+    uint8_t* p = static_cast<uint8_t*>(a->void_ptr());
+    uint8_t* o = reinterpret_cast<uint8_t*>(a.get());
+    EXPECT_TRUE(p >= o && p + sizeof(double) <= o + sizeof(RRArray<double>));
+
+    RR_INTRUSIVE_PTR<RRBaseArray> b =
+        AllocateRRArrayByType(DataTypes_cdouble_t, 1, RR_MAKE_SHARED<RRArrayBufferPool>());
+    p = static_cast<uint8_t*>(b->void_ptr());
+    o = reinterpret_cast<uint8_t*>(b.get());
+    EXPECT_TRUE(p >= o && p + sizeof(cdouble) <= o + sizeof(RRArray<cdouble>));
+}
+
+TEST(RobotRaconteurMisc, FileRingMessageTapTest)
+{
+    boost::filesystem::path dir = boost::filesystem::temp_directory_path() /
+                                  boost::filesystem::unique_path("robotraconteur_tap_test_%%%%-%%%%-%%%%");
+
+    {
+        RR_SHARED_PTR<FileRingMessageTap> tap = RR_MAKE_SHARED<FileRingMessageTap>(dir.string(), 4096, 3, 1024);
+        tap->Open();
+        for (uint16_t i = 0; i < 200; i++)
+        {
+            RR_INTRUSIVE_PTR<Message> m = CreateMessage();
+            m->header = CreateMessageHeader();
+            m->header->MessageID = i;
+            RR_INTRUSIVE_PTR<MessageEntry> me = CreateMessageEntry(MessageEntryType_PropertyGetRes, "d1");
+            me->AddElement("value", ScalarToRRArray<double>(i));
+            m->entries.push_back(me);
+            tap->RecordMessage(m);
+        }
+        tap->Close();
+        EXPECT_EQ(tap->GetDroppedCount(), 0);
+    }
+
+    // The ring only holds the most recent messages, in order, ending at the last message
+    FileRingMessageTapReader reader(dir.string());
+    RR_INTRUSIVE_PTR<Message> m;
+    size_t count = 0;
+    int32_t last_id = -1;
+    while ((m = reader.ReadNextMessage()))
+    {
+        int32_t id = m->header->MessageID;
+        if (last_id >= 0)
+        {
+            EXPECT_EQ(id, last_id + 1);
+        }
+        EXPECT_EQ(RRArrayToScalar(m->entries.at(0)->FindElement("value")->CastData<RRArray<double> >()), id);
+        last_id = id;
+        count++;
+    }
+    EXPECT_GT(count, 0);
+    EXPECT_LT(count, 200);
+    EXPECT_EQ(last_id, 199);
+
+    boost::filesystem::remove_all(dir);
+}
+
 int main(int argc, char* argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,95 @@
+#include <RobotRaconteur.h>
+
+#include "robotraconteur_generated.h"
+#include "ServiceTest.h"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteurTest;
+using namespace std;
+using namespace com::robotraconteur::testing::TestService1;
+using namespace com::robotraconteur::testing::TestService2;
+
+// Property get/set on testroot, which has more than 60 properties. d1 is the first property declared
+// and var_num is near the end, so the difference between the two shows the cost of finding the member
+// in the skeleton.
+
+static double period_us(const boost::posix_time::ptime& t1, const boost::posix_time::ptime& t2, uint32_t iters)
+{
+    return static_cast<double>((t2 - t1).total_microseconds()) / static_cast<double>(iters);
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t iters = 100000;
+    if (argc >= 2)
+    {
+        iters = boost::lexical_cast<uint32_t>(argv[1]);
+    }
+
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+    RobotRaconteurNode::s()->SetNodeName("memberdispatchbenchmark");
+
+    RR_SHARED_PTR<IntraTransport> c = RR_MAKE_SHARED<IntraTransport>();
+    c->StartServer();
+    RobotRaconteurNode::s()->RegisterTransport(c);
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    c2->StartServer(0);
+    RobotRaconteurNode::s()->RegisterTransport(c2);
+
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    RR_SHARED_PTR<RRObject> obj = RobotRaconteurNode::s()->ConnectService(
+        "rr+intra:///?nodename=memberdispatchbenchmark&service=RobotRaconteurTestService");
+    RR_SHARED_PTR<testroot> o = rr_cast<testroot>(obj);
+
+    int32_t var_numb[] = {-1046369769, 1950632347, 1140727074, -1277424443, 163999900,
+                          970815027,   545593183,  514305170,  1896372264,  1385916382};
+    RR_INTRUSIVE_PTR<RRArray<int32_t> > var_num = AttachRRArrayCopy(var_numb, 10);
+
+    boost::posix_time::ptime t1;
+    boost::posix_time::ptime t2;
+
+    t1 = RobotRaconteurNode::s()->NowNodeTime();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        o->get_d1();
+    }
+    t2 = RobotRaconteurNode::s()->NowNodeTime();
+    cout << "get_d1 period=" << period_us(t1, t2, iters) << " us" << endl;
+
+    t1 = RobotRaconteurNode::s()->NowNodeTime();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        o->set_d1(3.456);
+    }
+    t2 = RobotRaconteurNode::s()->NowNodeTime();
+    cout << "set_d1 period=" << period_us(t1, t2, iters) << " us" << endl;
+
+    t1 = RobotRaconteurNode::s()->NowNodeTime();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        o->get_var_num();
+    }
+    t2 = RobotRaconteurNode::s()->NowNodeTime();
+    cout << "get_var_num period=" << period_us(t1, t2, iters) << " us" << endl;
+
+    t1 = RobotRaconteurNode::s()->NowNodeTime();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        o->set_var_num(var_num);
+    }
+    t2 = RobotRaconteurNode::s()->NowNodeTime();
+    cout << "set_var_num period=" << period_us(t1, t2, iters) << " us" << endl;
+
+    RobotRaconteurNode::s()->DisconnectService(obj);
+    RobotRaconteurNode::s()->Shutdown();
+
+    return 0;
+}
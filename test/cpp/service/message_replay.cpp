@@ -0,0 +1,405 @@
+#include "message_replay.h"
+
+#include <RobotRaconteur/IOUtils.h>
+#include <RobotRaconteur/Transport.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/algorithm/string.hpp>
+
+namespace RobotRaconteur
+{
+namespace test
+{
+
+MessageReplayStatistics::MessageReplayStatistics()
+    : sent_count(0), response_count(0), error_count(0), elapsed_seconds(0), throughput(0), latency_mean_us(0),
+      latency_p50_us(0), latency_p99_us(0), latency_max_us(0)
+{}
+
+std::vector<RR_INTRUSIVE_PTR<Message> > ReadMessageReplayRecording(const std::string& path)
+{
+    std::vector<RR_INTRUSIVE_PTR<Message> > messages;
+
+    if (boost::filesystem::is_directory(path))
+    {
+        FileRingMessageTapReader reader(path);
+        RR_INTRUSIVE_PTR<Message> m;
+        while ((m = reader.ReadNextMessage()))
+        {
+            messages.push_back(m);
+        }
+        return messages;
+    }
+
+    boost::filesystem::ifstream f(path, std::ios::binary);
+    if (!f.is_open())
+    {
+        throw ResourceNotFoundException("Could not open recording " + path);
+    }
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    size_t pos = 0;
+    while (pos + 16 <= data.size())
+    {
+        uint32_t message_size = 0;
+        std::memcpy(&message_size, &data[pos + 4], sizeof(message_size));
+        if (message_size < 16 || pos + message_size > data.size())
+        {
+            break;
+        }
+        ArrayBinaryReader r(&data[pos], 0, message_size);
+        RR_INTRUSIVE_PTR<Message> m = CreateMessage();
+        m->Read4(r);
+        messages.push_back(m);
+        pos += message_size;
+    }
+
+    return messages;
+}
+
+static bool MessageReplayIsConnect(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        if (e->EntryType == MessageEntryType_ConnectClient || e->EntryType == MessageEntryType_ConnectClientCombined)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool MessageReplayIsServiceMessage(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if (m->entries.empty())
+    {
+        return false;
+    }
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        if (e->EntryType < MessageEntryType_GetServiceDesc)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<RR_INTRUSIVE_PTR<Message> > SelectMessageReplayClientMessages(
+    const std::vector<RR_INTRUSIVE_PTR<Message> >& messages)
+{
+    std::vector<RR_INTRUSIVE_PTR<Message> > selected;
+
+    size_t i = 0;
+    while (i < messages.size() && !MessageReplayIsConnect(messages[i]))
+    {
+        i++;
+    }
+    if (i == messages.size())
+    {
+        return selected;
+    }
+
+    NodeID client_nodeid = messages[i]->header->SenderNodeID;
+    uint32_t client_endpoint = messages[i]->header->SenderEndpoint;
+
+    for (; i < messages.size(); i++)
+    {
+        const RR_INTRUSIVE_PTR<Message>& m = messages[i];
+        if (m->header->SenderNodeID != client_nodeid || m->header->SenderEndpoint != client_endpoint)
+        {
+            continue;
+        }
+        if (!MessageReplayIsServiceMessage(m))
+        {
+            continue;
+        }
+        // Message IDs increase with each message sent by the endpoint. Intra connections are
+        // recorded on both send and receive, so drop messages that are not newer than the last one.
+        if (!selected.empty())
+        {
+            uint16_t d = static_cast<uint16_t>(m->header->MessageID - selected.back()->header->MessageID);
+            if (d == 0 || d > std::numeric_limits<uint16_t>::max() / 2)
+            {
+                continue;
+            }
+        }
+        selected.push_back(m);
+    }
+
+    return selected;
+}
+
+// Returns the time added to the message MetaData by the tap, and removes it from the MetaData
+static bool MessageReplayTakeTimestamp(const RR_INTRUSIVE_PTR<Message>& m, boost::posix_time::ptime& timestamp)
+{
+    std::string md = m->header->MetaData.str().to_string();
+    size_t p1 = md.rfind("timestamp: ");
+    if (p1 == std::string::npos)
+    {
+        return false;
+    }
+    size_t p2 = md.find('\n', p1);
+    std::string ts = md.substr(p1 + 11, (p2 == std::string::npos) ? std::string::npos : p2 - p1 - 11);
+    m->header->MetaData = md.substr(0, p1);
+    try
+    {
+        timestamp = boost::posix_time::from_iso_extended_string(boost::trim_copy(ts));
+    }
+    catch (std::exception&)
+    {
+        return false;
+    }
+    return true;
+}
+
+// Recordings are stored in message format 4, which omits empty sections. Restore the format 2 flags
+// so the message can be sent over transports that have not negotiated format 4.
+static void MessageReplayRestoreVersion2Flags(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if ((m->header->MessageFlags & ~MessageFlags_Version2Compat) == 0)
+    {
+        m->header->MessageFlags = MessageFlags_Version2Compat;
+    }
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        if ((e->EntryFlags & ~MessageEntryFlags_Version2Compat) == 0)
+        {
+            e->EntryFlags = MessageEntryFlags_Version2Compat;
+        }
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageElement>& el, e->elements)
+        {
+            if ((el->ElementFlags & ~MessageElementFlags_Version2Compat) == 0)
+            {
+                el->ElementFlags = MessageElementFlags_Version2Compat;
+            }
+        }
+    }
+}
+
+MessageReplayEndpoint::MessageReplayEndpoint(const RR_SHARED_PTR<RobotRaconteurNode>& node)
+    : Endpoint(node), connect_complete(false), error_count(0)
+{}
+
+void MessageReplayEndpoint::connect_handler(const RR_SHARED_PTR<ITransportConnection>& connection,
+                                            const RR_SHARED_PTR<RobotRaconteurException>& err)
+{
+    boost::mutex::scoped_lock lock(this_lock);
+    connect_connection = connection;
+    connect_error = err;
+    connect_complete = true;
+    this_cv.notify_all();
+}
+
+void MessageReplayEndpoint::Connect(const RR_SHARED_PTR<Transport>& transport, const std::string& url,
+                                    int32_t timeout)
+{
+    RR_SHARED_PTR<RobotRaconteurNode> n = GetNode();
+    n->RegisterEndpoint(shared_from_this());
+
+    boost::function<void(const RR_SHARED_PTR<ITransportConnection>&, const RR_SHARED_PTR<RobotRaconteurException>&)>
+        h = boost::bind(&MessageReplayEndpoint::connect_handler, shared_from_this(), RR_BOOST_PLACEHOLDERS(_1),
+                        RR_BOOST_PLACEHOLDERS(_2));
+    transport->AsyncCreateTransportConnection(url, shared_from_this(), h);
+
+    boost::mutex::scoped_lock lock(this_lock);
+    while (!connect_complete)
+    {
+        if (!this_cv.timed_wait(lock, boost::posix_time::milliseconds(timeout)))
+        {
+            throw ConnectionException("Timeout connecting replay endpoint");
+        }
+    }
+    if (connect_error)
+    {
+        throw *connect_error;
+    }
+
+    ParseConnectionURLResult url_res = ParseConnectionURL(url);
+    if (!(url_res.nodeid.IsAnyNode() && !url_res.nodename.empty()))
+    {
+        SetRemoteNodeID(url_res.nodeid);
+    }
+    else
+    {
+        SetRemoteNodeName(url_res.nodename);
+    }
+
+    SetTransport(transport->TransportID);
+    SetTransportConnection(connect_connection);
+    SetRemoteEndpoint(0);
+}
+
+MessageReplayStatistics MessageReplayEndpoint::Replay(const std::vector<RR_INTRUSIVE_PTR<Message> >& messages,
+                                                      MessageReplayTiming timing, double time_scale,
+                                                      int32_t timeout)
+{
+    if (timing == MessageReplayTiming_scaled && !(time_scale > 0.0))
+    {
+        throw InvalidArgumentException("Replay time scale must be greater than zero");
+    }
+    if (timing == MessageReplayTiming_original)
+    {
+        time_scale = 1.0;
+    }
+
+    MessageReplayStatistics stats;
+
+    {
+        boost::mutex::scoped_lock lock(this_lock);
+        outstanding_requests.clear();
+        latencies.clear();
+        error_count = 0;
+    }
+
+    boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+    boost::posix_time::ptime first_timestamp;
+
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<Message>& m, messages)
+    {
+        RR_INTRUSIVE_PTR<Message> m2 = ShallowCopyMessage(m);
+        MessageReplayRestoreVersion2Flags(m2);
+
+        boost::posix_time::ptime timestamp;
+        if (MessageReplayTakeTimestamp(m2, timestamp) && timing != MessageReplayTiming_as_fast_as_possible)
+        {
+            if (first_timestamp.is_not_a_date_time())
+            {
+                first_timestamp = timestamp;
+            }
+            int64_t offset_us = static_cast<int64_t>(
+                static_cast<double>((timestamp - first_timestamp).total_microseconds()) / time_scale);
+            boost::this_thread::sleep_until(boost::chrono::steady_clock::now() +
+                                            boost::chrono::microseconds(offset_us) -
+                                            boost::chrono::microseconds(
+                                                (boost::posix_time::microsec_clock::universal_time() - start)
+                                                    .total_microseconds()));
+        }
+
+        boost::mutex::scoped_lock lock(this_lock);
+
+        // Requests after the connect request need the server endpoint assigned in its response
+        if (stats.sent_count > 0)
+        {
+            while (GetRemoteEndpoint() == 0)
+            {
+                if (!this_cv.timed_wait(lock, boost::posix_time::milliseconds(timeout)))
+                {
+                    throw RequestTimeoutException("Timeout waiting for replay connect response");
+                }
+            }
+        }
+
+        boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m2->entries)
+        {
+            if (e->RequestID != 0)
+            {
+                outstanding_requests[e->RequestID] = now;
+            }
+        }
+        lock.unlock();
+
+        try
+        {
+            SendMessage(m2);
+            stats.sent_count++;
+        }
+        catch (std::exception&)
+        {
+            boost::mutex::scoped_lock lock2(this_lock);
+            error_count++;
+            BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m2->entries)
+            {
+                outstanding_requests.erase(e->RequestID);
+            }
+        }
+    }
+
+    boost::mutex::scoped_lock lock(this_lock);
+    boost::posix_time::ptime wait_end =
+        boost::posix_time::microsec_clock::universal_time() + boost::posix_time::milliseconds(timeout);
+    while (!outstanding_requests.empty())
+    {
+        if (!this_cv.timed_wait(lock, wait_end))
+        {
+            break;
+        }
+    }
+
+    boost::posix_time::ptime end = boost::posix_time::microsec_clock::universal_time();
+
+    stats.elapsed_seconds = static_cast<double>((end - start).total_microseconds()) * 1e-6;
+    stats.response_count = latencies.size();
+    stats.error_count = error_count + outstanding_requests.size();
+    if (stats.elapsed_seconds > 0)
+    {
+        stats.throughput = static_cast<double>(stats.response_count) / stats.elapsed_seconds;
+    }
+    if (!latencies.empty())
+    {
+        std::vector<double> sorted = latencies;
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0;
+        BOOST_FOREACH (double l, sorted)
+        {
+            sum += l;
+        }
+        stats.latency_mean_us = sum / static_cast<double>(sorted.size());
+        stats.latency_p50_us = sorted[sorted.size() / 2];
+        stats.latency_p99_us = sorted[std::min(sorted.size() - 1, (sorted.size() * 99) / 100)];
+        stats.latency_max_us = sorted.back();
+    }
+
+    return stats;
+}
+
+void MessageReplayEndpoint::Close()
+{
+    RR_SHARED_PTR<RobotRaconteurNode> n = GetNode();
+    n->DeleteEndpoint(shared_from_this());
+}
+
+void MessageReplayEndpoint::MessageReceived(const RR_INTRUSIVE_PTR<Message>& m)
+{
+    if (m->entries.size() == 1 && m->entries.at(0)->EntryType == MessageEntryType_EndpointCheckCapability)
+    {
+        CheckEndpointCapabilityMessage(m);
+        return;
+    }
+
+    boost::posix_time::ptime now = boost::posix_time::microsec_clock::universal_time();
+
+    boost::mutex::scoped_lock lock(this_lock);
+    if (GetRemoteEndpoint() == 0)
+    {
+        SetRemoteEndpoint(m->header->SenderEndpoint);
+        SetRemoteNodeID(m->header->SenderNodeID);
+    }
+
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+    {
+        // Responses have the request entry type plus one
+        if (e->EntryType % 2 != 0)
+        {
+            continue;
+        }
+        std::map<uint32_t, boost::posix_time::ptime>::iterator r = outstanding_requests.find(e->RequestID);
+        if (r == outstanding_requests.end())
+        {
+            continue;
+        }
+        latencies.push_back(static_cast<double>((now - r->second).total_microseconds()));
+        if (e->Error != MessageErrorType_None)
+        {
+            error_count++;
+        }
+        outstanding_requests.erase(r);
+    }
+
+    this_cv.notify_all();
+}
+
+} // namespace test
+} // namespace RobotRaconteur
@@ -0,0 +1,83 @@
+#include <RobotRaconteur/RobotRaconteurNode.h>
+#include <RobotRaconteur/Endpoint.h>
+#include <RobotRaconteur/Tap.h>
+
+#pragma once
+
+namespace RobotRaconteur
+{
+namespace test
+{
+
+enum MessageReplayTiming
+{
+    // Send messages with the delays between them in the recording
+    MessageReplayTiming_original = 0,
+    // Send messages with the recorded delays divided by time_scale
+    MessageReplayTiming_scaled,
+    // Send messages as fast as possible
+    MessageReplayTiming_as_fast_as_possible
+};
+
+struct MessageReplayStatistics
+{
+    size_t sent_count;
+    size_t response_count;
+    size_t error_count;
+    double elapsed_seconds;
+    double throughput;
+    double latency_mean_us;
+    double latency_p50_us;
+    double latency_p99_us;
+    double latency_max_us;
+
+    MessageReplayStatistics();
+};
+
+// Read a recording. Directories are read with FileRingMessageTapReader, files are read as a
+// sequence of Message4 encoded messages as written by the local tap recorder.
+std::vector<RR_INTRUSIVE_PTR<Message> > ReadMessageReplayRecording(const std::string& path);
+
+// Select the messages sent by the first client that connected to a service in the recording,
+// starting with the connect request. Log records, transport messages and duplicates recorded
+// on both the send and receive side of an intra connection are dropped.
+std::vector<RR_INTRUSIVE_PTR<Message> > SelectMessageReplayClientMessages(
+    const std::vector<RR_INTRUSIVE_PTR<Message> >& messages);
+
+// Endpoint that sends recorded client messages to a node and measures the time until the
+// response to each request is received
+class MessageReplayEndpoint : public Endpoint, public RR_ENABLE_SHARED_FROM_THIS<MessageReplayEndpoint>
+{
+  public:
+    MessageReplayEndpoint(const RR_SHARED_PTR<RobotRaconteurNode>& node);
+
+    void Connect(const RR_SHARED_PTR<Transport>& transport, const std::string& url, int32_t timeout = 10000);
+
+    MessageReplayStatistics Replay(const std::vector<RR_INTRUSIVE_PTR<Message> >& messages,
+                                   MessageReplayTiming timing = MessageReplayTiming_as_fast_as_possible,
+                                   double time_scale = 1.0, int32_t timeout = 10000);
+
+    void Close();
+
+    RR_OVIRTUAL void MessageReceived(const RR_INTRUSIVE_PTR<Message>& m) RR_OVERRIDE;
+
+    RR_OVIRTUAL ~MessageReplayEndpoint() RR_OVERRIDE {}
+
+  protected:
+    void connect_handler(const RR_SHARED_PTR<ITransportConnection>& connection,
+                         const RR_SHARED_PTR<RobotRaconteurException>& err);
+
+    boost::mutex this_lock;
+    boost::condition_variable this_cv;
+
+    bool connect_complete;
+    RR_SHARED_PTR<ITransportConnection> connect_connection;
+    RR_SHARED_PTR<RobotRaconteurException> connect_error;
+
+    std::map<uint32_t, boost::posix_time::ptime> outstanding_requests;
+    std::vector<double> latencies;
+    size_t error_count;
+};
+
+} // namespace test
+} // namespace RobotRaconteur
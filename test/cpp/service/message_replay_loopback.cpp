@@ -0,0 +1,140 @@
+#include <boost/shared_array.hpp>
+
+#include <gtest/gtest.h>
+#include <RobotRaconteur/ServiceDefinition.h>
+#include <RobotRaconteur/RobotRaconteurNode.h>
+#include <RobotRaconteur/IOUtils.h>
+
+#include "com__robotraconteur__testing__TestService1.h"
+#include "com__robotraconteur__testing__TestService1_stubskel.h"
+
+#include "ServiceTest.h"
+#include "robotraconteur_generated.h"
+#include "service_test_utils.h"
+#include "message_replay.h"
+#include "message_test_util.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteur::test;
+using namespace RobotRaconteurTest;
+using namespace com::robotraconteur::testing::TestService1;
+using namespace com::robotraconteur::testing::TestService2;
+
+TEST(RobotRaconteurService, MessageReplayReadRecording)
+{
+    boost::filesystem::path path = boost::filesystem::temp_directory_path() /
+                                   boost::filesystem::unique_path("robotraconteur_replay_test_%%%%-%%%%-%%%%.rrmsg");
+
+    LFSRSeqGen rng(9584213, "message_replay_read_recording");
+
+    std::vector<RR_INTRUSIVE_PTR<Message> > messages;
+    {
+        boost::filesystem::ofstream f(path, std::ios::binary);
+        for (size_t i = 0; i < 16; i++)
+        {
+            RR_INTRUSIVE_PTR<Message> m = NewRandomTestMessage4(rng);
+            size_t message_size = m->ComputeSize4();
+            boost::shared_array<uint8_t> buf(new uint8_t[message_size]);
+            ArrayBinaryWriter w(buf.get(), 0, message_size);
+            m->Write4(w);
+            f.write(reinterpret_cast<const char*>(buf.get()), message_size);
+            messages.push_back(m);
+        }
+    }
+
+    std::vector<RR_INTRUSIVE_PTR<Message> > messages2 = ReadMessageReplayRecording(path.string());
+    ASSERT_EQ(messages2.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        CompareMessage(messages[i], messages2[i]);
+    }
+
+    boost::filesystem::remove(path);
+}
+
+TEST(RobotRaconteurService, MessageReplayLoopback)
+{
+    RobotRaconteurNode::s()->SetNodeName("test_message_replay_loopback");
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+
+    RR_SHARED_PTR<IntraTransport> c = RR_MAKE_SHARED<IntraTransport>();
+    c->StartServer();
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    c2->StartServer(0);
+
+    RobotRaconteurNode::s()->RegisterTransport(c);
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    std::string url = "rr+intra:///?nodename=test_message_replay_loopback&service=RobotRaconteurTestService";
+
+    boost::filesystem::path dir = boost::filesystem::temp_directory_path() /
+                                  boost::filesystem::unique_path("robotraconteur_replay_test_%%%%-%%%%-%%%%");
+
+    // Record a short client session
+    {
+        RR_SHARED_PTR<FileRingMessageTap> tap = RR_MAKE_SHARED<FileRingMessageTap>(dir.string());
+        tap->Open();
+        RobotRaconteurNode::s()->SetMessageTap(tap);
+
+        RR_SHARED_PTR<testroot> o = rr_cast<testroot>(RobotRaconteurNode::s()->ConnectService(url));
+        for (size_t i = 0; i < 10; i++)
+        {
+            o->get_d1();
+            o->set_d1(3.456);
+            o->func1();
+        }
+        RobotRaconteurNode::s()->DisconnectService(o);
+
+        RobotRaconteurNode::s()->SetMessageTap(RR_SHARED_PTR<MessageTap>());
+        tap->Close();
+        EXPECT_EQ(tap->GetDroppedCount(), 0);
+    }
+
+    std::vector<RR_INTRUSIVE_PTR<Message> > messages =
+        SelectMessageReplayClientMessages(ReadMessageReplayRecording(dir.string()));
+    ASSERT_GE(messages.size(), 31u);
+
+    size_t request_count = 0;
+    BOOST_FOREACH (const RR_INTRUSIVE_PTR<Message>& m, messages)
+    {
+        BOOST_FOREACH (const RR_INTRUSIVE_PTR<MessageEntry>& e, m->entries)
+        {
+            if (e->RequestID != 0)
+            {
+                request_count++;
+            }
+        }
+    }
+
+    RR_SHARED_PTR<MessageReplayEndpoint> e = RR_MAKE_SHARED<MessageReplayEndpoint>(RobotRaconteurNode::sp());
+    e->Connect(c, url);
+    MessageReplayStatistics stats = e->Replay(messages, MessageReplayTiming_as_fast_as_possible);
+    e->Close();
+
+    EXPECT_EQ(stats.sent_count, messages.size());
+    EXPECT_EQ(stats.response_count, request_count);
+    EXPECT_EQ(stats.error_count, 0u);
+    EXPECT_GT(stats.throughput, 0.0);
+    EXPECT_LE(stats.latency_p50_us, stats.latency_max_us);
+
+    boost::filesystem::remove_all(dir);
+
+    RobotRaconteurNode::s()->Shutdown();
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    int ret = RUN_ALL_TESTS();
+
+    return ret;
+}
@@ -0,0 +1,93 @@
+#include <RobotRaconteur.h>
+
+#include "robotraconteur_generated.h"
+#include "ServiceTest.h"
+#include "message_replay.h"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteur::test;
+using namespace RobotRaconteurTest;
+using namespace std;
+using namespace com::robotraconteur::testing::TestService1;
+using namespace com::robotraconteur::testing::TestService2;
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        cout << "Usage: messagereplay recording [original|scaled|fast] [time_scale] [url]" << endl;
+        cout << "Replays the client messages in a recording against the test service, or against url if specified"
+             << endl;
+        return -1;
+    }
+
+    string recording(argv[1]);
+    string mode = (argc >= 3) ? argv[2] : "fast";
+    double time_scale = (argc >= 4) ? boost::lexical_cast<double>(argv[3]) : 1.0;
+
+    MessageReplayTiming timing = MessageReplayTiming_as_fast_as_possible;
+    if (mode == "original")
+    {
+        timing = MessageReplayTiming_original;
+    }
+    else if (mode == "scaled")
+    {
+        timing = MessageReplayTiming_scaled;
+    }
+    else if (mode != "fast")
+    {
+        cout << "Invalid replay mode " << mode << endl;
+        return -1;
+    }
+
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+
+    RR_SHARED_PTR<IntraTransport> c = RR_MAKE_SHARED<IntraTransport>();
+    RobotRaconteurNode::s()->RegisterTransport(c);
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    RobotRaconteurNode::s()->RegisterTransport(c2);
+
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RR_SHARED_PTR<Transport> transport = c;
+    string url;
+    RR_SHARED_PTR<RobotRaconteurTestServiceSupport> s;
+
+    if (argc >= 5)
+    {
+        url = argv[4];
+        transport = c2;
+    }
+    else
+    {
+        RobotRaconteurNode::s()->SetNodeName("messagereplay");
+        c->StartServer();
+        c2->StartServer(0);
+        s = RR_MAKE_SHARED<RobotRaconteurTestServiceSupport>();
+        s->RegisterServices(c2);
+        url = "rr+intra:///?nodename=messagereplay&service=RobotRaconteurTestService";
+    }
+
+    vector<RR_INTRUSIVE_PTR<Message> > messages =
+        SelectMessageReplayClientMessages(ReadMessageReplayRecording(recording));
+    cout << "Replaying " << messages.size() << " messages" << endl;
+
+    RR_SHARED_PTR<MessageReplayEndpoint> e = RR_MAKE_SHARED<MessageReplayEndpoint>(RobotRaconteurNode::sp());
+    e->Connect(transport, url);
+    MessageReplayStatistics stats = e->Replay(messages, timing, time_scale);
+    e->Close();
+
+    cout << "Sent: " << stats.sent_count << " Responses: " << stats.response_count
+         << " Errors: " << stats.error_count << endl;
+    cout << "Elapsed: " << stats.elapsed_seconds << " s Throughput: " << stats.throughput << " responses/s" << endl;
+    cout << "Latency (us) mean: " << stats.latency_mean_us << " p50: " << stats.latency_p50_us
+         << " p99: " << stats.latency_p99_us << " max: " << stats.latency_max_us << endl;
+
+    RobotRaconteurNode::s()->Shutdown();
+
+    return 0;
+}
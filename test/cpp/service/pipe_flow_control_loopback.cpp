@@ -0,0 +1,81 @@
+#include <boost/shared_array.hpp>
+
+#include <gtest/gtest.h>
+#include <RobotRaconteur/ServiceDefinition.h>
+#include <RobotRaconteur/RobotRaconteurNode.h>
+
+#include "com__robotraconteur__testing__TestService1.h"
+#include "com__robotraconteur__testing__TestService1_stubskel.h"
+
+#include "ServiceTestClient.h"
+#include "ServiceTest.h"
+#include "robotraconteur_generated.h"
+#include "service_test_utils.h"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteur::test;
+using namespace RobotRaconteurTest;
+using namespace com::robotraconteur::testing::TestService1;
+
+TEST(RobotRaconteurService, PipeFlowControlLoopback)
+{
+    RobotRaconteurNode::s()->SetNodeName("pipe_flow_control_loopback");
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    c2->StartServer(0);
+
+    RobotRaconteurNode::s()->RegisterTransport(c2);
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    std::string port_str = boost::lexical_cast<std::string>(c2->GetListenPort());
+
+    {
+        RR_SHARED_PTR<testroot> r = rr_cast<testroot>(RobotRaconteurNode::s()->ConnectService(
+            std::string("rr+tcp://localhost:") + port_str + "/?service=RobotRaconteurTestService"));
+
+        // The service sends bursts of packets using a PipeBroadcaster. Limit the packets in flight to the client.
+        RR_SHARED_PTR<Pipe<double> > p = r->get_broadcastpipe();
+        p->SetFlowControlWindow(4);
+        RR_SHARED_PTR<PipeEndpoint<double> > ep = p->Connect(-1);
+
+        EXPECT_EQ(ep->GetRecvWindow(), 4u);
+        EXPECT_EQ(ep->GetSendWindow(), 0u);
+        EXPECT_TRUE(ep->TryWaitSendWindow(0));
+
+        // The broadcaster must stop sending once the window is full
+        boost::this_thread::sleep(boost::posix_time::milliseconds(500));
+        EXPECT_GT(ep->Available(), 0u);
+        EXPECT_LE(ep->Available(), 4u);
+
+        // Credits are granted as packets are received, so packets continue to arrive
+        for (size_t i = 0; i < 20; i++)
+        {
+            EXPECT_NO_THROW(ep->ReceivePacketWait(5000));
+        }
+        EXPECT_LE(ep->Available(), 4u);
+
+        EXPECT_NO_THROW(ep->Close());
+
+        RobotRaconteurNode::s()->DisconnectService(r);
+    }
+
+    cout << "start shutdown" << endl;
+
+    RobotRaconteurNode::s()->Shutdown();
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    int ret = RUN_ALL_TESTS();
+
+    return ret;
+}
@@ -0,0 +1,97 @@
+#include <RobotRaconteur.h>
+
+#include "com__robotraconteur__testing__TestService1.h"
+#include "com__robotraconteur__testing__TestService1_stubskel.h"
+
+#include "ServiceTest.h"
+#include "robotraconteur_generated.h"
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteurTest;
+using namespace std;
+using namespace com::robotraconteur::testing::TestService1;
+using namespace com::robotraconteur::testing::TestService2;
+
+// Measures message routing throughput when many client threads send and
+// receive through the same node at the same time. Each thread owns its own
+// connection so every request looks up a different endpoint.
+
+static void routingcontentiontest_run(const RR_SHARED_PTR<testroot>& o, uint32_t iters, boost::barrier* start_barrier)
+{
+    start_barrier->wait();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        o->get_d1();
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t thread_count = 8;
+    uint32_t iters = 10000;
+
+    if (argc > 1)
+    {
+        thread_count = boost::lexical_cast<uint32_t>(argv[1]);
+    }
+    if (argc > 2)
+    {
+        iters = boost::lexical_cast<uint32_t>(argv[2]);
+    }
+
+    if (thread_count < 1)
+    {
+        cout << "Usage: routingcontentiontest [thread_count] [iterations]" << endl;
+        return -1;
+    }
+
+    RobotRaconteurNode::s()->SetNodeName("routing_contention_test");
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+    RobotRaconteurNode::s()->SetThreadPoolCount(thread_count * 2);
+
+    RR_SHARED_PTR<IntraTransport> c = RR_MAKE_SHARED<IntraTransport>();
+    c->StartServer();
+    RobotRaconteurNode::s()->RegisterTransport(c);
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    std::vector<RR_SHARED_PTR<testroot> > clients;
+    for (uint32_t i = 0; i < thread_count; i++)
+    {
+        clients.push_back(rr_cast<testroot>(RobotRaconteurNode::s()->ConnectService(
+            "rr+intra:///?nodename=routing_contention_test&service=RobotRaconteurTestService")));
+    }
+
+    boost::barrier start_barrier(thread_count + 1);
+    boost::thread_group threads;
+    for (uint32_t i = 0; i < thread_count; i++)
+    {
+        threads.create_thread(boost::bind(&routingcontentiontest_run, clients[i], iters, &start_barrier));
+    }
+
+    start_barrier.wait();
+    boost::posix_time::ptime t1 = boost::posix_time::microsec_clock::universal_time();
+    threads.join_all();
+    boost::posix_time::ptime t2 = boost::posix_time::microsec_clock::universal_time();
+
+    double seconds = static_cast<double>((t2 - t1).total_microseconds()) * 1e-6;
+    double total = static_cast<double>(thread_count) * static_cast<double>(iters);
+
+    cout << "Threads: " << thread_count << " Iterations: " << iters << endl;
+    cout << "Elapsed: " << seconds << " s" << endl;
+    cout << "Requests per second: " << (total / seconds) << endl;
+
+    BOOST_FOREACH (RR_SHARED_PTR<testroot>& o, clients)
+    {
+        RobotRaconteurNode::s()->DisconnectService(o);
+    }
+
+    RobotRaconteurNode::s()->Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <RobotRaconteur.h>
+
+#include "robotraconteur_generated.h"
+#include "ServiceTest.h"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteurTest;
+using namespace std;
+using namespace com::robotraconteur::testing::TestService1;
+using namespace com::robotraconteur::testing::TestService2;
+
+// Measures the server side cost of ServerContext::ProcessMessageEntry without a transport. The
+// wire packet is addressed to an endpoint without a wire connection so it is dropped by the wire
+// server after dispatch, which leaves only the per-message overhead of the service.
+
+static double period_us(const boost::posix_time::ptime& t1, const boost::posix_time::ptime& t2, uint32_t iters)
+{
+    return static_cast<double>((t2 - t1).total_microseconds()) / static_cast<double>(iters);
+}
+
+static void run_benchmark(const RR_SHARED_PTR<ServerContext>& context, const RR_SHARED_PTR<ServerEndpoint>& e,
+                          const RR_INTRUSIVE_PTR<MessageEntry>& m, uint32_t iters, const std::string& name)
+{
+    boost::posix_time::ptime t1 = RobotRaconteurNode::s()->NowNodeTime();
+    for (uint32_t i = 0; i < iters; i++)
+    {
+        context->ProcessMessageEntry(m, e);
+    }
+    boost::posix_time::ptime t2 = RobotRaconteurNode::s()->NowNodeTime();
+    cout << name << " period=" << period_us(t1, t2, iters) << " us" << endl;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t iters = 1000000;
+    if (argc >= 2)
+    {
+        iters = boost::lexical_cast<uint32_t>(argv[1]);
+    }
+
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+    RobotRaconteurNode::s()->SetNodeName("serverdispatchbenchmark");
+
+    RR_SHARED_PTR<TcpTransport> c = RR_MAKE_SHARED<TcpTransport>();
+    RobotRaconteurNode::s()->RegisterTransport(c);
+
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c);
+
+    RR_SHARED_PTR<ServerContext> context = RobotRaconteurNode::s()->GetService("RobotRaconteurTestService");
+    RR_SHARED_PTR<ServerEndpoint> e = RR_MAKE_SHARED<ServerEndpoint>(RobotRaconteurNode::sp());
+    e->service = context;
+
+    RR_INTRUSIVE_PTR<MessageEntry> m_wire = CreateMessageEntry(MessageEntryType_WirePacket, "w1");
+    m_wire->ServicePath = "RobotRaconteurTestService";
+    m_wire->AddElement("packettime", AllocateRRArray<uint8_t>(16));
+    run_benchmark(context, e, m_wire, iters, "WirePacket");
+
+    RR_INTRUSIVE_PTR<MessageEntry> m_get = CreateMessageEntry(MessageEntryType_PropertyGetReq, "d1");
+    m_get->ServicePath = "RobotRaconteurTestService";
+    run_benchmark(context, e, m_get, iters, "PropertyGetReq");
+
+    RobotRaconteurNode::s()->Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include <boost/shared_array.hpp>
+
+#include <gtest/gtest.h>
+#include <RobotRaconteur/ServiceDefinition.h>
+#include <RobotRaconteur/RobotRaconteurNode.h>
+
+#include "com__robotraconteur__testing__TestService1.h"
+#include "com__robotraconteur__testing__TestService1_stubskel.h"
+
+#include "ServiceTestClient.h"
+#include "ServiceTest.h"
+#include "robotraconteur_generated.h"
+#include "service_test_utils.h"
+
+#include <boost/lexical_cast.hpp>
+#include <set>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteur::test;
+using namespace RobotRaconteurTest;
+
+TEST(RobotRaconteurService, ShardedThreadPoolLoopback)
+{
+    RobotRaconteurNode::s()->SetNodeName("sharded_thread_pool_loopback");
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+    RobotRaconteurNode::s()->SetThreadPoolFactory(RR_MAKE_SHARED<ShardedThreadPoolFactory>(4));
+
+    RR_SHARED_PTR<ShardedThreadPool> pool =
+        RR_DYNAMIC_POINTER_CAST<ShardedThreadPool>(RobotRaconteurNode::s()->GetThreadPool());
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(pool->GetShardCount(), 4u);
+
+    // New connections are distributed over the shards
+    std::set<RR_BOOST_ASIO_IO_CONTEXT*> contexts;
+    for (size_t i = 0; i < 4; i++)
+    {
+        contexts.insert(&pool->get_next_io_context());
+    }
+    EXPECT_EQ(contexts.size(), 4u);
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    c2->StartServer(0);
+
+    RobotRaconteurNode::s()->RegisterTransport(c2);
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    std::string port_str = boost::lexical_cast<std::string>(c2->GetListenPort());
+
+    {
+        ServiceTestClient cl;
+        EXPECT_NO_THROW(
+            cl.RunFullTest(std::string("rr+tcp://localhost:") + port_str + "/?service=RobotRaconteurTestService",
+                           std::string("rr+tcp://localhost:") + port_str +
+                               "/?nodename=sharded_thread_pool_loopback&service=RobotRaconteurTestService_auth"));
+    }
+
+    cout << "start shutdown" << endl;
+
+    RobotRaconteurNode::s()->Shutdown();
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    int ret = RUN_ALL_TESTS();
+
+    return ret;
+}
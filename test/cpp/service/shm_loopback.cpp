@@ -0,0 +1,63 @@
+#include <boost/shared_array.hpp>
+
+#include <gtest/gtest.h>
+#include <RobotRaconteur/ServiceDefinition.h>
+#include <RobotRaconteur/RobotRaconteurNode.h>
+#include <RobotRaconteur/SharedMemoryTransport.h>
+
+#include "com__robotraconteur__testing__TestService1.h"
+#include "com__robotraconteur__testing__TestService1_stubskel.h"
+
+#include "ServiceTestClient.h"
+#include "ServiceTest.h"
+#include "robotraconteur_generated.h"
+#include "service_test_utils.h"
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteur::test;
+using namespace RobotRaconteurTest;
+
+TEST(RobotRaconteurService, SharedMemoryLoopback)
+{
+    RobotRaconteurNode::s()->SetNodeName("test_shm_loopback");
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+
+    RR_SHARED_PTR<SharedMemoryTransport> c = RR_MAKE_SHARED<SharedMemoryTransport>();
+    // Small ring and threshold so the wrap, large message and shared array paths are used
+    c->SetRingBufferSize(128 * 1024);
+    c->SetSharedArrayThreshold(1024);
+    c->StartServer();
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    c2->StartServer(0);
+
+    // c->EnableNodeAnnounce();
+    // c->EnableNodeDiscoveryListening();
+
+    RobotRaconteurNode::s()->RegisterTransport(c);
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    {
+        ServiceTestClient cl;
+        EXPECT_NO_THROW(
+            cl.RunFullTest("rr+shm:///?nodename=test_shm_loopback&service=RobotRaconteurTestService",
+                           "rr+shm:///?nodename=test_shm_loopback&service=RobotRaconteurTestService_auth"));
+    }
+
+    cout << "start shutdown" << endl;
+
+    RobotRaconteurNode::s()->Shutdown();
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    int ret = RUN_ALL_TESTS();
+
+    return ret;
+}
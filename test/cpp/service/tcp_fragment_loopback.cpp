@@ -0,0 +1,87 @@
+#include <boost/shared_array.hpp>
+
+#include <gtest/gtest.h>
+#include <RobotRaconteur/ServiceDefinition.h>
+#include <RobotRaconteur/RobotRaconteurNode.h>
+
+#include "com__robotraconteur__testing__TestService1.h"
+#include "com__robotraconteur__testing__TestService1_stubskel.h"
+
+#include "ServiceTestClient.h"
+#include "ServiceTest.h"
+#include "robotraconteur_generated.h"
+#include "service_test_utils.h"
+
+#include <boost/lexical_cast.hpp>
+
+using namespace RobotRaconteur;
+using namespace RobotRaconteur::test;
+using namespace RobotRaconteurTest;
+using namespace com::robotraconteur::testing::TestService1;
+
+TEST(RobotRaconteurService, TcpFragmentLoopback)
+{
+    RobotRaconteurNode::s()->SetNodeName("tcp_fragment_loopback");
+    RobotRaconteurNode::s()->SetLogLevelFromEnvVariable();
+
+    RR_SHARED_PTR<TcpTransport> c2 = RR_MAKE_SHARED<TcpTransport>();
+    c2->StartServer(0);
+
+    RobotRaconteurNode::s()->RegisterTransport(c2);
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService1Factory>());
+    RobotRaconteurNode::s()->RegisterServiceType(RR_MAKE_SHARED<com__robotraconteur__testing__TestService2Factory>());
+
+    RobotRaconteurTestServiceSupport s;
+    s.RegisterServices(c2);
+
+    std::string port_str = boost::lexical_cast<std::string>(c2->GetListenPort());
+
+    {
+        RR_SHARED_PTR<testroot> r = rr_cast<testroot>(RobotRaconteurNode::s()->ConnectService(
+            std::string("rr+tcp://localhost:") + port_str + "/?service=RobotRaconteurTestService"));
+        RR_SHARED_PTR<sub1> o1 = r->get_o1();
+
+        // Larger than the maximum message size, so both directions must be fragmented
+        size_t n = (size_t)c2->GetMaxMessageSize() / sizeof(double) * 2 + 1234;
+        RR_INTRUSIVE_PTR<RRArray<double> > d1 = AllocateRRArray<double>(n);
+        for (size_t i = 0; i < n; i++)
+        {
+            (*d1)[i] = (double)i * 0.25;
+        }
+
+        EXPECT_NO_THROW(o1->set_d1(d1));
+        RR_INTRUSIVE_PTR<RRArray<double> > d1_2;
+        EXPECT_NO_THROW(d1_2 = o1->get_d1());
+        EXPECT_RRARRAY_EQ(d1, d1_2);
+
+        // The array of a multidimensional array is nested in the message element
+        std::vector<uint32_t> dims;
+        dims.push_back(1000);
+        dims.push_back(boost::numeric_cast<uint32_t>(n / 1000));
+        RR_INTRUSIVE_PTR<RRMultiDimArray<double> > d2 = AllocateRRMultiDimArray<double>(
+            VectorToRRArray<uint32_t>(dims), AllocateRRArray<double>(dims[0] * dims[1]));
+        memcpy(d2->Array->data(), d1->data(), d2->Array->size() * sizeof(double));
+
+        EXPECT_NO_THROW(o1->set_d2(d2));
+        RR_INTRUSIVE_PTR<RRMultiDimArray<double> > d2_2;
+        EXPECT_NO_THROW(d2_2 = o1->get_d2());
+        ASSERT_TRUE(d2_2);
+        EXPECT_RRARRAY_EQ(d2->Dims, d2_2->Dims);
+        EXPECT_RRARRAY_EQ(d2->Array, d2_2->Array);
+
+        RobotRaconteurNode::s()->DisconnectService(r);
+    }
+
+    cout << "start shutdown" << endl;
+
+    RobotRaconteurNode::s()->Shutdown();
+}
+
+int main(int argc, char* argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+
+    int ret = RUN_ALL_TESTS();
+
+    return ret;
+}
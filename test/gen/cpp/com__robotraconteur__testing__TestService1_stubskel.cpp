@@ -5580,6 +5580,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot_skel::CallGetProperty(co
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_PropertyGetRes,m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService1::async_testroot > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 2283607014U:
 if (m->MemberName == "d1")
 {
 if (async_obj)
@@ -5595,6 +5598,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<double >("value"
 return mr;
 }
 }
+break;
+case 2266829395U:
 if (m->MemberName == "d2")
 {
 if (async_obj)
@@ -5610,6 +5615,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<double >("value",
 return mr;
 }
 }
+break;
+case 2250051776U:
 if (m->MemberName == "d3")
 {
 if (async_obj)
@@ -5625,6 +5632,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<double >("value",
 return mr;
 }
 }
+break;
+case 2367495109U:
 if (m->MemberName == "d4")
 {
 if (async_obj)
@@ -5640,6 +5649,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<double >("value",
 return mr;
 }
 }
+break;
+case 2350717490U:
 if (m->MemberName == "d5")
 {
 if (async_obj)
@@ -5655,6 +5666,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<double >(
 return mr;
 }
 }
+break;
+case 2333939871U:
 if (m->MemberName == "d6")
 {
 if (async_obj)
@@ -5670,6 +5683,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<double >(
 return mr;
 }
 }
+break;
+case 139573449U:
 if (m->MemberName == "s1")
 {
 if (async_obj)
@@ -5685,6 +5700,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<float >("value",
 return mr;
 }
 }
+break;
+case 89240592U:
 if (m->MemberName == "s2")
 {
 if (async_obj)
@@ -5700,6 +5717,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<float >("value",v
 return mr;
 }
 }
+break;
+case 860030016U:
 if (m->MemberName == "i8_1")
 {
 if (async_obj)
@@ -5715,6 +5734,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int8_t >("value"
 return mr;
 }
 }
+break;
+case 910362873U:
 if (m->MemberName == "i8_2")
 {
 if (async_obj)
@@ -5730,6 +5751,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<int8_t >("value",
 return mr;
 }
 }
+break;
+case 2244788668U:
 if (m->MemberName == "u8_1")
 {
 if (async_obj)
@@ -5745,6 +5768,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<uint8_t >("value
 return mr;
 }
 }
+break;
+case 2295121525U:
 if (m->MemberName == "u8_2")
 {
 if (async_obj)
@@ -5760,6 +5785,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<uint8_t >("value"
 return mr;
 }
 }
+break;
+case 2278343906U:
 if (m->MemberName == "u8_3")
 {
 if (async_obj)
@@ -5775,6 +5802,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<uint8_t >
 return mr;
 }
 }
+break;
+case 1653091143U:
 if (m->MemberName == "i16_1")
 {
 if (async_obj)
@@ -5790,6 +5819,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int16_t >("value
 return mr;
 }
 }
+break;
+case 1669868762U:
 if (m->MemberName == "i16_2")
 {
 if (async_obj)
@@ -5805,6 +5836,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<int16_t >("value"
 return mr;
 }
 }
+break;
+case 1663433315U:
 if (m->MemberName == "u16_1")
 {
 if (async_obj)
@@ -5820,6 +5853,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<uint16_t >("valu
 return mr;
 }
 }
+break;
+case 1680210934U:
 if (m->MemberName == "u16_2")
 {
 if (async_obj)
@@ -5835,6 +5870,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<uint16_t >("value
 return mr;
 }
 }
+break;
+case 1620503469U:
 if (m->MemberName == "i32_1")
 {
 if (async_obj)
@@ -5850,6 +5887,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int32_t >("value
 return mr;
 }
 }
+break;
+case 1570170612U:
 if (m->MemberName == "i32_2")
 {
 if (async_obj)
@@ -5865,6 +5904,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<int32_t >("value"
 return mr;
 }
 }
+break;
+case 2064476217U:
 if (m->MemberName == "i32_huge")
 {
 if (async_obj)
@@ -5880,6 +5921,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<int32_t >("value"
 return mr;
 }
 }
+break;
+case 2775599617U:
 if (m->MemberName == "u32_1")
 {
 if (async_obj)
@@ -5895,6 +5938,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<uint32_t >("valu
 return mr;
 }
 }
+break;
+case 2725266760U:
 if (m->MemberName == "u32_2")
 {
 if (async_obj)
@@ -5910,6 +5955,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<uint32_t >("value
 return mr;
 }
 }
+break;
+case 3982616126U:
 if (m->MemberName == "i64_1")
 {
 if (async_obj)
@@ -5925,6 +5972,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int64_t >("value
 return mr;
 }
 }
+break;
+case 3965838507U:
 if (m->MemberName == "i64_2")
 {
 if (async_obj)
@@ -5940,6 +5989,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<int64_t >("value"
 return mr;
 }
 }
+break;
+case 2780644210U:
 if (m->MemberName == "u64_1")
 {
 if (async_obj)
@@ -5955,6 +6006,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<uint64_t >("valu
 return mr;
 }
 }
+break;
+case 2763866591U:
 if (m->MemberName == "u64_2")
 {
 if (async_obj)
@@ -5970,6 +6023,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<uint64_t >("value
 return mr;
 }
 }
+break;
+case 2119893107U:
 if (m->MemberName == "str1")
 {
 if (async_obj)
@@ -5985,6 +6040,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStringElement("value",value));
 return mr;
 }
 }
+break;
+case 428946627U:
 if (m->MemberName == "struct1")
 {
 if (async_obj)
@@ -6000,6 +6057,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStructElement(RRGetNodeWeak(),
 return mr;
 }
 }
+break;
+case 445724246U:
 if (m->MemberName == "struct2")
 {
 if (async_obj)
@@ -6015,6 +6074,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStructElement(RRGetNodeWeak(),
 return mr;
 }
 }
+break;
+case 927387661U:
 if (m->MemberName == "is_d1")
 {
 if (async_obj)
@@ -6030,6 +6091,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 877054804U:
 if (m->MemberName == "is_d2")
 {
 if (async_obj)
@@ -6045,6 +6108,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<std::string,RobotRa
 return mr;
 }
 }
+break;
+case 893832423U:
 if (m->MemberName == "is_d3")
 {
 if (async_obj)
@@ -6060,6 +6125,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 843499566U:
 if (m->MemberName == "is_d4")
 {
 if (async_obj)
@@ -6075,6 +6142,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<std::string,RobotRa
 return mr;
 }
 }
+break;
+case 860277185U:
 if (m->MemberName == "is_d5")
 {
 if (async_obj)
@@ -6090,6 +6159,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 809944328U:
 if (m->MemberName == "is_d6")
 {
 if (async_obj)
@@ -6105,6 +6176,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<std::string,RobotRa
 return mr;
 }
 }
+break;
+case 3509864928U:
 if (m->MemberName == "is_str1")
 {
 if (async_obj)
@@ -6120,6 +6193,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 3560197785U:
 if (m->MemberName == "is_str2")
 {
 if (async_obj)
@@ -6135,6 +6210,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<std::string,RobotRa
 return mr;
 }
 }
+break;
+case 1659339790U:
 if (m->MemberName == "is_struct1")
 {
 if (async_obj)
@@ -6150,6 +6227,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,teststruct2
 return mr;
 }
 }
+break;
+case 1642562171U:
 if (m->MemberName == "is_struct2")
 {
 if (async_obj)
@@ -6165,6 +6244,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<std::string,teststr
 return mr;
 }
 }
+break;
+case 462501865U:
 if (m->MemberName == "struct3")
 {
 if (async_obj)
@@ -6180,6 +6261,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStructElement(RRGetNodeWeak(),
 return mr;
 }
 }
+break;
+case 1347812177U:
 if (m->MemberName == "list_d1")
 {
 if (async_obj)
@@ -6195,6 +6278,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 1314256939U:
 if (m->MemberName == "list_d3")
 {
 if (async_obj)
@@ -6210,6 +6295,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 1414922653U:
 if (m->MemberName == "list_d5")
 {
 if (async_obj)
@@ -6225,6 +6312,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2237349844U:
 if (m->MemberName == "list_str1")
 {
 if (async_obj)
@@ -6240,6 +6329,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 723748586U:
 if (m->MemberName == "list_struct1")
 {
 if (async_obj)
@@ -6255,6 +6346,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<teststruct2  >(RRG
 return mr;
 }
 }
+break;
+case 145458717U:
 if (m->MemberName == "var1")
 {
 if (async_obj)
@@ -6270,6 +6363,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 95125860U:
 if (m->MemberName == "var2")
 {
 if (async_obj)
@@ -6285,6 +6380,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 1128751073U:
 if (m->MemberName == "var_num")
 {
 if (async_obj)
@@ -6300,6 +6397,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 3873036906U:
 if (m->MemberName == "var_str")
 {
 if (async_obj)
@@ -6315,6 +6414,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 2296596922U:
 if (m->MemberName == "var_struct")
 {
 if (async_obj)
@@ -6330,6 +6431,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 1212725712U:
 if (m->MemberName == "var_vector")
 {
 if (async_obj)
@@ -6345,6 +6448,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 2003121755U:
 if (m->MemberName == "var_dictionary")
 {
 if (async_obj)
@@ -6360,6 +6465,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 758700987U:
 if (m->MemberName == "var_list")
 {
 if (async_obj)
@@ -6375,6 +6482,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 2716968003U:
 if (m->MemberName == "var_multidimarray")
 {
 if (async_obj)
@@ -6390,6 +6499,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackVarTypeElement(RRGetNodeWeak()
 return mr;
 }
 }
+break;
+case 3126090440U:
 if (m->MemberName == "errtest")
 {
 if (async_obj)
@@ -6405,6 +6516,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<double >("value"
 return mr;
 }
 }
+break;
+case 2582687424U:
 if (m->MemberName == "nulltest")
 {
 if (async_obj)
@@ -6420,6 +6533,10 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStructElement(RRGetNodeWeak(),
 return mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -6427,6 +6544,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot_skel::CallSetProperty(co
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_PropertySetRes,m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService1::async_testroot > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 2283607014U:
 if (m->MemberName == "d1")
 {
 double value=RobotRaconteur::MessageElement_UnpackScalar<double >(m->FindElement("value"));
@@ -6442,6 +6562,8 @@ get_obj()->set_d1(value);
 return mr;
 }
 }
+break;
+case 2266829395U:
 if (m->MemberName == "d2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<double > > value=RobotRaconteur::MessageElement_UnpackArray<double >(m->FindElement("value"));
@@ -6457,6 +6579,8 @@ get_obj()->set_d2(value);
 return mr;
 }
 }
+break;
+case 2250051776U:
 if (m->MemberName == "d3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<double > > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackArray<double >(m->FindElement("value")), 16, false);
@@ -6472,6 +6596,8 @@ get_obj()->set_d3(value);
 return mr;
 }
 }
+break;
+case 2367495109U:
 if (m->MemberName == "d4")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<double > > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackArray<double >(m->FindElement("value")), 16, true);
@@ -6487,6 +6613,8 @@ get_obj()->set_d4(value);
 return mr;
 }
 }
+break;
+case 2350717490U:
 if (m->MemberName == "d5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<double > > value=RobotRaconteur::MessageElement_UnpackMultiDimArray<double >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6502,6 +6630,8 @@ get_obj()->set_d5(value);
 return mr;
 }
 }
+break;
+case 2333939871U:
 if (m->MemberName == "d6")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<double > > value=RobotRaconteur::VerifyRRMultiDimArrayLength<2>(RobotRaconteur::MessageElement_UnpackMultiDimArray<double >(RRGetNodeWeak(),m->FindElement("value")),9,boost::assign::list_of(3)(3));
@@ -6517,6 +6647,8 @@ get_obj()->set_d6(value);
 return mr;
 }
 }
+break;
+case 139573449U:
 if (m->MemberName == "s1")
 {
 float value=RobotRaconteur::MessageElement_UnpackScalar<float >(m->FindElement("value"));
@@ -6532,6 +6664,8 @@ get_obj()->set_s1(value);
 return mr;
 }
 }
+break;
+case 89240592U:
 if (m->MemberName == "s2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<float > > value=RobotRaconteur::MessageElement_UnpackArray<float >(m->FindElement("value"));
@@ -6547,6 +6681,8 @@ get_obj()->set_s2(value);
 return mr;
 }
 }
+break;
+case 860030016U:
 if (m->MemberName == "i8_1")
 {
 int8_t value=RobotRaconteur::MessageElement_UnpackScalar<int8_t >(m->FindElement("value"));
@@ -6562,6 +6698,8 @@ get_obj()->set_i8_1(value);
 return mr;
 }
 }
+break;
+case 910362873U:
 if (m->MemberName == "i8_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<int8_t > > value=RobotRaconteur::MessageElement_UnpackArray<int8_t >(m->FindElement("value"));
@@ -6577,6 +6715,8 @@ get_obj()->set_i8_2(value);
 return mr;
 }
 }
+break;
+case 2244788668U:
 if (m->MemberName == "u8_1")
 {
 uint8_t value=RobotRaconteur::MessageElement_UnpackScalar<uint8_t >(m->FindElement("value"));
@@ -6592,6 +6732,8 @@ get_obj()->set_u8_1(value);
 return mr;
 }
 }
+break;
+case 2295121525U:
 if (m->MemberName == "u8_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<uint8_t > > value=RobotRaconteur::MessageElement_UnpackArray<uint8_t >(m->FindElement("value"));
@@ -6607,6 +6749,8 @@ get_obj()->set_u8_2(value);
 return mr;
 }
 }
+break;
+case 2278343906U:
 if (m->MemberName == "u8_3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<uint8_t > > value=RobotRaconteur::MessageElement_UnpackMultiDimArray<uint8_t >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6622,6 +6766,8 @@ get_obj()->set_u8_3(value);
 return mr;
 }
 }
+break;
+case 1653091143U:
 if (m->MemberName == "i16_1")
 {
 int16_t value=RobotRaconteur::MessageElement_UnpackScalar<int16_t >(m->FindElement("value"));
@@ -6637,6 +6783,8 @@ get_obj()->set_i16_1(value);
 return mr;
 }
 }
+break;
+case 1669868762U:
 if (m->MemberName == "i16_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<int16_t > > value=RobotRaconteur::MessageElement_UnpackArray<int16_t >(m->FindElement("value"));
@@ -6652,6 +6800,8 @@ get_obj()->set_i16_2(value);
 return mr;
 }
 }
+break;
+case 1663433315U:
 if (m->MemberName == "u16_1")
 {
 uint16_t value=RobotRaconteur::MessageElement_UnpackScalar<uint16_t >(m->FindElement("value"));
@@ -6667,6 +6817,8 @@ get_obj()->set_u16_1(value);
 return mr;
 }
 }
+break;
+case 1680210934U:
 if (m->MemberName == "u16_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<uint16_t > > value=RobotRaconteur::MessageElement_UnpackArray<uint16_t >(m->FindElement("value"));
@@ -6682,6 +6834,8 @@ get_obj()->set_u16_2(value);
 return mr;
 }
 }
+break;
+case 1620503469U:
 if (m->MemberName == "i32_1")
 {
 int32_t value=RobotRaconteur::MessageElement_UnpackScalar<int32_t >(m->FindElement("value"));
@@ -6697,6 +6851,8 @@ get_obj()->set_i32_1(value);
 return mr;
 }
 }
+break;
+case 1570170612U:
 if (m->MemberName == "i32_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<int32_t > > value=RobotRaconteur::MessageElement_UnpackArray<int32_t >(m->FindElement("value"));
@@ -6712,6 +6868,8 @@ get_obj()->set_i32_2(value);
 return mr;
 }
 }
+break;
+case 2064476217U:
 if (m->MemberName == "i32_huge")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<int32_t > > value=RobotRaconteur::MessageElement_UnpackArray<int32_t >(m->FindElement("value"));
@@ -6727,6 +6885,8 @@ get_obj()->set_i32_huge(value);
 return mr;
 }
 }
+break;
+case 2775599617U:
 if (m->MemberName == "u32_1")
 {
 uint32_t value=RobotRaconteur::MessageElement_UnpackScalar<uint32_t >(m->FindElement("value"));
@@ -6742,6 +6902,8 @@ get_obj()->set_u32_1(value);
 return mr;
 }
 }
+break;
+case 2725266760U:
 if (m->MemberName == "u32_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<uint32_t > > value=RobotRaconteur::MessageElement_UnpackArray<uint32_t >(m->FindElement("value"));
@@ -6757,6 +6919,8 @@ get_obj()->set_u32_2(value);
 return mr;
 }
 }
+break;
+case 3982616126U:
 if (m->MemberName == "i64_1")
 {
 int64_t value=RobotRaconteur::MessageElement_UnpackScalar<int64_t >(m->FindElement("value"));
@@ -6772,6 +6936,8 @@ get_obj()->set_i64_1(value);
 return mr;
 }
 }
+break;
+case 3965838507U:
 if (m->MemberName == "i64_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<int64_t > > value=RobotRaconteur::MessageElement_UnpackArray<int64_t >(m->FindElement("value"));
@@ -6787,6 +6953,8 @@ get_obj()->set_i64_2(value);
 return mr;
 }
 }
+break;
+case 2780644210U:
 if (m->MemberName == "u64_1")
 {
 uint64_t value=RobotRaconteur::MessageElement_UnpackScalar<uint64_t >(m->FindElement("value"));
@@ -6802,6 +6970,8 @@ get_obj()->set_u64_1(value);
 return mr;
 }
 }
+break;
+case 2763866591U:
 if (m->MemberName == "u64_2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<uint64_t > > value=RobotRaconteur::MessageElement_UnpackArray<uint64_t >(m->FindElement("value"));
@@ -6817,6 +6987,8 @@ get_obj()->set_u64_2(value);
 return mr;
 }
 }
+break;
+case 2119893107U:
 if (m->MemberName == "str1")
 {
 std::string value=RobotRaconteur::MessageElement_UnpackString(m->FindElement("value"));
@@ -6832,6 +7004,8 @@ get_obj()->set_str1(value);
 return mr;
 }
 }
+break;
+case 428946627U:
 if (m->MemberName == "struct1")
 {
 RR_INTRUSIVE_PTR<teststruct1 > value=RobotRaconteur::MessageElement_UnpackStructure<teststruct1 >(RRGetNodeWeak(), m->FindElement("value"));
@@ -6847,6 +7021,8 @@ get_obj()->set_struct1(value);
 return mr;
 }
 }
+break;
+case 445724246U:
 if (m->MemberName == "struct2")
 {
 RR_INTRUSIVE_PTR<teststruct2 > value=RobotRaconteur::MessageElement_UnpackStructure<teststruct2 >(RRGetNodeWeak(), m->FindElement("value"));
@@ -6862,6 +7038,8 @@ get_obj()->set_struct2(value);
 return mr;
 }
 }
+break;
+case 927387661U:
 if (m->MemberName == "is_d1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6877,6 +7055,8 @@ get_obj()->set_is_d1(value);
 return mr;
 }
 }
+break;
+case 877054804U:
 if (m->MemberName == "is_d2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<std::string,RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::MessageElement_UnpackMap<std::string,RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6892,6 +7072,8 @@ get_obj()->set_is_d2(value);
 return mr;
 }
 }
+break;
+case 893832423U:
 if (m->MemberName == "is_d3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6907,6 +7089,8 @@ get_obj()->set_is_d3(value);
 return mr;
 }
 }
+break;
+case 843499566U:
 if (m->MemberName == "is_d4")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<std::string,RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::MessageElement_UnpackMap<std::string,RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6922,6 +7106,8 @@ get_obj()->set_is_d4(value);
 return mr;
 }
 }
+break;
+case 860277185U:
 if (m->MemberName == "is_d5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRMultiDimArray<double >  > > value=RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRMultiDimArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6937,6 +7123,8 @@ get_obj()->set_is_d5(value);
 return mr;
 }
 }
+break;
+case 809944328U:
 if (m->MemberName == "is_d6")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<std::string,RobotRaconteur::RRMultiDimArray<double >  > > value=RobotRaconteur::MessageElement_UnpackMap<std::string,RobotRaconteur::RRMultiDimArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6952,6 +7140,8 @@ get_obj()->set_is_d6(value);
 return mr;
 }
 }
+break;
+case 3509864928U:
 if (m->MemberName == "is_str1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRArray<char>  > > value=RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRArray<char>  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6967,6 +7157,8 @@ get_obj()->set_is_str1(value);
 return mr;
 }
 }
+break;
+case 3560197785U:
 if (m->MemberName == "is_str2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<std::string,RobotRaconteur::RRArray<char>  > > value=RobotRaconteur::MessageElement_UnpackMap<std::string,RobotRaconteur::RRArray<char>  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6982,6 +7174,8 @@ get_obj()->set_is_str2(value);
 return mr;
 }
 }
+break;
+case 1659339790U:
 if (m->MemberName == "is_struct1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,teststruct2  > > value=RobotRaconteur::MessageElement_UnpackMap<int32_t,teststruct2  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -6997,6 +7191,8 @@ get_obj()->set_is_struct1(value);
 return mr;
 }
 }
+break;
+case 1642562171U:
 if (m->MemberName == "is_struct2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<std::string,teststruct2  > > value=RobotRaconteur::MessageElement_UnpackMap<std::string,teststruct2  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7012,6 +7208,8 @@ get_obj()->set_is_struct2(value);
 return mr;
 }
 }
+break;
+case 462501865U:
 if (m->MemberName == "struct3")
 {
 RR_INTRUSIVE_PTR<com::robotraconteur::testing::TestService2::ostruct2 > value=RobotRaconteur::MessageElement_UnpackStructure<com::robotraconteur::testing::TestService2::ostruct2 >(RRGetNodeWeak(), m->FindElement("value"));
@@ -7027,6 +7225,8 @@ get_obj()->set_struct3(value);
 return mr;
 }
 }
+break;
+case 1347812177U:
 if (m->MemberName == "list_d1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7042,6 +7242,8 @@ get_obj()->set_list_d1(value);
 return mr;
 }
 }
+break;
+case 1314256939U:
 if (m->MemberName == "list_d3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7057,6 +7259,8 @@ get_obj()->set_list_d3(value);
 return mr;
 }
 }
+break;
+case 1414922653U:
 if (m->MemberName == "list_d5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRMultiDimArray<double >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRMultiDimArray<double >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7072,6 +7276,8 @@ get_obj()->set_list_d5(value);
 return mr;
 }
 }
+break;
+case 2237349844U:
 if (m->MemberName == "list_str1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<char>  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<char>  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7087,6 +7293,8 @@ get_obj()->set_list_str1(value);
 return mr;
 }
 }
+break;
+case 723748586U:
 if (m->MemberName == "list_struct1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<teststruct2  > > value=RobotRaconteur::MessageElement_UnpackList<teststruct2  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7102,6 +7310,8 @@ get_obj()->set_list_struct1(value);
 return mr;
 }
 }
+break;
+case 145458717U:
 if (m->MemberName == "var1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7117,6 +7327,8 @@ get_obj()->set_var1(value);
 return mr;
 }
 }
+break;
+case 95125860U:
 if (m->MemberName == "var2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRValue > > value=RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRValue >(RRGetNodeWeak(),m->FindElement("value"));
@@ -7132,6 +7344,8 @@ get_obj()->set_var2(value);
 return mr;
 }
 }
+break;
+case 1128751073U:
 if (m->MemberName == "var_num")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7147,6 +7361,8 @@ get_obj()->set_var_num(value);
 return mr;
 }
 }
+break;
+case 3873036906U:
 if (m->MemberName == "var_str")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7162,6 +7378,8 @@ get_obj()->set_var_str(value);
 return mr;
 }
 }
+break;
+case 2296596922U:
 if (m->MemberName == "var_struct")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7177,6 +7395,8 @@ get_obj()->set_var_struct(value);
 return mr;
 }
 }
+break;
+case 1212725712U:
 if (m->MemberName == "var_vector")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7192,6 +7412,8 @@ get_obj()->set_var_vector(value);
 return mr;
 }
 }
+break;
+case 2003121755U:
 if (m->MemberName == "var_dictionary")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7207,6 +7429,8 @@ get_obj()->set_var_dictionary(value);
 return mr;
 }
 }
+break;
+case 758700987U:
 if (m->MemberName == "var_list")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7222,6 +7446,8 @@ get_obj()->set_var_list(value);
 return mr;
 }
 }
+break;
+case 2716968003U:
 if (m->MemberName == "var_multidimarray")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRValue> value=RobotRaconteur::MessageElement_UnpackVarValue(RRGetNodeWeak(),m->FindElement("value"));
@@ -7237,6 +7463,8 @@ get_obj()->set_var_multidimarray(value);
 return mr;
 }
 }
+break;
+case 3126090440U:
 if (m->MemberName == "errtest")
 {
 double value=RobotRaconteur::MessageElement_UnpackScalar<double >(m->FindElement("value"));
@@ -7252,6 +7480,8 @@ get_obj()->set_errtest(value);
 return mr;
 }
 }
+break;
+case 2582687424U:
 if (m->MemberName == "nulltest")
 {
 RR_INTRUSIVE_PTR<teststruct1 > value=RobotRaconteur::MessageElement_UnpackStructure<teststruct1 >(RRGetNodeWeak(), m->FindElement("value"));
@@ -7267,6 +7497,10 @@ get_obj()->set_nulltest(value);
 return mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -8450,6 +8684,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot_skel::CallFunction(const
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> rr_mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_FunctionCallRes,rr_m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService1::async_testroot > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(rr_m->MemberName))
+{
+case 114011394U:
 if (rr_m->MemberName == "func1")
 {
 if (async_obj)
@@ -8465,6 +8702,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 97233775U:
 if (rr_m->MemberName == "func2")
 {
 double d1 =RobotRaconteur::MessageElement_UnpackScalar<double >(rr_m->FindElement("d1"));
@@ -8482,6 +8721,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 80456156U:
 if (rr_m->MemberName == "func3")
 {
 double d1 =RobotRaconteur::MessageElement_UnpackScalar<double >(rr_m->FindElement("d1"));
@@ -8499,6 +8740,8 @@ rr_mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<double >("ret
 return rr_mr;
 }
 }
+break;
+case 3861643235U:
 if (rr_m->MemberName == "meaning_of_life")
 {
 if (async_obj)
@@ -8514,6 +8757,8 @@ rr_mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int32_t >("re
 return rr_mr;
 }
 }
+break;
+case 1894197827U:
 if (rr_m->MemberName == "func_errtest")
 {
 if (async_obj)
@@ -8529,6 +8774,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 770167158U:
 if (rr_m->MemberName == "func_errtest1")
 {
 if (async_obj)
@@ -8544,6 +8791,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 753389539U:
 if (rr_m->MemberName == "func_errtest2")
 {
 if (async_obj)
@@ -8559,6 +8808,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 736611920U:
 if (rr_m->MemberName == "func_errtest3")
 {
 if (async_obj)
@@ -8574,6 +8825,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 1715900490U:
 if (rr_m->MemberName == "o6_op")
 {
 int32_t op =RobotRaconteur::MessageElement_UnpackScalar<int32_t >(rr_m->FindElement("op"));
@@ -8590,6 +8843,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 1927088295U:
 if (rr_m->MemberName == "pipe_check_error")
 {
 if (async_obj)
@@ -8605,6 +8860,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 760786566U:
 if (rr_m->MemberName == "test_callbacks")
 {
 if (async_obj)
@@ -8620,6 +8877,10 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -8959,47 +9220,73 @@ obj->set_broadcastwire(rr_broadcastwire_wire);
 
 void testroot_skel::DispatchWireMessage(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 273102853U:
 if (m->MemberName=="w1")
 {
 rr_w1_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 222769996U:
 if (m->MemberName=="w2")
 {
 rr_w2_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 239547615U:
 if (m->MemberName=="w3")
 {
 rr_w3_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 2619917017U:
 if (m->MemberName=="broadcastwire")
 {
 rr_broadcastwire_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot_skel::CallWireFunction(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 273102853U:
 if (m->MemberName=="w1")
 {
 return rr_w1_wire->WireCommand(m,e);
 }
+break;
+case 222769996U:
 if (m->MemberName=="w2")
 {
 return rr_w2_wire->WireCommand(m,e);
 }
+break;
+case 239547615U:
 if (m->MemberName=="w3")
 {
 return rr_w3_wire->WireCommand(m,e);
 }
+break;
+case 2619917017U:
 if (m->MemberName=="broadcastwire")
 {
 return rr_broadcastwire_wire->WireCommand(m,e);
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -9062,26 +9349,41 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> rr_ret=rr_s->ProcessCallbackReque
 
 RR_SHARED_PTR<void> testroot_skel::GetCallbackFunction(uint32_t endpoint, boost::string_ref membername)
 {
+switch (RobotRaconteur::detail::MemberNameHash(membername))
+{
+case 2976717427U:
 if (membername=="cb1")
 {
 return RR_MAKE_SHARED<boost::function<void() > >(boost::bind(&testroot_skel::rr_cb1_callback, RobotRaconteur::rr_cast<testroot_skel>(shared_from_this()), endpoint));
 }
+break;
+case 2993495046U:
 if (membername=="cb2")
 {
 return RR_MAKE_SHARED<boost::function<void(double, double) > >(boost::bind(&testroot_skel::rr_cb2_callback, RobotRaconteur::rr_cast<testroot_skel>(shared_from_this()), endpoint, RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2)));
 }
+break;
+case 3010272665U:
 if (membername=="cb3")
 {
 return RR_MAKE_SHARED<boost::function<double(double, double) > >(boost::bind(&testroot_skel::rr_cb3_callback, RobotRaconteur::rr_cast<testroot_skel>(shared_from_this()), endpoint, RR_BOOST_PLACEHOLDERS(_1), RR_BOOST_PLACEHOLDERS(_2)));
 }
+break;
+case 3204668827U:
 if (membername=="cb_meaning_of_life")
 {
 return RR_MAKE_SHARED<boost::function<int32_t() > >(boost::bind(&testroot_skel::rr_cb_meaning_of_life_callback, RobotRaconteur::rr_cast<testroot_skel>(shared_from_this()), endpoint));
 }
+break;
+case 908996752U:
 if (membername=="cb_errtest")
 {
 return RR_MAKE_SHARED<boost::function<void() > >(boost::bind(&testroot_skel::rr_cb_errtest_callback, RobotRaconteur::rr_cast<testroot_skel>(shared_from_this()), endpoint));
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -9134,6 +9436,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> sub1_skel::CallGetProperty(const
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_PropertyGetRes,m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService1::async_sub1 > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 2283607014U:
 if (m->MemberName == "d1")
 {
 if (async_obj)
@@ -9149,6 +9454,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<double >("value",
 return mr;
 }
 }
+break;
+case 2266829395U:
 if (m->MemberName == "d2")
 {
 if (async_obj)
@@ -9164,6 +9471,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<double >(
 return mr;
 }
 }
+break;
+case 2292718872U:
 if (m->MemberName == "s_ind")
 {
 if (async_obj)
@@ -9179,6 +9488,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStringElement("value",value));
 return mr;
 }
 }
+break;
+case 3149962994U:
 if (m->MemberName == "i_ind")
 {
 if (async_obj)
@@ -9194,6 +9505,10 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int32_t >("value
 return mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -9201,6 +9516,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> sub1_skel::CallSetProperty(const
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_PropertySetRes,m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService1::async_sub1 > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 2283607014U:
 if (m->MemberName == "d1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<double > > value=RobotRaconteur::MessageElement_UnpackArray<double >(m->FindElement("value"));
@@ -9216,6 +9534,8 @@ get_obj()->set_d1(value);
 return mr;
 }
 }
+break;
+case 2266829395U:
 if (m->MemberName == "d2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<double > > value=RobotRaconteur::MessageElement_UnpackMultiDimArray<double >(RRGetNodeWeak(),m->FindElement("value"));
@@ -9231,6 +9551,8 @@ get_obj()->set_d2(value);
 return mr;
 }
 }
+break;
+case 2292718872U:
 if (m->MemberName == "s_ind")
 {
 std::string value=RobotRaconteur::MessageElement_UnpackString(m->FindElement("value"));
@@ -9246,6 +9568,8 @@ get_obj()->set_s_ind(value);
 return mr;
 }
 }
+break;
+case 3149962994U:
 if (m->MemberName == "i_ind")
 {
 int32_t value=RobotRaconteur::MessageElement_UnpackScalar<int32_t >(m->FindElement("value"));
@@ -9261,6 +9585,10 @@ get_obj()->set_i_ind(value);
 return mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
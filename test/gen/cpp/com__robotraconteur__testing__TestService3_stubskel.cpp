@@ -4471,6 +4471,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot3_skel::CallGetProperty(c
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_PropertyGetRes,m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService3::async_testroot3 > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 1242013863U:
 if (m->MemberName == "readme")
 {
 if (async_obj)
@@ -4486,10 +4489,14 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int32_t >("value
 return mr;
 }
 }
+break;
+case 219601970U:
 if (m->MemberName == "writeme")
 {
 throw RobotRaconteur::WriteOnlyMemberException("Write only property");
 }
+break;
+case 1371202607U:
 if (m->MemberName == "unknown_modifier")
 {
 if (async_obj)
@@ -4505,6 +4512,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<int32_t >("value
 return mr;
 }
 }
+break;
+case 2292771629U:
 if (m->MemberName == "testenum1_prop")
 {
 if (async_obj)
@@ -4520,6 +4529,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackEnumElement("value",value));
 return mr;
 }
 }
+break;
+case 4163452505U:
 if (m->MemberName == "testpod1_prop")
 {
 if (async_obj)
@@ -4535,6 +4546,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackPodToArrayElement("value",valu
 return mr;
 }
 }
+break;
+case 1563671723U:
 if (m->MemberName == "teststruct3_prop")
 {
 if (async_obj)
@@ -4550,6 +4563,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackStructElement(RRGetNodeWeak(),
 return mr;
 }
 }
+break;
+case 2283607014U:
 if (m->MemberName == "d1")
 {
 if (async_obj)
@@ -4565,6 +4580,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2266829395U:
 if (m->MemberName == "d2")
 {
 if (async_obj)
@@ -4580,6 +4597,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2250051776U:
 if (m->MemberName == "d3")
 {
 if (async_obj)
@@ -4595,6 +4614,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 2367495109U:
 if (m->MemberName == "d4")
 {
 if (async_obj)
@@ -4610,6 +4631,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 2350717490U:
 if (m->MemberName == "d5")
 {
 if (async_obj)
@@ -4625,6 +4648,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2333939871U:
 if (m->MemberName == "d6")
 {
 if (async_obj)
@@ -4640,6 +4665,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMapElement<int32_t,RobotRacont
 return mr;
 }
 }
+break;
+case 1713981402U:
 if (m->MemberName == "testnamedarray1")
 {
 if (async_obj)
@@ -4655,6 +4682,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackNamedArrayToArrayElement("valu
 return mr;
 }
 }
+break;
+case 1697203783U:
 if (m->MemberName == "testnamedarray2")
 {
 if (async_obj)
@@ -4670,6 +4699,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackNamedArrayToArrayElement("valu
 return mr;
 }
 }
+break;
+case 1680426164U:
 if (m->MemberName == "testnamedarray3")
 {
 if (async_obj)
@@ -4685,6 +4716,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackNamedArrayElement("value",Robo
 return mr;
 }
 }
+break;
+case 1663648545U:
 if (m->MemberName == "testnamedarray4")
 {
 if (async_obj)
@@ -4700,6 +4733,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackNamedMultiDimArrayElement("val
 return mr;
 }
 }
+break;
+case 1646870926U:
 if (m->MemberName == "testnamedarray5")
 {
 if (async_obj)
@@ -4715,6 +4750,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackNamedMultiDimArrayElement("val
 return mr;
 }
 }
+break;
+case 2284445657U:
 if (m->MemberName == "c1")
 {
 if (async_obj)
@@ -4730,6 +4767,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<RobotRaconteur::
 return mr;
 }
 }
+break;
+case 2234112800U:
 if (m->MemberName == "c2")
 {
 if (async_obj)
@@ -4745,6 +4784,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<RobotRaconteur::c
 return mr;
 }
 }
+break;
+case 2250890419U:
 if (m->MemberName == "c3")
 {
 if (async_obj)
@@ -4760,6 +4801,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<RobotRaco
 return mr;
 }
 }
+break;
+case 2334778514U:
 if (m->MemberName == "c4")
 {
 if (async_obj)
@@ -4775,6 +4818,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2351556133U:
 if (m->MemberName == "c5")
 {
 if (async_obj)
@@ -4790,6 +4835,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2301223276U:
 if (m->MemberName == "c6")
 {
 if (async_obj)
@@ -4805,6 +4852,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2318000895U:
 if (m->MemberName == "c7")
 {
 if (async_obj)
@@ -4820,6 +4869,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<RobotRaconteur::
 return mr;
 }
 }
+break;
+case 2401888990U:
 if (m->MemberName == "c8")
 {
 if (async_obj)
@@ -4835,6 +4886,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<RobotRaconteur::c
 return mr;
 }
 }
+break;
+case 2418666609U:
 if (m->MemberName == "c9")
 {
 if (async_obj)
@@ -4850,6 +4903,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<RobotRaco
 return mr;
 }
 }
+break;
+case 1122728907U:
 if (m->MemberName == "c10")
 {
 if (async_obj)
@@ -4865,6 +4920,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 1105951288U:
 if (m->MemberName == "c11")
 {
 if (async_obj)
@@ -4880,6 +4937,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 1156284145U:
 if (m->MemberName == "c12")
 {
 if (async_obj)
@@ -4895,6 +4954,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2351703228U:
 if (m->MemberName == "b1")
 {
 if (async_obj)
@@ -4910,6 +4971,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackScalarElement<RobotRaconteur::
 return mr;
 }
 }
+break;
+case 2402036085U:
 if (m->MemberName == "b2")
 {
 if (async_obj)
@@ -4925,6 +4988,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackArrayElement<RobotRaconteur::r
 return mr;
 }
 }
+break;
+case 2385258466U:
 if (m->MemberName == "b3")
 {
 if (async_obj)
@@ -4940,6 +5005,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackMultiDimArrayElement<RobotRaco
 return mr;
 }
 }
+break;
+case 2301370371U:
 if (m->MemberName == "b4")
 {
 if (async_obj)
@@ -4955,6 +5022,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2284592752U:
 if (m->MemberName == "b5")
 {
 if (async_obj)
@@ -4970,6 +5039,8 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+case 2334925609U:
 if (m->MemberName == "b6")
 {
 if (async_obj)
@@ -4985,6 +5056,10 @@ mr->AddElement(RobotRaconteur::MessageElement_PackListElement<RobotRaconteur::RR
 return mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -4992,10 +5067,15 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot3_skel::CallSetProperty(c
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_PropertySetRes,m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService3::async_testroot3 > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 1242013863U:
 if (m->MemberName == "readme")
 {
 throw RobotRaconteur::ReadOnlyMemberException("Read only property");
 }
+break;
+case 219601970U:
 if (m->MemberName == "writeme")
 {
 int32_t value=RobotRaconteur::MessageElement_UnpackScalar<int32_t >(m->FindElement("value"));
@@ -5011,6 +5091,8 @@ get_obj()->set_writeme(value);
 return mr;
 }
 }
+break;
+case 1371202607U:
 if (m->MemberName == "unknown_modifier")
 {
 int32_t value=RobotRaconteur::MessageElement_UnpackScalar<int32_t >(m->FindElement("value"));
@@ -5026,6 +5108,8 @@ get_obj()->set_unknown_modifier(value);
 return mr;
 }
 }
+break;
+case 2292771629U:
 if (m->MemberName == "testenum1_prop")
 {
 testenum1::testenum1 value=RobotRaconteur::MessageElement_UnpackEnum<testenum1::testenum1>(m->FindElement("value"));
@@ -5041,6 +5125,8 @@ get_obj()->set_testenum1_prop(value);
 return mr;
 }
 }
+break;
+case 4163452505U:
 if (m->MemberName == "testpod1_prop")
 {
 testpod1 value=RobotRaconteur::MessageElement_UnpackPodFromArray<testpod1>(m->FindElement("value"));
@@ -5056,6 +5142,8 @@ get_obj()->set_testpod1_prop(value);
 return mr;
 }
 }
+break;
+case 1563671723U:
 if (m->MemberName == "teststruct3_prop")
 {
 RR_INTRUSIVE_PTR<teststruct3 > value=RobotRaconteur::MessageElement_UnpackStructure<teststruct3 >(RRGetNodeWeak(), m->FindElement("value"));
@@ -5071,6 +5159,8 @@ get_obj()->set_teststruct3_prop(value);
 return mr;
 }
 }
+break;
+case 2283607014U:
 if (m->MemberName == "d1")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value")), 6, false);
@@ -5086,6 +5176,8 @@ get_obj()->set_d1(value);
 return mr;
 }
 }
+break;
+case 2266829395U:
 if (m->MemberName == "d2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value")), 6, true);
@@ -5101,6 +5193,8 @@ get_obj()->set_d2(value);
 return mr;
 }
 }
+break;
+case 2250051776U:
 if (m->MemberName == "d3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value")), 6, false);
@@ -5116,6 +5210,8 @@ get_obj()->set_d3(value);
 return mr;
 }
 }
+break;
+case 2367495109U:
 if (m->MemberName == "d4")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRArray<double >  > > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRArray<double >  >(RRGetNodeWeak(),m->FindElement("value")), 6, true);
@@ -5131,6 +5227,8 @@ get_obj()->set_d4(value);
 return mr;
 }
 }
+break;
+case 2350717490U:
 if (m->MemberName == "d5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRMultiDimArray<double >  > > value=RobotRaconteur::VerifyRRMultiDimArrayLength<2>(RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRMultiDimArray<double >  >(RRGetNodeWeak(),m->FindElement("value")),9,boost::assign::list_of(3)(3));
@@ -5146,6 +5244,8 @@ get_obj()->set_d5(value);
 return mr;
 }
 }
+break;
+case 2333939871U:
 if (m->MemberName == "d6")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMap<int32_t,RobotRaconteur::RRMultiDimArray<double >  > > value=RobotRaconteur::VerifyRRMultiDimArrayLength<2>(RobotRaconteur::MessageElement_UnpackMap<int32_t,RobotRaconteur::RRMultiDimArray<double >  >(RRGetNodeWeak(),m->FindElement("value")),9,boost::assign::list_of(3)(3));
@@ -5161,6 +5261,8 @@ get_obj()->set_d6(value);
 return mr;
 }
 }
+break;
+case 1713981402U:
 if (m->MemberName == "testnamedarray1")
 {
 vector3 value=RobotRaconteur::MessageElement_UnpackNamedArrayFromArray<vector3>(m->FindElement("value"));
@@ -5176,6 +5278,8 @@ get_obj()->set_testnamedarray1(value);
 return mr;
 }
 }
+break;
+case 1697203783U:
 if (m->MemberName == "testnamedarray2")
 {
 transform value=RobotRaconteur::MessageElement_UnpackNamedArrayFromArray<transform>(m->FindElement("value"));
@@ -5191,6 +5295,8 @@ get_obj()->set_testnamedarray2(value);
 return mr;
 }
 }
+break;
+case 1680426164U:
 if (m->MemberName == "testnamedarray3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRNamedArray<transform> > value=RobotRaconteur::VerifyRRArrayLength(RobotRaconteur::MessageElement_UnpackNamedArray<transform>(m->FindElement("value")), 10, true);
@@ -5206,6 +5312,8 @@ get_obj()->set_testnamedarray3(value);
 return mr;
 }
 }
+break;
+case 1663648545U:
 if (m->MemberName == "testnamedarray4")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRNamedMultiDimArray<transform> > value=RobotRaconteur::MessageElement_UnpackNamedMultiDimArray<transform>(m->FindElement("value"));
@@ -5221,6 +5329,8 @@ get_obj()->set_testnamedarray4(value);
 return mr;
 }
 }
+break;
+case 1646870926U:
 if (m->MemberName == "testnamedarray5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRNamedMultiDimArray<transform> > value=RobotRaconteur::VerifyRRMultiDimArrayLength<2>(RobotRaconteur::MessageElement_UnpackNamedMultiDimArray<transform>(m->FindElement("value")),6,boost::assign::list_of(3)(2));
@@ -5236,6 +5346,8 @@ get_obj()->set_testnamedarray5(value);
 return mr;
 }
 }
+break;
+case 2284445657U:
 if (m->MemberName == "c1")
 {
 RobotRaconteur::cdouble value=RobotRaconteur::MessageElement_UnpackScalar<RobotRaconteur::cdouble >(m->FindElement("value"));
@@ -5251,6 +5363,8 @@ get_obj()->set_c1(value);
 return mr;
 }
 }
+break;
+case 2234112800U:
 if (m->MemberName == "c2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<RobotRaconteur::cdouble > > value=RobotRaconteur::MessageElement_UnpackArray<RobotRaconteur::cdouble >(m->FindElement("value"));
@@ -5266,6 +5380,8 @@ get_obj()->set_c2(value);
 return mr;
 }
 }
+break;
+case 2250890419U:
 if (m->MemberName == "c3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<RobotRaconteur::cdouble > > value=RobotRaconteur::MessageElement_UnpackMultiDimArray<RobotRaconteur::cdouble >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5281,6 +5397,8 @@ get_obj()->set_c3(value);
 return mr;
 }
 }
+break;
+case 2334778514U:
 if (m->MemberName == "c4")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<RobotRaconteur::cdouble >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<RobotRaconteur::cdouble >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5296,6 +5414,8 @@ get_obj()->set_c4(value);
 return mr;
 }
 }
+break;
+case 2351556133U:
 if (m->MemberName == "c5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<RobotRaconteur::cdouble >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<RobotRaconteur::cdouble >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5311,6 +5431,8 @@ get_obj()->set_c5(value);
 return mr;
 }
 }
+break;
+case 2301223276U:
 if (m->MemberName == "c6")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRMultiDimArray<RobotRaconteur::cdouble >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRMultiDimArray<RobotRaconteur::cdouble >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5326,6 +5448,8 @@ get_obj()->set_c6(value);
 return mr;
 }
 }
+break;
+case 2318000895U:
 if (m->MemberName == "c7")
 {
 RobotRaconteur::cfloat value=RobotRaconteur::MessageElement_UnpackScalar<RobotRaconteur::cfloat >(m->FindElement("value"));
@@ -5341,6 +5465,8 @@ get_obj()->set_c7(value);
 return mr;
 }
 }
+break;
+case 2401888990U:
 if (m->MemberName == "c8")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<RobotRaconteur::cfloat > > value=RobotRaconteur::MessageElement_UnpackArray<RobotRaconteur::cfloat >(m->FindElement("value"));
@@ -5356,6 +5482,8 @@ get_obj()->set_c8(value);
 return mr;
 }
 }
+break;
+case 2418666609U:
 if (m->MemberName == "c9")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<RobotRaconteur::cfloat > > value=RobotRaconteur::MessageElement_UnpackMultiDimArray<RobotRaconteur::cfloat >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5371,6 +5499,8 @@ get_obj()->set_c9(value);
 return mr;
 }
 }
+break;
+case 1122728907U:
 if (m->MemberName == "c10")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<RobotRaconteur::cfloat >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<RobotRaconteur::cfloat >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5386,6 +5516,8 @@ get_obj()->set_c10(value);
 return mr;
 }
 }
+break;
+case 1105951288U:
 if (m->MemberName == "c11")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<RobotRaconteur::cfloat >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<RobotRaconteur::cfloat >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5401,6 +5533,8 @@ get_obj()->set_c11(value);
 return mr;
 }
 }
+break;
+case 1156284145U:
 if (m->MemberName == "c12")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRMultiDimArray<RobotRaconteur::cfloat >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRMultiDimArray<RobotRaconteur::cfloat >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5416,6 +5550,8 @@ get_obj()->set_c12(value);
 return mr;
 }
 }
+break;
+case 2351703228U:
 if (m->MemberName == "b1")
 {
 RobotRaconteur::rr_bool value=RobotRaconteur::MessageElement_UnpackScalar<RobotRaconteur::rr_bool >(m->FindElement("value"));
@@ -5431,6 +5567,8 @@ get_obj()->set_b1(value);
 return mr;
 }
 }
+break;
+case 2402036085U:
 if (m->MemberName == "b2")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRArray<RobotRaconteur::rr_bool > > value=RobotRaconteur::MessageElement_UnpackArray<RobotRaconteur::rr_bool >(m->FindElement("value"));
@@ -5446,6 +5584,8 @@ get_obj()->set_b2(value);
 return mr;
 }
 }
+break;
+case 2385258466U:
 if (m->MemberName == "b3")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRMultiDimArray<RobotRaconteur::rr_bool > > value=RobotRaconteur::MessageElement_UnpackMultiDimArray<RobotRaconteur::rr_bool >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5461,6 +5601,8 @@ get_obj()->set_b3(value);
 return mr;
 }
 }
+break;
+case 2301370371U:
 if (m->MemberName == "b4")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<RobotRaconteur::rr_bool >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<RobotRaconteur::rr_bool >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5476,6 +5618,8 @@ get_obj()->set_b4(value);
 return mr;
 }
 }
+break;
+case 2284592752U:
 if (m->MemberName == "b5")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRArray<RobotRaconteur::rr_bool >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRArray<RobotRaconteur::rr_bool >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5491,6 +5635,8 @@ get_obj()->set_b5(value);
 return mr;
 }
 }
+break;
+case 2334925609U:
 if (m->MemberName == "b6")
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::RRList<RobotRaconteur::RRMultiDimArray<RobotRaconteur::rr_bool >  > > value=RobotRaconteur::MessageElement_UnpackList<RobotRaconteur::RRMultiDimArray<RobotRaconteur::rr_bool >  >(RRGetNodeWeak(),m->FindElement("value"));
@@ -5506,6 +5652,10 @@ get_obj()->set_b6(value);
 return mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -6227,6 +6377,9 @@ RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot3_skel::CallFunction(cons
 {
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> rr_mr=RobotRaconteur::CreateMessageEntry(RobotRaconteur::MessageEntryType_FunctionCallRes,rr_m->MemberName);
 RR_SHARED_PTR<com::robotraconteur::testing::TestService3::async_testroot3 > async_obj=get_asyncobj();
+switch (RobotRaconteur::detail::MemberNameHash(rr_m->MemberName))
+{
+case 3853543917U:
 if (rr_m->MemberName == "testpod1_func1")
 {
 testpod1 s =RobotRaconteur::MessageElement_UnpackPodFromArray<testpod1>(rr_m->FindElement("s"));
@@ -6243,6 +6396,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 3803211060U:
 if (rr_m->MemberName == "testpod1_func2")
 {
 if (async_obj)
@@ -6258,6 +6413,8 @@ rr_mr->AddElement(RobotRaconteur::MessageElement_PackPodToArrayElement("return",
 return rr_mr;
 }
 }
+break;
+case 2369059819U:
 if (rr_m->MemberName == "gen_func1")
 {
 {
@@ -6272,6 +6429,8 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+case 2385837438U:
 if (rr_m->MemberName == "gen_func2")
 {
 std::string name =RobotRaconteur::MessageElement_UnpackString(rr_m->FindElement("name"));
@@ -6287,6 +6446,8 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+case 2402615057U:
 if (rr_m->MemberName == "gen_func3")
 {
 std::string name =RobotRaconteur::MessageElement_UnpackString(rr_m->FindElement("name"));
@@ -6302,6 +6463,8 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+case 2419392676U:
 if (rr_m->MemberName == "gen_func4")
 {
 {
@@ -6316,6 +6479,8 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+case 2436170295U:
 if (rr_m->MemberName == "gen_func5")
 {
 {
@@ -6330,6 +6495,8 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+case 2524251261U:
 if (rr_m->MemberName == "test_exception_params1")
 {
 if (async_obj)
@@ -6345,6 +6512,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 2473918404U:
 if (rr_m->MemberName == "test_exception_params2")
 {
 if (async_obj)
@@ -6360,6 +6529,8 @@ rr_mr->AddElement("return",RobotRaconteur::ScalarToRRArray<int32_t>(0));
 return rr_mr;
 }
 }
+break;
+case 162300305U:
 if (rr_m->MemberName == "enum_generator1")
 {
 {
@@ -6374,6 +6545,8 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+case 111967448U:
 if (rr_m->MemberName == "enum_generator2")
 {
 int32_t a =RobotRaconteur::MessageElement_UnpackScalar<int32_t >(rr_m->FindElement("a"));
@@ -6390,6 +6563,10 @@ rr_mr->AddElement("index", RobotRaconteur::ScalarToRRArray(rr_index));
 return rr_mr;
 }
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -6713,47 +6890,73 @@ obj->set_p3(rr_p3_pipe);
 
 void testroot3_skel::DispatchPipeMessage(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 25714883U:
 if (m->MemberName=="unreliable1")
 {
 rr_unreliable1_pipe->PipePacketReceived(m,e);
 return;
 }
+break;
+case 2689521274U:
 if (m->MemberName=="p1")
 {
 rr_p1_pipe->PipePacketReceived(m,e);
 return;
 }
+break;
+case 2672743655U:
 if (m->MemberName=="p2")
 {
 rr_p2_pipe->PipePacketReceived(m,e);
 return;
 }
+break;
+case 2655966036U:
 if (m->MemberName=="p3")
 {
 rr_p3_pipe->PipePacketReceived(m,e);
 return;
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot3_skel::CallPipeFunction(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 25714883U:
 if (m->MemberName=="unreliable1")
 {
 return rr_unreliable1_pipe->PipeCommand(m,e);
 }
+break;
+case 2689521274U:
 if (m->MemberName=="p1")
 {
 return rr_p1_pipe->PipeCommand(m,e);
 }
+break;
+case 2672743655U:
 if (m->MemberName=="p2")
 {
 return rr_p2_pipe->PipeCommand(m,e);
 }
+break;
+case 2655966036U:
 if (m->MemberName=="p3")
 {
 return rr_p3_pipe->PipeCommand(m,e);
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -6788,56 +6991,86 @@ obj->set_w3(rr_w3_wire);
 
 void testroot3_skel::DispatchWireMessage(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 2028495739U:
 if (m->MemberName=="peekwire")
 {
 rr_peekwire_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 3814620945U:
 if (m->MemberName=="pokewire")
 {
 rr_pokewire_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 273102853U:
 if (m->MemberName=="w1")
 {
 rr_w1_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 222769996U:
 if (m->MemberName=="w2")
 {
 rr_w2_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+case 239547615U:
 if (m->MemberName=="w3")
 {
 rr_w3_wire->WirePacketReceived(m,e);
 return;
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot3_skel::CallWireFunction(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, uint32_t e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 2028495739U:
 if (m->MemberName=="peekwire")
 {
 return rr_peekwire_wire->WireCommand(m,e);
 }
+break;
+case 3814620945U:
 if (m->MemberName=="pokewire")
 {
 return rr_pokewire_wire->WireCommand(m,e);
 }
+break;
+case 273102853U:
 if (m->MemberName=="w1")
 {
 return rr_w1_wire->WireCommand(m,e);
 }
+break;
+case 222769996U:
 if (m->MemberName=="w2")
 {
 return rr_w2_wire->WireCommand(m,e);
 }
+break;
+case 239547615U:
 if (m->MemberName=="w3")
 {
 return rr_w3_wire->WireCommand(m,e);
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 
@@ -6852,61 +7085,88 @@ throw RobotRaconteur::MemberNotFoundException("Member not found");
 
 RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry> testroot3_skel::CallMemoryFunction(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m, const RR_SHARED_PTR<RobotRaconteur::Endpoint>& e)
 {
+switch (RobotRaconteur::detail::MemberNameHash(m->MemberName))
+{
+case 1409424894U:
 if (m->MemberName=="readmem")
 {
 if (rr_readmem_mem==0) rr_readmem_mem=RR_MAKE_SHARED<RobotRaconteur::ArrayMemoryServiceSkel<double > >("readmem",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_readonly);
 return rr_readmem_mem->CallMemoryFunction(m,e,get_obj()->get_readmem());
 }
+break;
+case 3659454631U:
 if (m->MemberName=="pod_m1")
 {
 if (rr_pod_m1_mem==0) rr_pod_m1_mem=RR_MAKE_SHARED<RobotRaconteur::PodArrayMemoryServiceSkel<testpod2 > >("pod_m1",shared_from_this(),111,RobotRaconteur::MemberDefinition_Direction_both);
 return rr_pod_m1_mem->CallMemoryFunction(m,e,get_obj()->get_pod_m1());
 }
+break;
+case 3676232250U:
 if (m->MemberName=="pod_m2")
 {
 if (rr_pod_m2_mem==0) rr_pod_m2_mem=RR_MAKE_SHARED<RobotRaconteur::PodMultiDimArrayMemoryServiceSkel<testpod2 > >("pod_m2",shared_from_this(),111,RobotRaconteur::MemberDefinition_Direction_both);
 return rr_pod_m2_mem->CallMemoryFunction(m,e,get_obj()->get_pod_m2());
 }
+break;
+case 817383042U:
 if (m->MemberName=="namedarray_m1")
 {
 if (rr_namedarray_m1_mem==0) rr_namedarray_m1_mem=RR_MAKE_SHARED<RobotRaconteur::NamedArrayMemoryServiceSkel<transform > >("namedarray_m1",shared_from_this(),7,RobotRaconteur::MemberDefinition_Direction_both);
 return rr_namedarray_m1_mem->CallMemoryFunction(m,e,get_obj()->get_namedarray_m1());
 }
+break;
+case 800605423U:
 if (m->MemberName=="namedarray_m2")
 {
 if (rr_namedarray_m2_mem==0) rr_namedarray_m2_mem=RR_MAKE_SHARED<RobotRaconteur::NamedMultiDimArrayMemoryServiceSkel<transform > >("namedarray_m2",shared_from_this(),7,RobotRaconteur::MemberDefinition_Direction_both);
 return rr_namedarray_m2_mem->CallMemoryFunction(m,e,get_obj()->get_namedarray_m2());
 }
+break;
+case 3290787597U:
 if (m->MemberName=="c_m1")
 {
 if (rr_c_m1_mem==0) rr_c_m1_mem=RR_MAKE_SHARED<RobotRaconteur::ArrayMemoryServiceSkel<RobotRaconteur::cdouble > >("c_m1",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_both);
 return rr_c_m1_mem->CallMemoryFunction(m,e,get_obj()->get_c_m1());
 }
+break;
+case 3240454740U:
 if (m->MemberName=="c_m2")
 {
 if (rr_c_m2_mem==0) rr_c_m2_mem=RR_MAKE_SHARED<RobotRaconteur::MultiDimArrayMemoryServiceSkel<RobotRaconteur::cdouble > >("c_m2",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_both);
 return rr_c_m2_mem->CallMemoryFunction(m,e,get_obj()->get_c_m2());
 }
+break;
+case 3257232359U:
 if (m->MemberName=="c_m3")
 {
 if (rr_c_m3_mem==0) rr_c_m3_mem=RR_MAKE_SHARED<RobotRaconteur::ArrayMemoryServiceSkel<RobotRaconteur::cdouble > >("c_m3",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_both);
 return rr_c_m3_mem->CallMemoryFunction(m,e,get_obj()->get_c_m3());
 }
+break;
+case 3206899502U:
 if (m->MemberName=="c_m4")
 {
 if (rr_c_m4_mem==0) rr_c_m4_mem=RR_MAKE_SHARED<RobotRaconteur::MultiDimArrayMemoryServiceSkel<RobotRaconteur::cdouble > >("c_m4",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_both);
 return rr_c_m4_mem->CallMemoryFunction(m,e,get_obj()->get_c_m4());
 }
+break;
+case 3223677121U:
 if (m->MemberName=="c_m5")
 {
 if (rr_c_m5_mem==0) rr_c_m5_mem=RR_MAKE_SHARED<RobotRaconteur::ArrayMemoryServiceSkel<RobotRaconteur::rr_bool > >("c_m5",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_both);
 return rr_c_m5_mem->CallMemoryFunction(m,e,get_obj()->get_c_m5());
 }
+break;
+case 3173344264U:
 if (m->MemberName=="c_m6")
 {
 if (rr_c_m6_mem==0) rr_c_m6_mem=RR_MAKE_SHARED<RobotRaconteur::MultiDimArrayMemoryServiceSkel<RobotRaconteur::rr_bool > >("c_m6",shared_from_this(),RobotRaconteur::MemberDefinition_Direction_both);
 return rr_c_m6_mem->CallMemoryFunction(m,e,get_obj()->get_c_m6());
 }
+break;
+default:
+break;
+}
 throw RobotRaconteur::MemberNotFoundException("Member not found");
 }
 bool testroot3_skel::IsRequestNoLock(const RR_INTRUSIVE_PTR<RobotRaconteur::MessageEntry>& m)